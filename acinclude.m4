@@ -6,6 +6,10 @@ dnl Function to detect if libgzipf dependencies are available
 AC_DEFUN([AX_LIBGZIPF_CHECK_LOCAL],
   [dnl Check for internationalization functions in libgzipf/libgzipf_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for the auxiliary vector in libgzipf/libgzipf_cpu.c
+  AC_CHECK_HEADERS([sys/auxv.h])
+  AC_CHECK_FUNCS([getauxval])
 ])
 
 dnl Function to check if DLL support is needed
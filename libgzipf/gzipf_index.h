@@ -0,0 +1,230 @@
+/*
+ * Index file of a GZIP file
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GZIPF_INDEX_H )
+#define _GZIPF_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct gzipf_index_file_header gzipf_index_file_header_t;
+
+struct gzipf_index_file_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * Contains: "gzipfidx"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The size of the GZIP file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The fingerprint of the GZIP file
+	 * Consists of 4 bytes
+	 */
+	uint8_t fingerprint[ 4 ];
+
+	/* The number of members
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_members[ 4 ];
+
+	/* The number of segments
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_segments[ 4 ];
+
+	/* The compressed segments offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t compressed_segments_offset[ 8 ];
+};
+
+typedef struct gzipf_index_member gzipf_index_member_t;
+
+struct gzipf_index_member
+{
+	/* Flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* Operating system
+	 * Consists of 1 byte
+	 */
+	uint8_t operating_system;
+
+	/* Decompression error
+	 * Consists of 1 byte
+	 */
+	uint8_t decompression_error;
+
+	/* Unknown (reserved)
+	 * Consists of 1 byte
+	 */
+	uint8_t unknown1;
+
+	/* Modification time
+	 * Consists of 4 bytes
+	 */
+	uint8_t modification_time[ 4 ];
+
+	/* Data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* Compressed data offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t compressed_data_offset[ 8 ];
+
+	/* Compressed data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t compressed_data_size[ 8 ];
+
+	/* Uncompressed data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t uncompressed_data_size[ 4 ];
+
+	/* Calculated checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t calculated_checksum[ 4 ];
+
+	/* Stored checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t stored_checksum[ 4 ];
+
+	/* First segment index
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_segment_index[ 4 ];
+
+	/* Number of segments
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_segments[ 4 ];
+
+	/* Name size
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_size[ 4 ];
+
+	/* Comments size
+	 * Consists of 4 bytes
+	 */
+	uint8_t comments_size[ 4 ];
+
+	/* Followed by the name and comments
+	 */
+};
+
+typedef struct gzipf_index_segment gzipf_index_segment_t;
+
+struct gzipf_index_segment
+{
+	/* Compressed data offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t compressed_data_offset[ 8 ];
+
+	/* Compressed data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t compressed_data_size[ 8 ];
+
+	/* Uncompressed data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t uncompressed_data_size[ 8 ];
+
+	/* Stored data offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t stored_data_offset[ 8 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* Distance data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t distance_data_size[ 4 ];
+
+	/* Number of bits
+	 * Consists of 1 byte
+	 */
+	uint8_t number_of_bits;
+
+	/* Segment flags
+	 * Consists of 1 byte
+	 */
+	uint8_t segment_flags;
+
+	/* Block state data size
+	 * Consists of 2 bytes
+	 */
+	uint8_t block_state_data_size[ 2 ];
+
+	/* Followed by the distance data and the block state data
+	 */
+};
+
+typedef struct gzipf_index_file_footer gzipf_index_file_footer_t;
+
+struct gzipf_index_file_footer
+{
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC-32 of the preceding data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GZIPF_INDEX_H ) */
+
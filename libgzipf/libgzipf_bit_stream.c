@@ -194,11 +194,7 @@ int libgzipf_bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error )
 {
-	static char *function            = "libgzipf_bit_stream_get_value";
-	uint32_t read_value_32bit        = 0;
-	uint32_t safe_value_32bit        = 0;
-	uint8_t read_number_of_bits      = 0;
-	uint8_t remaining_number_of_bits = 0;
+	static char *function = "libgzipf_bit_stream_get_value";
 
 	if( bit_stream == NULL )
 	{
@@ -233,81 +229,52 @@ int libgzipf_bit_stream_get_value(
 
 		return( -1 );
 	}
-	remaining_number_of_bits = number_of_bits;
-
-	while( remaining_number_of_bits > 0 )
+	/* Only read the bytes needed so that the byte stream offset
+	 * remains consistent for callers that access the byte stream directly
+	 */
+	while( number_of_bits > bit_stream->bit_buffer_size )
 	{
-		while( ( remaining_number_of_bits > bit_stream->bit_buffer_size )
-		    && ( bit_stream->bit_buffer_size <= 24 ) )
-		{
-			if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid byte stream offset value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( bit_stream->storage_type == LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
-			{
-				bit_stream->bit_buffer |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
-			}
-			else if( bit_stream->storage_type == LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
-			{
-				bit_stream->bit_buffer <<= 8;
-				bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
-			}
-			bit_stream->bit_buffer_size    += 8;
-			bit_stream->byte_stream_offset += 1;
-		}
-		if( remaining_number_of_bits < bit_stream->bit_buffer_size )
-		{
-			read_number_of_bits = remaining_number_of_bits;
-		}
-		else
+		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
 		{
-			read_number_of_bits = bit_stream->bit_buffer_size;
-		}
-		read_value_32bit = bit_stream->bit_buffer;
-
-		if( remaining_number_of_bits < number_of_bits )
-		{
-			safe_value_32bit <<= remaining_number_of_bits;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			return( -1 );
 		}
 		if( bit_stream->storage_type == LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
 		{
-			if( read_number_of_bits < 32 )
-			{
-				/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
-				 */
-				read_value_32bit &= ~( 0xffffffffUL << read_number_of_bits );
-
-				bit_stream->bit_buffer >>= read_number_of_bits;
-			}
-			bit_stream->bit_buffer_size -= read_number_of_bits;
+			bit_stream->bit_buffer |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
 		}
 		else if( bit_stream->storage_type == LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
 		{
-			bit_stream->bit_buffer_size -= read_number_of_bits;
-			read_value_32bit           >>= bit_stream->bit_buffer_size;
-
-			if( bit_stream->bit_buffer_size > 0 )
-			{
-				bit_stream->bit_buffer &= 0xffffffffUL >> ( 32 - bit_stream->bit_buffer_size );
-			}
-		}
-		if( bit_stream->bit_buffer_size == 0 )
-		{
-			bit_stream->bit_buffer = 0;
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
 		}
-		safe_value_32bit         |= read_value_32bit;
-		remaining_number_of_bits -= read_number_of_bits;
+		bit_stream->bit_buffer_size    += 8;
+		bit_stream->byte_stream_offset += 1;
 	}
-	*value_32bit = safe_value_32bit;
+	if( bit_stream->storage_type == LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		*value_32bit = libgzipf_bit_stream_peek(
+		                bit_stream,
+		                number_of_bits );
 
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 number_of_bits );
+	}
+	else
+	{
+		bit_stream->bit_buffer_size -= number_of_bits;
+
+		*value_32bit = (uint32_t) ( ( bit_stream->bit_buffer >> bit_stream->bit_buffer_size ) & ( ( (uint64_t) 1 << number_of_bits ) - 1 ) );
+
+		bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+	}
 	return( 1 );
 }
 
@@ -23,8 +23,10 @@
 #define _LIBGZIPF_BIT_STREAM_H
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
+#include "libgzipf_definitions.h"
 #include "libgzipf_libcerror.h"
 
 #if defined( __cplusplus )
@@ -62,7 +64,7 @@ struct libgzipf_bit_stream
 
 	/* The bit buffer
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits remaining in the bit buffer
 	 */
@@ -81,6 +83,67 @@ int libgzipf_bit_stream_free(
      libgzipf_bit_stream_t **bit_stream,
      libcerror_error_t **error );
 
+/* Refills the bit buffer of a byte back-to-front bit stream
+ * Reads 8 bytes at a time when available, which leaves at least 56 bits in the bit buffer,
+ * otherwise reads the remaining bytes of the byte stream one at a time
+ */
+static LIBGZIPF_INLINE void libgzipf_bit_stream_refill(
+     libgzipf_bit_stream_t *bit_stream )
+{
+	uint64_t value_64bit    = 0;
+	uint8_t number_of_bytes = 0;
+
+	if( ( bit_stream->byte_stream_size >= 8 )
+	 && ( bit_stream->byte_stream_offset <= ( bit_stream->byte_stream_size - 8 ) ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 value_64bit );
+
+		number_of_bytes = (uint8_t) ( 63 - bit_stream->bit_buffer_size ) >> 3;
+
+		bit_stream->bit_buffer         |= value_64bit << bit_stream->bit_buffer_size;
+		bit_stream->bit_buffer_size    += number_of_bytes << 3;
+		bit_stream->byte_stream_offset += number_of_bytes;
+
+		/* Clear the bits that were loaded past the end of the bit buffer
+		 */
+		bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+	}
+	else
+	{
+		while( ( bit_stream->bit_buffer_size <= 56 )
+		    && ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size ) )
+		{
+			bit_stream->bit_buffer         |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
+			bit_stream->bit_buffer_size    += 8;
+			bit_stream->byte_stream_offset += 1;
+		}
+	}
+}
+
+/* Retrieves the next bits of a byte back-to-front bit stream without consuming them
+ * The number of bits should not exceed 32 and the caller is responsible
+ * for making sure the bit buffer holds sufficient bits
+ */
+static LIBGZIPF_INLINE uint32_t libgzipf_bit_stream_peek(
+     libgzipf_bit_stream_t *bit_stream,
+     uint8_t number_of_bits )
+{
+	return( (uint32_t) ( bit_stream->bit_buffer & ( ( (uint64_t) 1 << number_of_bits ) - 1 ) ) );
+}
+
+/* Consumes bits of a byte back-to-front bit stream
+ * The caller is responsible for making sure the bit buffer holds sufficient bits
+ */
+static LIBGZIPF_INLINE void libgzipf_bit_stream_consume(
+     libgzipf_bit_stream_t *bit_stream,
+     uint8_t number_of_bits )
+{
+	bit_stream->bit_buffer     >>= number_of_bits;
+	bit_stream->bit_buffer_size -= number_of_bits;
+}
+
 int libgzipf_bit_stream_get_value(
      libgzipf_bit_stream_t *bit_stream,
      uint8_t number_of_bits,
@@ -25,21 +25,56 @@
 #include <common.h>
 #include <types.h>
 
-#include "libgzipf_extern.h"
+#include "libgzipf_cpu.h"
 #include "libgzipf_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-LIBGZIPF_EXTERN_VARIABLE \
-uint32_t libgzipf_checksum_crc32_table[ 256 ];
+/* The CRC-32 kernels
+ */
+enum LIBGZIPF_CHECKSUM_CRC32_KERNELS
+{
+	LIBGZIPF_CHECKSUM_CRC32_KERNEL_UNDETERMINED	= 0,
+	LIBGZIPF_CHECKSUM_CRC32_KERNEL_TABLE		= 1,
+	LIBGZIPF_CHECKSUM_CRC32_KERNEL_PCLMULQDQ	= 2,
+	LIBGZIPF_CHECKSUM_CRC32_KERNEL_ARM_CRC32	= 3
+};
+
+extern const uint32_t libgzipf_checksum_crc32_table[ 8 ][ 256 ];
+
+extern const uint32_t libgzipf_checksum_crc32_x2n_table[ 32 ];
+
+extern int libgzipf_checksum_crc32_kernel;
+
+int libgzipf_checksum_determine_crc32_kernel(
+     void );
+
+uint32_t libgzipf_checksum_update_crc32_table(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size );
+
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
 
-LIBGZIPF_EXTERN_VARIABLE \
-int libgzipf_checksum_crc32_table_computed;
+LIBGZIPF_CPU_TARGET_PCLMULQDQ \
+uint32_t libgzipf_checksum_update_crc32_pclmulqdq(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size );
 
-void libgzipf_checksum_initialize_crc32_table(
-      int );
+#endif /* defined( LIBGZIPF_CPU_HAVE_X86_64 ) */
+
+#if defined( LIBGZIPF_CPU_HAVE_ARM_CRC32 )
+
+LIBGZIPF_CPU_TARGET_ARM_CRC32 \
+uint32_t libgzipf_checksum_update_crc32_arm_crc32(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( LIBGZIPF_CPU_HAVE_ARM_CRC32 ) */
 
 int libgzipf_checksum_calculate_crc32(
      uint32_t *checksum,
@@ -55,6 +90,17 @@ int libgzipf_checksum_calculate_weak_crc32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+uint32_t libgzipf_checksum_multiply_crc32(
+          uint32_t first_value,
+          uint32_t second_value );
+
+int libgzipf_checksum_combine_crc32(
+     uint32_t *checksum,
+     uint32_t first_checksum,
+     uint32_t second_checksum,
+     size64_t second_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
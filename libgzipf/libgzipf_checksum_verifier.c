@@ -0,0 +1,1134 @@
+/*
+ * Checksum verifier functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_checksum.h"
+#include "libgzipf_checksum_verifier.h"
+#include "libgzipf_compressed_segment.h"
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcdata.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_libcnotify.h"
+#include "libgzipf_libcthreads.h"
+#include "libgzipf_member_descriptor.h"
+#include "libgzipf_segment_descriptor.h"
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+
+/* Creates a checksum verifier
+ * Make sure the value checksum_verifier is referencing, is set to NULL
+ * The verifier uses a clone of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_checksum_verifier_initialize(
+     libgzipf_checksum_verifier_t **checksum_verifier,
+     libcdata_array_t *member_descriptors_array,
+     libcdata_array_t *segment_descriptors_array,
+     libcthreads_read_write_lock_t *read_write_lock,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_checksum_verifier_initialize";
+	int result            = 0;
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checksum_verifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checksum verifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_descriptors_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptors_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_verifier = memory_allocate_structure(
+	                      libgzipf_checksum_verifier_t );
+
+	if( *checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checksum verifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *checksum_verifier,
+	     0,
+	     sizeof( libgzipf_checksum_verifier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checksum verifier.",
+		 function );
+
+		memory_free(
+		 *checksum_verifier );
+
+		*checksum_verifier = NULL;
+
+		return( -1 );
+	}
+	( *checksum_verifier )->member_descriptors_array  = member_descriptors_array;
+	( *checksum_verifier )->segment_descriptors_array = segment_descriptors_array;
+	( *checksum_verifier )->read_write_lock           = read_write_lock;
+
+	/* The verifier thread reads the file independently of the readers of the file
+	 */
+	if( libbfio_handle_clone(
+	     &( ( *checksum_verifier )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *checksum_verifier )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *checksum_verifier )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *checksum_verifier )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *checksum_verifier )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *checksum_verifier != NULL )
+	{
+		if( ( *checksum_verifier )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *checksum_verifier )->mutex ),
+			 NULL );
+		}
+		if( ( *checksum_verifier )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *checksum_verifier )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *checksum_verifier );
+
+		*checksum_verifier = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a checksum verifier
+ * The verifier thread is stopped if it is running
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_checksum_verifier_free(
+     libgzipf_checksum_verifier_t **checksum_verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_checksum_verifier_free";
+	int result            = 1;
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checksum_verifier != NULL )
+	{
+		if( ( *checksum_verifier )->thread != NULL )
+		{
+			if( libgzipf_checksum_verifier_stop(
+			     *checksum_verifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop verifier thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *checksum_verifier )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *checksum_verifier )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_close(
+		     ( *checksum_verifier )->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *checksum_verifier )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *checksum_verifier );
+
+		*checksum_verifier = NULL;
+	}
+	return( result );
+}
+
+/* Starts the verifier thread
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_checksum_verifier_start(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_checksum_verifier_start";
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_verifier->thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checksum verifier - thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_create(
+	     &( checksum_verifier->thread ),
+	     NULL,
+	     (int (*)(void *)) &libgzipf_checksum_verifier_thread_function,
+	     (void *) checksum_verifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the verifier thread
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_checksum_verifier_stop(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_checksum_verifier_stop";
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_verifier->thread == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	checksum_verifier->abort = 1;
+
+	if( libcthreads_condition_broadcast(
+	     checksum_verifier->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 checksum_verifier->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_join(
+	     &( checksum_verifier->thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the number of members available for verification
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_checksum_verifier_set_number_of_members(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     int number_of_members,
+     uint8_t end_of_input,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_checksum_verifier_set_number_of_members";
+	int result            = 1;
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_members < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of members value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_members > checksum_verifier->number_of_members )
+	{
+		checksum_verifier->number_of_members = number_of_members;
+	}
+	if( end_of_input != 0 )
+	{
+		checksum_verifier->end_of_input = 1;
+	}
+	if( libcthreads_condition_broadcast(
+	     checksum_verifier->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits until the members available for verification have been verified
+ * or the verifier thread has stopped
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_checksum_verifier_wait(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_checksum_verifier_wait";
+	int result            = 1;
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( checksum_verifier->thread != NULL )
+	    && ( checksum_verifier->abort == 0 )
+	    && ( checksum_verifier->number_of_verified_members < checksum_verifier->number_of_members ) )
+	{
+		if( libcthreads_condition_wait(
+		     checksum_verifier->condition,
+		     checksum_verifier->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if the verifier found a checksum mismatch
+ * Returns 1 if a checksum mismatch was found, 0 if not or -1 on error
+ */
+int libgzipf_checksum_verifier_is_corrupted(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_checksum_verifier_is_corrupted";
+	int result            = 0;
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	result = (int) checksum_verifier->is_corrupted;
+
+	if( libcthreads_mutex_release(
+	     checksum_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Verifies the checksum of a member
+ * The segments of the member are decompressed and the CRC-32 of their
+ * uncompressed data is compared with the checksum stored in the member footer
+ * Returns 1 if the checksum matches or the member cannot be verified, 0 if not or -1 on error
+ */
+int libgzipf_checksum_verifier_verify_member(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     int member_index,
+     libcerror_error_t **error )
+{
+	libgzipf_compressed_segment_t *compressed_segment = NULL;
+	libgzipf_member_descriptor_t *member_descriptor   = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
+	static char *function                             = "libgzipf_checksum_verifier_verify_member";
+	size64_t element_data_size                        = 0;
+	off64_t element_data_offset                       = 0;
+	uint32_t calculated_checksum                      = 0;
+	uint32_t stored_checksum                          = 0;
+	uint8_t abort                                     = 0;
+	uint8_t decompression_error                       = 0;
+	int first_segment_index                           = 0;
+	int number_of_segments                            = 0;
+	int segment_index                                 = 0;
+
+	if( checksum_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     checksum_verifier->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     checksum_verifier->member_descriptors_array,
+	     member_index,
+	     (intptr_t **) &member_descriptor,
+	     error ) == 1 )
+	{
+		first_segment_index = member_descriptor->first_segment_descriptor_index;
+		number_of_segments  = member_descriptor->number_of_segment_descriptors;
+		stored_checksum     = member_descriptor->stored_checksum;
+		decompression_error = member_descriptor->decompression_error;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve member descriptor: %d.",
+		 function,
+		 member_index );
+
+		member_descriptor = NULL;
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     checksum_verifier->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_descriptor == NULL )
+	{
+		return( -1 );
+	}
+	/* A member with a decompression error has no footer to verify
+	 */
+	if( decompression_error != 0 )
+	{
+		return( 1 );
+	}
+	for( segment_index = first_segment_index;
+	     segment_index < ( first_segment_index + number_of_segments );
+	     segment_index++ )
+	{
+		if( libcthreads_mutex_grab(
+		     checksum_verifier->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		abort = checksum_verifier->abort;
+
+		if( libcthreads_mutex_release(
+		     checksum_verifier->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( abort != 0 )
+		{
+			return( 1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_read(
+		     checksum_verifier->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     checksum_verifier->segment_descriptors_array,
+		     segment_index,
+		     (intptr_t **) &segment_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment descriptor: %d.",
+			 function,
+			 segment_index );
+
+			segment_descriptor = NULL;
+		}
+		if( libcthreads_read_write_lock_release_for_read(
+		     checksum_verifier->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+		if( segment_descriptor == NULL )
+		{
+			goto on_error;
+		}
+		/* The segment descriptors are not changed after they were appended
+		 */
+		if( segment_descriptor->uncompressed_data_size == 0 )
+		{
+			continue;
+		}
+		if( segment_descriptor->is_stored != 0 )
+		{
+			element_data_offset = segment_descriptor->stored_data_offset;
+			element_data_size   = (size64_t) segment_descriptor->uncompressed_data_size;
+		}
+		else
+		{
+			element_data_offset = segment_descriptor->compressed_data_offset;
+			element_data_size   = (size64_t) segment_descriptor->compressed_data_size;
+		}
+		if( libgzipf_compressed_segment_initialize(
+		     &compressed_segment,
+		     element_data_size,
+		     (size64_t) segment_descriptor->uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed segment.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_compressed_segment_read_file_io_handle(
+		     compressed_segment,
+		     segment_descriptor,
+		     checksum_verifier->file_io_handle,
+		     element_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( libgzipf_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     compressed_segment->uncompressed_data,
+		     compressed_segment->uncompressed_data_size,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_compressed_segment_free(
+		     &compressed_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed segment.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( calculated_checksum != stored_checksum )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in CRC-32 checksum of member: %d ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 member_index,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_segment != NULL )
+	{
+		libgzipf_compressed_segment_free(
+		 &compressed_segment,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The verifier thread function
+ * A member that cannot be verified, for example due to a read error, is considered corrupted
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_checksum_verifier_thread_function(
+     libgzipf_checksum_verifier_t *checksum_verifier )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libgzipf_checksum_verifier_thread_function";
+	int member_index         = 0;
+	int result               = 0;
+
+	if( checksum_verifier == NULL )
+	{
+		return( -1 );
+	}
+	while( result != -1 )
+	{
+		if( libcthreads_mutex_grab(
+		     checksum_verifier->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		while( ( checksum_verifier->abort == 0 )
+		    && ( checksum_verifier->end_of_input == 0 )
+		    && ( checksum_verifier->number_of_verified_members >= checksum_verifier->number_of_members ) )
+		{
+			if( libcthreads_condition_wait(
+			     checksum_verifier->condition,
+			     checksum_verifier->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 checksum_verifier->mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		if( ( checksum_verifier->abort != 0 )
+		 || ( checksum_verifier->number_of_verified_members >= checksum_verifier->number_of_members ) )
+		{
+			libcthreads_mutex_release(
+			 checksum_verifier->mutex,
+			 NULL );
+
+			break;
+		}
+		member_index = checksum_verifier->number_of_verified_members;
+
+		if( libcthreads_mutex_release(
+		     checksum_verifier->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		result = libgzipf_checksum_verifier_verify_member(
+		          checksum_verifier,
+		          member_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify member: %d.",
+			 function,
+			 member_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     checksum_verifier->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			checksum_verifier->is_corrupted = 1;
+		}
+		checksum_verifier->number_of_verified_members += 1;
+
+		/* Stop verifying after an error
+		 */
+		if( result == -1 )
+		{
+			checksum_verifier->abort = 1;
+		}
+		libcthreads_condition_broadcast(
+		 checksum_verifier->condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 checksum_verifier->mutex,
+		 NULL );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT ) */
+
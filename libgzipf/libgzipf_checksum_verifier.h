@@ -0,0 +1,141 @@
+/*
+ * Checksum verifier functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_CHECKSUM_VERIFIER_H )
+#define _LIBGZIPF_CHECKSUM_VERIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcdata.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+
+typedef struct libgzipf_checksum_verifier libgzipf_checksum_verifier_t;
+
+struct libgzipf_checksum_verifier
+{
+	/* The member descriptors array, which is owned by the file
+	 */
+	libcdata_array_t *member_descriptors_array;
+
+	/* The segment descriptors array, which is owned by the file
+	 */
+	libcdata_array_t *segment_descriptors_array;
+
+	/* The read/write lock of the file, which protects the arrays
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The file IO handle used by the verifier thread
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The verifier thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The mutex, which protects the values below
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, which is broadcasted when the values below change
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The number of members available for verification
+	 */
+	int number_of_members;
+
+	/* The number of members verified
+	 */
+	int number_of_verified_members;
+
+	/* Value to indicate no more members will become available
+	 */
+	uint8_t end_of_input;
+
+	/* Value to indicate the verifier thread should stop
+	 */
+	uint8_t abort;
+
+	/* Value to indicate a checksum mismatch was found
+	 */
+	uint8_t is_corrupted;
+};
+
+int libgzipf_checksum_verifier_initialize(
+     libgzipf_checksum_verifier_t **checksum_verifier,
+     libcdata_array_t *member_descriptors_array,
+     libcdata_array_t *segment_descriptors_array,
+     libcthreads_read_write_lock_t *read_write_lock,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_free(
+     libgzipf_checksum_verifier_t **checksum_verifier,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_start(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_stop(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_set_number_of_members(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     int number_of_members,
+     uint8_t end_of_input,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_wait(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_is_corrupted(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_verify_member(
+     libgzipf_checksum_verifier_t *checksum_verifier,
+     int member_index,
+     libcerror_error_t **error );
+
+int libgzipf_checksum_verifier_thread_function(
+     libgzipf_checksum_verifier_t *checksum_verifier );
+
+#endif /* defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_CHECKSUM_VERIFIER_H ) */
+
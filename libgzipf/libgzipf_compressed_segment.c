@@ -23,13 +23,10 @@
 #include <memory.h>
 #include <types.h>
 
-#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
-#include <zlib.h>
-#endif
-
+#include "libgzipf_checksum.h"
 #include "libgzipf_compressed_segment.h"
+#include "libgzipf_decoder.h"
 #include "libgzipf_definitions.h"
-#include "libgzipf_deflate.h"
 #include "libgzipf_libbfio.h"
 #include "libgzipf_libcdata.h"
 #include "libgzipf_libcerror.h"
@@ -40,6 +37,8 @@
 
 /* Creates compressed segment
  * Make sure the value compressed_segment is referencing, is set to NULL
+ * A compressed segment without compressed data holds uncompressed data
+ * that was decoded while the file was indexed
  * Returns 1 if successful or -1 on error
  */
 int libgzipf_compressed_segment_initialize(
@@ -72,8 +71,7 @@ int libgzipf_compressed_segment_initialize(
 
 		return( -1 );
 	}
-	if( ( compressed_data_size == 0 )
-	 || ( compressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( compressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
 		 error,
@@ -129,21 +127,24 @@ int libgzipf_compressed_segment_initialize(
 
 		return( -1 );
 	}
-	( *compressed_segment )->compressed_data = (uint8_t *) memory_allocate(
-	                                                        sizeof( uint8_t ) * (size_t) compressed_data_size );
-
-	if( ( *compressed_segment )->compressed_data == NULL )
+	if( compressed_data_size > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data.",
-		 function );
+		( *compressed_segment )->compressed_data = (uint8_t *) memory_allocate(
+		                                                        sizeof( uint8_t ) * (size_t) compressed_data_size );
 
-		goto on_error;
+		if( ( *compressed_segment )->compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		( *compressed_segment )->compressed_data_size = compressed_data_size;
 	}
-	( *compressed_segment )->compressed_data_size = compressed_data_size;
 
 	( *compressed_segment )->uncompressed_data = (uint8_t *) memory_allocate(
 	                                                          sizeof( uint8_t ) * (size_t) uncompressed_data_size );
@@ -202,6 +203,22 @@ int libgzipf_compressed_segment_free(
 	}
 	if( *compressed_segment != NULL )
 	{
+		if( ( *compressed_segment )->decoder != NULL )
+		{
+			if( libgzipf_decoder_free(
+			     &( ( *compressed_segment )->decoder ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoder.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *compressed_segment )->uncompressed_data != NULL )
 		{
 			if( memory_set(
@@ -248,34 +265,23 @@ int libgzipf_compressed_segment_free(
 	return( result );
 }
 
-/* Reads the compressed segment
+/* Starts decoding the compressed segment
+ * The uncompressed data is decoded on demand by libgzipf_compressed_segment_decode
  * Returns 1 if successful or -1 on error
  */
-int libgzipf_compressed_segment_read_data(
+int libgzipf_compressed_segment_start_decoding(
      libgzipf_compressed_segment_t *compressed_segment,
      libgzipf_segment_descriptor_t *segment_descriptor,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
 {
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-	z_stream zlib_stream;
-
-	size_t data_offset                 = 0;
-	size_t last_compressed_data_size   = 0;
-	size_t safe_compressed_data_size   = 0;
-/* TODO
-	size_t safe_uncompressed_data_size = 0;
-*/
-	uint8_t bit_shift                  = 0;
-	uint8_t decompression_error        = 0;
-	uint8_t is_last_block              = 0;
-#else
-	size_t uncompressed_data_size      = 0;
-#endif
+	uint8_t distance_data[ LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ];
 
-	static char *function              = "libgzipf_compressed_segment_read_data";
-	int result                         = 0;
+	static char *function = "libgzipf_compressed_segment_start_decoding";
+	size_t data_offset    = 0;
+	uint8_t bit_shift     = 0;
+	int result            = 0;
 
 	if( compressed_segment == NULL )
 	{
@@ -321,211 +327,305 @@ int libgzipf_compressed_segment_read_data(
 
 		return( -1 );
 	}
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-	if( compressed_segment->uncompressed_data_size > (size_t) ULONG_MAX )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_size > (size_t) ULONG_MAX )
+	compressed_segment->compressed_data_offset = 0;
+	compressed_segment->decoded_data_size      = 0;
+
+	if( ( compressed_segment->decoder != NULL )
+	 && ( compressed_segment->decoder->decoder_type != segment_descriptor->decoder_type ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid data size value exceeds maximum.",
-		 function );
+		if( libgzipf_decoder_free(
+		     &( compressed_segment->decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoder.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-	if( memory_set(
-	     &zlib_stream,
-	     0,
-	     sizeof( z_stream ) ) == NULL )
+	if( compressed_segment->decoder == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear zlib stream.",
-		 function );
+		if( libgzipf_decoder_initialize(
+		     &( compressed_segment->decoder ),
+		     segment_descriptor->decoder_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decoder.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-#if defined( HAVE_ZLIB_INFLATE_INIT2 ) || defined( ZLIB_DLL )
-	result = inflateInit2(
-	          &zlib_stream,
-	          -15 );
-#else
-	result = _inflateInit2(
-	          &zlib_stream,
-	          -15 );
-#endif
-	if( result != Z_OK )
+	else if( libgzipf_decoder_reset(
+	          compressed_segment->decoder,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize zlib stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	/* A segment that starts in the middle of a byte includes that byte
+	 */
 	if( segment_descriptor->number_of_bits > 0 )
 	{
+		if( data_size < 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			goto on_error;
+		}
 		bit_shift = 8 - segment_descriptor->number_of_bits;
 
-		result = inflatePrime(
-		          &zlib_stream,
-		          (int) segment_descriptor->number_of_bits,
-		          (int) data[ 0 ] >> bit_shift );
+		result = libgzipf_decoder_prime_bits(
+		          compressed_segment->decoder,
+		          segment_descriptor->number_of_bits,
+		          data[ 0 ] >> bit_shift,
+		          error );
 
-		if( result != Z_OK )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set compressed stream bits in zlib stream.",
+			 "%s: unable to set compressed stream bits in decoder.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		data_offset++;
-	}
-	result = inflateSetDictionary(
-	          &zlib_stream,
-	          segment_descriptor->distance_data,
-	          (uInt) segment_descriptor->distance_data_size );
-
-	if( result != Z_OK )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set dictionary of zlib stream.",
-		 function );
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: decoder does not support starting in the middle of a byte.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		data_offset++;
 	}
-	zlib_stream.next_in   = (Bytef *) &( data[ data_offset ] );
-	zlib_stream.avail_in  = (uInt) data_size - data_offset;
-	zlib_stream.next_out  = (Bytef *) compressed_segment->uncompressed_data;
-	zlib_stream.avail_out = (uInt) compressed_segment->uncompressed_data_size;
-
-	while( ( is_last_block == 0 )
-	    && ( decompression_error == 0 ) )
+	if( segment_descriptor->distance_data_size > 0 )
 	{
-		last_compressed_data_size = safe_compressed_data_size;
-
-		safe_compressed_data_size   += (size_t) zlib_stream.avail_in;
-/* TODO
-		safe_uncompressed_data_size += (size_t) zlib_stream.avail_out;
-*/
-
-		result = inflate(
-			  &zlib_stream,
-			  Z_BLOCK );
-
-		safe_compressed_data_size   -= (size_t) zlib_stream.avail_in;
-/* TODO
-		safe_uncompressed_data_size -= (size_t) zlib_stream.avail_out;
-*/
-
-		if( ( result == Z_OK )
-		 || ( result == Z_STREAM_END ) )
+		if( libgzipf_segment_descriptor_get_distance_data(
+		     segment_descriptor,
+		     distance_data,
+		     LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE,
+		     error ) != 1 )
 		{
-			is_last_block = ( result == Z_STREAM_END );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve distance data from segment descriptor.",
+			 function );
+
+			goto on_error;
 		}
-		else if( result == Z_DATA_ERROR )
+		result = libgzipf_decoder_set_dictionary(
+		          compressed_segment->decoder,
+		          distance_data,
+		          segment_descriptor->distance_data_size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to read compressed data: data error.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set dictionary of decoder.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result == Z_BUF_ERROR )
+		else if( result == 0 )
 		{
-			if( safe_compressed_data_size == last_compressed_data_size )
-			{
-				decompression_error = 1;
-			}
-			else
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to read compressed data: no progress possible.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: decoder does not support a preset dictionary.",
+			 function );
 
-				return( -1 );
-			}
+			goto on_error;
 		}
-		else if( result == Z_MEM_ERROR )
+	}
+	if( segment_descriptor->block_state_data_size > 0 )
+	{
+		result = libgzipf_decoder_set_block_state(
+		          compressed_segment->decoder,
+		          segment_descriptor->block_state_data,
+		          segment_descriptor->block_state_data_size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to read compressed data: insufficient memory.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block state of decoder.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else
+		else if( result == 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-			 "%s: zlib returned undefined error: %d.",
-			 function,
-			 result );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: decoder does not support starting in the middle of a block.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	if( inflateEnd(
-	     &zlib_stream ) != Z_OK )
+	compressed_segment->compressed_data_offset = data_offset;
+
+	return( 1 );
+
+on_error:
+	if( compressed_segment->decoder != NULL )
+	{
+		libgzipf_decoder_free(
+		 &( compressed_segment->decoder ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes the compressed segment up to an uncompressed data offset
+ * The data must be the same compressed data the decoding was started with
+ * The uncompressed data is decoded in steps of LIBGZIPF_SEGMENT_DECODE_SIZE
+ * so that small reads do not decode the entire segment
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_compressed_segment_decode(
+     libgzipf_compressed_segment_t *compressed_segment,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function        = "libgzipf_compressed_segment_decode";
+	size_t decode_size           = 0;
+	uint32_t calculated_checksum = 0;
+	int result                   = 0;
+
+	if( compressed_segment == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize zlib stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_segment->uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed segment - missing uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO determine why size is sometimes 1-off
-	if( safe_uncompressed_data_size != compressed_segment->uncompressed_data_size )
+	if( compressed_segment->decoded_data_size > compressed_segment->uncompressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid uncompressed data size value out of bounds (%zd, %zd).",
-		 function, safe_uncompressed_data_size, compressed_segment->uncompressed_data_size );
+		 "%s: invalid compressed segment - decoded data size value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-*/
-	return( 1 );
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset > compressed_segment->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
 
-#else
+		return( -1 );
+	}
+	if( uncompressed_data_offset <= compressed_segment->decoded_data_size )
+	{
+		return( 1 );
+	}
+	if( compressed_segment->decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed segment - missing decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
 	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
@@ -537,53 +637,194 @@ int libgzipf_compressed_segment_read_data(
 
 		return( -1 );
 	}
-	uncompressed_data_size = compressed_segment->uncompressed_data_size;
+	decode_size = uncompressed_data_offset;
 
-	result = libgzipf_deflate_decompress(
+	if( ( decode_size % LIBGZIPF_SEGMENT_DECODE_SIZE ) != 0 )
+	{
+		decode_size += LIBGZIPF_SEGMENT_DECODE_SIZE - ( decode_size % LIBGZIPF_SEGMENT_DECODE_SIZE );
+	}
+	if( decode_size > compressed_segment->uncompressed_data_size )
+	{
+		decode_size = compressed_segment->uncompressed_data_size;
+	}
+	/* The decoder continues where the previous decode stopped,
+	 * in which case the preceding uncompressed data provides the history
+	 */
+	result = libgzipf_decoder_decode(
+	          compressed_segment->decoder,
 	          data,
 	          data_size,
+	          &( compressed_segment->compressed_data_offset ),
 	          compressed_segment->uncompressed_data,
-	          &uncompressed_data_size,
+	          decode_size,
+	          &( compressed_segment->decoded_data_size ),
+	          LIBGZIPF_DECODER_FLAG_FINAL_INPUT,
 	          error );
 
-	if( result != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
 		 "%s: unable to decompress DEFLATE compressed data.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
+		goto on_error;
+	}
+	/* The segment can end before the end of the stream, in which case
+	 * decoding stops when the uncompressed data is full
+	 */
+	if( compressed_segment->decoded_data_size != decode_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( compressed_segment->decoded_data_size < compressed_segment->uncompressed_data_size )
+	{
+		return( 1 );
+	}
+	/* The segment is verified independently of the other segments of the member
+	 * if its checksum was calculated when the segment was read
+	 */
+	if( segment_descriptor->has_checksum != 0 )
+	{
+		if( libgzipf_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     compressed_segment->uncompressed_data,
+		     compressed_segment->uncompressed_data_size,
+		     0,
+		     error ) != 1 )
 		{
-			libcnotify_print_error_backtrace(
-			 *error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
 		}
-#endif
-		libcerror_error_free(
-		 error );
+		if( calculated_checksum != segment_descriptor->checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+			 function,
+			 segment_descriptor->checksum,
+			 calculated_checksum );
 
-		result = 1;
+			goto on_error;
+		}
 	}
-	return( result );
+	/* The decoder is no longer needed once the segment is fully decoded
+	 */
+	if( libgzipf_decoder_free(
+	     &( compressed_segment->decoder ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
 
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
+on_error:
+	/* The decoder state is undefined after an error
+	 */
+	if( compressed_segment->decoder != NULL )
+	{
+		libgzipf_decoder_free(
+		 &( compressed_segment->decoder ),
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the compressed segment
  * Returns 1 if successful or -1 on error
  */
-int libgzipf_compressed_segment_read_file_io_handle(
+int libgzipf_compressed_segment_read_data(
+     libgzipf_compressed_segment_t *compressed_segment,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_compressed_segment_read_data";
+
+	if( compressed_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_compressed_segment_start_decoding(
+	     compressed_segment,
+	     segment_descriptor,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start decoding compressed segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_compressed_segment_decode(
+	     compressed_segment,
+	     segment_descriptor,
+	     data,
+	     data_size,
+	     compressed_segment->uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decode compressed segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the compressed data of the compressed segment and starts decoding it
+ * The data of a stored segment is read as-is
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_compressed_segment_start_file_io_handle(
      libgzipf_compressed_segment_t *compressed_segment,
      libgzipf_segment_descriptor_t *segment_descriptor,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	static char *function = "libgzipf_compressed_segment_read_file_io_handle";
+	static char *function = "libgzipf_compressed_segment_start_file_io_handle";
 	ssize_t read_count    = 0;
 
 	if( compressed_segment == NULL )
@@ -640,6 +881,34 @@ int libgzipf_compressed_segment_read_file_io_handle(
 		 file_offset );
 	}
 #endif
+	/* The data of a stored block is read as-is
+	 */
+	if( segment_descriptor->is_stored != 0 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              compressed_segment->uncompressed_data,
+		              compressed_segment->uncompressed_data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) compressed_segment->uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read stored data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		compressed_segment->decoded_data_size = compressed_segment->uncompressed_data_size;
+
+		return( 1 );
+	}
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              compressed_segment->compressed_data,
@@ -660,18 +929,68 @@ int libgzipf_compressed_segment_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( libgzipf_compressed_segment_read_data(
+	if( libgzipf_compressed_segment_start_decoding(
 	     compressed_segment,
 	     segment_descriptor,
 	     compressed_segment->compressed_data,
-	     (size_t) read_count,
+	     compressed_segment->compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start decoding compressed segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the compressed segment
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_compressed_segment_read_file_io_handle(
+     libgzipf_compressed_segment_t *compressed_segment,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_compressed_segment_read_file_io_handle";
+
+	if( libgzipf_compressed_segment_start_file_io_handle(
+	     compressed_segment,
+	     segment_descriptor,
+	     file_io_handle,
+	     file_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed data.",
+		 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( libgzipf_compressed_segment_decode(
+	     compressed_segment,
+	     segment_descriptor,
+	     compressed_segment->compressed_data,
+	     compressed_segment->compressed_data_size,
+	     compressed_segment->uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decode compressed segment.",
 		 function );
 
 		return( -1 );
@@ -747,7 +1066,9 @@ int libgzipf_compressed_segment_read_element_data(
 
 		goto on_error;
 	}
-	if( libgzipf_compressed_segment_read_file_io_handle(
+	/* The uncompressed data is decoded on demand when the segment is read
+	 */
+	if( libgzipf_compressed_segment_start_file_io_handle(
 	     compressed_segment,
 	     segment_descriptor,
 	     file_io_handle,
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libgzipf_decoder.h"
 #include "libgzipf_libbfio.h"
 #include "libgzipf_libcdata.h"
 #include "libgzipf_libcerror.h"
@@ -54,6 +55,18 @@ struct libgzipf_compressed_segment
 	/* The uncompressed data size
 	 */
 	size_t uncompressed_data_size;
+
+	/* The decoder, which is kept while the segment is partially decoded
+	 */
+	libgzipf_decoder_t *decoder;
+
+	/* The offset of the compressed data that has not been decoded
+	 */
+	size_t compressed_data_offset;
+
+	/* The size of the uncompressed data that has been decoded
+	 */
+	size_t decoded_data_size;
 };
 
 int libgzipf_compressed_segment_initialize(
@@ -66,6 +79,21 @@ int libgzipf_compressed_segment_free(
      libgzipf_compressed_segment_t **compressed_segment,
      libcerror_error_t **error );
 
+int libgzipf_compressed_segment_start_decoding(
+     libgzipf_compressed_segment_t *compressed_segment,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libgzipf_compressed_segment_decode(
+     libgzipf_compressed_segment_t *compressed_segment,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error );
+
 int libgzipf_compressed_segment_read_data(
      libgzipf_compressed_segment_t *compressed_segment,
      libgzipf_segment_descriptor_t *segment_descriptor,
@@ -73,6 +101,13 @@ int libgzipf_compressed_segment_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libgzipf_compressed_segment_start_file_io_handle(
+     libgzipf_compressed_segment_t *compressed_segment,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int libgzipf_compressed_segment_read_file_io_handle(
      libgzipf_compressed_segment_t *compressed_segment,
      libgzipf_segment_descriptor_t *segment_descriptor,
@@ -0,0 +1,180 @@
+/*
+ * CPU feature functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_cpu.h"
+
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
+#if defined( _MSC_VER )
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif /* defined( LIBGZIPF_CPU_HAVE_X86_64 ) */
+
+#if defined( LIBGZIPF_CPU_HAVE_ARM_HWCAP )
+#include <sys/auxv.h>
+
+#if !defined( HWCAP_CRC32 )
+#define HWCAP_CRC32	( 1 << 7 )
+#endif
+
+#endif /* defined( LIBGZIPF_CPU_HAVE_ARM_HWCAP ) */
+
+/* The CPU features of the current CPU, which are determined on first use
+ * libgzipf_file_initialize determines them before any thread is created
+ * so that the threads only read the cached value
+ */
+uint32_t libgzipf_cpu_features = 0;
+
+/* Determines the features of the current CPU
+ * Returns the CPU features
+ */
+uint32_t libgzipf_cpu_determine_features(
+          void )
+{
+	uint32_t features = LIBGZIPF_CPU_FEATURE_DETERMINED;
+
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
+	uint64_t extended_control_register = 0;
+	uint32_t ebx                       = 0;
+	uint32_t ecx                       = 0;
+	uint32_t maximum_leaf              = 0;
+
+#if defined( _MSC_VER )
+	int cpu_information[ 4 ];
+
+	__cpuid(
+	 cpu_information,
+	 0 );
+
+	maximum_leaf = (uint32_t) cpu_information[ 0 ];
+
+	__cpuid(
+	 cpu_information,
+	 1 );
+
+	ecx = (uint32_t) cpu_information[ 2 ];
+#else
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+
+	maximum_leaf = (uint32_t) __get_cpuid_max(
+	                           0,
+	                           NULL );
+
+	if( __get_cpuid(
+	     1,
+	     &eax,
+	     &ebx,
+	     &ecx,
+	     &edx ) == 0 )
+	{
+		ecx = 0;
+	}
+#endif
+	/* ECX bit 9 indicates SSSE3 and bit 1 PCLMULQDQ support
+	 */
+	if( ( ecx & 0x00000200UL ) != 0 )
+	{
+		features |= LIBGZIPF_CPU_FEATURE_SSSE3;
+	}
+	if( ( ecx & 0x00000002UL ) != 0 )
+	{
+		features |= LIBGZIPF_CPU_FEATURE_PCLMULQDQ;
+	}
+	/* AVX2 requires that the operating system saves the YMM registers,
+	 * which is indicated by OSXSAVE (ECX bit 27) and XCR0 bits 1 and 2
+	 */
+	if( ( maximum_leaf >= 7 )
+	 && ( ( ecx & 0x18000000UL ) == 0x18000000UL ) )
+	{
+#if defined( _MSC_VER )
+		extended_control_register = (uint64_t) _xgetbv(
+		                                        0 );
+
+		__cpuidex(
+		 cpu_information,
+		 7,
+		 0 );
+
+		ebx = (uint32_t) cpu_information[ 1 ];
+#else
+		__asm__ __volatile__ (
+		 "xgetbv"
+		 : "=a" ( eax ), "=d" ( edx )
+		 : "c" ( 0 ) );
+
+		extended_control_register = ( (uint64_t) edx << 32 ) | eax;
+
+		__cpuid_count(
+		 7,
+		 0,
+		 eax,
+		 ebx,
+		 ecx,
+		 edx );
+#endif
+		/* EBX bit 5 indicates AVX2 support
+		 */
+		if( ( ( extended_control_register & 0x00000006UL ) == 0x00000006UL )
+		 && ( ( ebx & 0x00000020UL ) != 0 ) )
+		{
+			features |= LIBGZIPF_CPU_FEATURE_AVX2;
+		}
+	}
+#endif /* defined( LIBGZIPF_CPU_HAVE_X86_64 ) */
+
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+	features |= LIBGZIPF_CPU_FEATURE_NEON;
+#endif
+
+#if defined( LIBGZIPF_CPU_HAVE_ARM_HWCAP )
+	/* HWCAP_CRC32 indicates support for the ARMv8 CRC32 instructions
+	 */
+	if( ( getauxval( AT_HWCAP ) & HWCAP_CRC32 ) != 0 )
+	{
+		features |= LIBGZIPF_CPU_FEATURE_ARM_CRC32;
+	}
+#elif defined( LIBGZIPF_CPU_HAVE_ARM_CRC32 )
+	features |= LIBGZIPF_CPU_FEATURE_ARM_CRC32;
+#endif
+
+	return( features );
+}
+
+/* Retrieves the features of the current CPU
+ * The features are determined once and cached, this is not multi-thread safe
+ * on first use
+ * Returns the CPU features
+ */
+uint32_t libgzipf_cpu_get_features(
+          void )
+{
+	if( ( libgzipf_cpu_features & LIBGZIPF_CPU_FEATURE_DETERMINED ) == 0 )
+	{
+		libgzipf_cpu_features = libgzipf_cpu_determine_features();
+	}
+	return( libgzipf_cpu_features );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * CPU feature functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_CPU_H )
+#define _LIBGZIPF_CPU_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The x86-64 instruction set extensions are determined at run-time
+ * and enabled per function
+ */
+#if defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define LIBGZIPF_CPU_HAVE_X86_64
+#define LIBGZIPF_CPU_TARGET_AVX2		__attribute__ ((target( "avx2" )))
+#define LIBGZIPF_CPU_TARGET_PCLMULQDQ		__attribute__ ((target( "pclmul,sse2" )))
+#define LIBGZIPF_CPU_TARGET_SSSE3		__attribute__ ((target( "ssse3" )))
+
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+#define LIBGZIPF_CPU_HAVE_X86_64
+#define LIBGZIPF_CPU_TARGET_AVX2
+#define LIBGZIPF_CPU_TARGET_PCLMULQDQ
+#define LIBGZIPF_CPU_TARGET_SSSE3
+
+#endif
+
+/* NEON is part of the AArch64 base instruction set
+ */
+#if defined( __aarch64__ ) || defined( _M_ARM64 )
+#define LIBGZIPF_CPU_HAVE_NEON
+
+#endif
+
+/* The ARMv8 CRC32 instructions are used when the compiler targets them,
+ * otherwise their support is determined at run-time using the auxiliary vector
+ * and they are enabled per function
+ */
+#if defined( __aarch64__ ) && defined( __ARM_FEATURE_CRC32 )
+#define LIBGZIPF_CPU_HAVE_ARM_CRC32
+#define LIBGZIPF_CPU_TARGET_ARM_CRC32
+
+#elif defined( __aarch64__ ) && defined( HAVE_SYS_AUXV_H ) && defined( HAVE_GETAUXVAL ) && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 10 ) ) )
+#define LIBGZIPF_CPU_HAVE_ARM_CRC32
+#define LIBGZIPF_CPU_HAVE_ARM_HWCAP
+
+#if defined( __clang__ )
+#define LIBGZIPF_CPU_TARGET_ARM_CRC32		__attribute__ ((target( "crc" )))
+#else
+#define LIBGZIPF_CPU_TARGET_ARM_CRC32		__attribute__ ((target( "+crc" )))
+#endif
+
+#endif
+
+/* The CPU features
+ */
+enum LIBGZIPF_CPU_FEATURES
+{
+	LIBGZIPF_CPU_FEATURE_SSSE3		= 0x0001,
+	LIBGZIPF_CPU_FEATURE_PCLMULQDQ		= 0x0002,
+	LIBGZIPF_CPU_FEATURE_AVX2		= 0x0004,
+
+	LIBGZIPF_CPU_FEATURE_NEON		= 0x0100,
+	LIBGZIPF_CPU_FEATURE_ARM_CRC32		= 0x0200,
+
+	/* The CPU features have been determined
+	 */
+	LIBGZIPF_CPU_FEATURE_DETERMINED		= 0x8000
+};
+
+extern uint32_t libgzipf_cpu_features;
+
+uint32_t libgzipf_cpu_determine_features(
+          void );
+
+uint32_t libgzipf_cpu_get_features(
+          void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_CPU_H ) */
+
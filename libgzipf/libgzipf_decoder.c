@@ -0,0 +1,693 @@
+/*
+ * Decoder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_decoder.h"
+#include "libgzipf_definitions.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_native_decoder.h"
+#include "libgzipf_zlib_decoder.h"
+
+/* Creates a decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_decoder_initialize(
+     libgzipf_decoder_t **decoder,
+     int decoder_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_initialize";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder_type == LIBGZIPF_DECODER_DEFAULT )
+	{
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+		decoder_type = LIBGZIPF_DECODER_ZLIB;
+#else
+		decoder_type = LIBGZIPF_DECODER_NATIVE;
+#endif
+	}
+	if( libgzipf_decoder_is_supported(
+	     decoder_type ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported decoder type: %d.",
+		 function,
+		 decoder_type );
+
+		return( -1 );
+	}
+	*decoder = memory_allocate_structure(
+	            libgzipf_decoder_t );
+
+	if( *decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decoder,
+	     0,
+	     sizeof( libgzipf_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder.",
+		 function );
+
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+
+		return( -1 );
+	}
+	if( decoder_type == LIBGZIPF_DECODER_NATIVE )
+	{
+		if( libgzipf_native_decoder_initialize(
+		     (libgzipf_native_decoder_t **) &( ( *decoder )->state ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create native decoder.",
+			 function );
+
+			goto on_error;
+		}
+		( *decoder )->uses_history                = 1;
+		( *decoder )->supports_block_state        = 1;
+		( *decoder )->free_state                  = (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_native_decoder_free;
+		( *decoder )->reset                       = (int (*)(intptr_t *, libcerror_error_t **)) &libgzipf_native_decoder_reset;
+		( *decoder )->prime_bits                  = (int (*)(intptr_t *, uint8_t, uint8_t, libcerror_error_t **)) &libgzipf_native_decoder_prime_bits;
+		( *decoder )->set_dictionary              = (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libgzipf_native_decoder_set_dictionary;
+		( *decoder )->decode                      = (int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint8_t *, size_t, size_t *, uint8_t, libcerror_error_t **)) &libgzipf_native_decoder_decode;
+		( *decoder )->get_dictionary              = (int (*)(intptr_t *, uint8_t *, size_t, size_t *, libcerror_error_t **)) &libgzipf_native_decoder_get_dictionary;
+		( *decoder )->get_number_of_bits          = (int (*)(intptr_t *, uint8_t *, libcerror_error_t **)) &libgzipf_native_decoder_get_number_of_bits;
+		( *decoder )->is_end_of_stream            = (int (*)(intptr_t *, libcerror_error_t **)) &libgzipf_native_decoder_is_end_of_stream;
+		( *decoder )->get_block_state             = (int (*)(intptr_t *, uint8_t *, size_t, size_t *, libcerror_error_t **)) &libgzipf_native_decoder_get_block_state;
+		( *decoder )->set_block_state             = (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libgzipf_native_decoder_set_block_state;
+		( *decoder )->get_referenced_history_size = (int (*)(intptr_t *, size_t *, libcerror_error_t **)) &libgzipf_native_decoder_get_referenced_history_size;
+	}
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+	else if( decoder_type == LIBGZIPF_DECODER_ZLIB )
+	{
+		if( libgzipf_zlib_decoder_initialize(
+		     (libgzipf_zlib_decoder_t **) &( ( *decoder )->state ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create zlib decoder.",
+			 function );
+
+			goto on_error;
+		}
+		( *decoder )->uses_history         = 0;
+		( *decoder )->supports_block_state = 0;
+		( *decoder )->free_state           = (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_zlib_decoder_free;
+		( *decoder )->reset                = (int (*)(intptr_t *, libcerror_error_t **)) &libgzipf_zlib_decoder_reset;
+		( *decoder )->prime_bits           = (int (*)(intptr_t *, uint8_t, uint8_t, libcerror_error_t **)) &libgzipf_zlib_decoder_prime_bits;
+		( *decoder )->set_dictionary       = (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libgzipf_zlib_decoder_set_dictionary;
+		( *decoder )->decode               = (int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint8_t *, size_t, size_t *, uint8_t, libcerror_error_t **)) &libgzipf_zlib_decoder_decode;
+		( *decoder )->get_dictionary       = (int (*)(intptr_t *, uint8_t *, size_t, size_t *, libcerror_error_t **)) &libgzipf_zlib_decoder_get_dictionary;
+		( *decoder )->get_number_of_bits   = (int (*)(intptr_t *, uint8_t *, libcerror_error_t **)) &libgzipf_zlib_decoder_get_number_of_bits;
+		( *decoder )->is_end_of_stream     = (int (*)(intptr_t *, libcerror_error_t **)) &libgzipf_zlib_decoder_is_end_of_stream;
+	}
+#endif
+	( *decoder )->decoder_type = decoder_type;
+
+	return( 1 );
+
+on_error:
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_decoder_free(
+     libgzipf_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_free";
+	int result            = 1;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		if( ( *decoder )->state != NULL )
+		{
+			if( ( *decoder )->free_state(
+			     &( ( *decoder )->state ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoder state.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( result );
+}
+
+/* Determines if a decoder type is supported
+ * Returns 1 if supported or 0 if not
+ */
+int libgzipf_decoder_is_supported(
+     int decoder_type )
+{
+	switch( decoder_type )
+	{
+		case LIBGZIPF_DECODER_DEFAULT:
+		case LIBGZIPF_DECODER_NATIVE:
+			return( 1 );
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+		case LIBGZIPF_DECODER_ZLIB:
+			return( 1 );
+#endif
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Resets a decoder to the start of a new stream
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_decoder_reset(
+     libgzipf_decoder_t *decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_reset";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder->reset(
+	     decoder->state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the bits of a partially consumed byte to continue decoding from
+ * Returns 1 if successful, 0 if not supported by the decoder or -1 on error
+ */
+int libgzipf_decoder_prime_bits(
+     libgzipf_decoder_t *decoder,
+     uint8_t number_of_bits,
+     uint8_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_prime_bits";
+	int result            = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	result = decoder->prime_bits(
+	          decoder->state,
+	          number_of_bits,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to prime decoder bits.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the preceding uncompressed data used for distance codes
+ * Returns 1 if successful, 0 if not supported by the decoder or -1 on error
+ */
+int libgzipf_decoder_set_dictionary(
+     libgzipf_decoder_t *decoder,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_set_dictionary";
+	int result            = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	result = decoder->set_dictionary(
+	          decoder->state,
+	          dictionary_data,
+	          dictionary_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set decoder dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Decodes compressed data
+ * The compressed data offset is advanced by the number of compressed bytes consumed,
+ * where the unused bits of the last consumed byte are retained by the decoder
+ * Returns 1 if the end of the stream, or the end of a block when requested, was reached,
+ * 0 if more compressed data or uncompressed data space is needed or -1 on error
+ */
+int libgzipf_decoder_decode(
+     libgzipf_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_decode";
+	int result            = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	result = decoder->decode(
+	          decoder->state,
+	          compressed_data,
+	          compressed_data_size,
+	          compressed_data_offset,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          uncompressed_data_offset,
+	          flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decode compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the preceding uncompressed data used for distance codes
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_decoder_get_dictionary(
+     libgzipf_decoder_t *decoder,
+     uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_get_dictionary";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder->get_dictionary(
+	     decoder->state,
+	     dictionary_data,
+	     dictionary_data_size,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoder dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of unused bits of the last consumed byte
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_decoder_get_number_of_bits(
+     libgzipf_decoder_t *decoder,
+     uint8_t *number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_get_number_of_bits";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder->get_number_of_bits(
+	     decoder->state,
+	     number_of_bits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoder number of bits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the end of the stream was reached
+ * Returns 1 if the end of the stream was reached, 0 if not or -1 on error
+ */
+int libgzipf_decoder_is_end_of_stream(
+     libgzipf_decoder_t *decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_is_end_of_stream";
+	int result            = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	result = decoder->is_end_of_stream(
+	          decoder->state,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if decoder reached end of stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the state of the current block
+ * Returns 1 if successful, 0 if the decoder is not in the middle of a block where
+ * decoding can be resumed or does not support resuming in a block or -1 on error
+ */
+int libgzipf_decoder_get_block_state(
+     libgzipf_decoder_t *decoder,
+     uint8_t *block_state_data,
+     size_t block_state_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_get_block_state";
+	int result            = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder->get_block_state == NULL )
+	{
+		return( 0 );
+	}
+	result = decoder->get_block_state(
+	          decoder->state,
+	          block_state_data,
+	          block_state_data_size,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoder block state.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the state of a block to resume decoding from
+ * Returns 1 if successful, 0 if the decoder does not support resuming in a block or -1 on error
+ */
+int libgzipf_decoder_set_block_state(
+     libgzipf_decoder_t *decoder,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_set_block_state";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder->set_block_state == NULL )
+	{
+		return( 0 );
+	}
+	if( decoder->set_block_state(
+	     decoder->state,
+	     block_state_data,
+	     block_state_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set decoder block state.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the history referred to by distance codes during the last decode
+ * Returns 1 if successful, 0 if the decoder cannot determine the referenced history or -1 on error
+ */
+int libgzipf_decoder_get_referenced_history_size(
+     libgzipf_decoder_t *decoder,
+     size_t *history_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_decoder_get_referenced_history_size";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder->get_referenced_history_size == NULL )
+	{
+		return( 0 );
+	}
+	if( decoder->get_referenced_history_size(
+	     decoder->state,
+	     history_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoder referenced history size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,241 @@
+/*
+ * Decoder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_DECODER_H )
+#define _LIBGZIPF_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The decoder decode flags
+ */
+enum LIBGZIPF_DECODER_FLAGS
+{
+	/* No more compressed data follows the compressed data provided
+	 */
+	LIBGZIPF_DECODER_FLAG_FINAL_INPUT			= 0x01,
+
+	/* Stop decoding at the end of every block
+	 */
+	LIBGZIPF_DECODER_FLAG_STOP_AT_END_OF_BLOCK		= 0x02,
+
+	/* Stop decoding before a match that does not fit in the uncompressed data
+	 */
+	LIBGZIPF_DECODER_FLAG_STOP_BEFORE_PARTIAL_MATCH		= 0x04
+};
+
+typedef struct libgzipf_decoder libgzipf_decoder_t;
+
+struct libgzipf_decoder
+{
+	/* The decoder type
+	 */
+	int decoder_type;
+
+	/* Value to indicate the decoder uses the uncompressed data before
+	 * the uncompressed data offset as history for distance codes
+	 */
+	uint8_t uses_history;
+
+	/* Value to indicate the decoder can resume decoding in the middle
+	 * of a Huffman compressed block
+	 */
+	uint8_t supports_block_state;
+
+	/* The decoder state
+	 */
+	intptr_t *state;
+
+	/* The free state function
+	 */
+	int (*free_state)(
+	       intptr_t **state,
+	       libcerror_error_t **error );
+
+	/* The reset function
+	 */
+	int (*reset)(
+	       intptr_t *state,
+	       libcerror_error_t **error );
+
+	/* The prime bits function
+	 */
+	int (*prime_bits)(
+	       intptr_t *state,
+	       uint8_t number_of_bits,
+	       uint8_t value,
+	       libcerror_error_t **error );
+
+	/* The set dictionary function
+	 */
+	int (*set_dictionary)(
+	       intptr_t *state,
+	       const uint8_t *dictionary_data,
+	       size_t dictionary_data_size,
+	       libcerror_error_t **error );
+
+	/* The decode function
+	 */
+	int (*decode)(
+	       intptr_t *state,
+	       const uint8_t *compressed_data,
+	       size_t compressed_data_size,
+	       size_t *compressed_data_offset,
+	       uint8_t *uncompressed_data,
+	       size_t uncompressed_data_size,
+	       size_t *uncompressed_data_offset,
+	       uint8_t flags,
+	       libcerror_error_t **error );
+
+	/* The get dictionary function
+	 */
+	int (*get_dictionary)(
+	       intptr_t *state,
+	       uint8_t *dictionary_data,
+	       size_t dictionary_data_size,
+	       size_t *data_size,
+	       libcerror_error_t **error );
+
+	/* The get number of bits function
+	 */
+	int (*get_number_of_bits)(
+	       intptr_t *state,
+	       uint8_t *number_of_bits,
+	       libcerror_error_t **error );
+
+	/* The is end of stream function
+	 */
+	int (*is_end_of_stream)(
+	       intptr_t *state,
+	       libcerror_error_t **error );
+
+	/* The get block state function, which is NULL if the decoder
+	 * cannot resume decoding in the middle of a block
+	 */
+	int (*get_block_state)(
+	       intptr_t *state,
+	       uint8_t *block_state_data,
+	       size_t block_state_data_size,
+	       size_t *data_size,
+	       libcerror_error_t **error );
+
+	/* The set block state function
+	 */
+	int (*set_block_state)(
+	       intptr_t *state,
+	       const uint8_t *block_state_data,
+	       size_t block_state_data_size,
+	       libcerror_error_t **error );
+
+	/* The get referenced history size function, which is NULL if the decoder
+	 * cannot determine which part of the history distance codes refer to
+	 */
+	int (*get_referenced_history_size)(
+	       intptr_t *state,
+	       size_t *history_size,
+	       libcerror_error_t **error );
+};
+
+int libgzipf_decoder_initialize(
+     libgzipf_decoder_t **decoder,
+     int decoder_type,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_free(
+     libgzipf_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_is_supported(
+     int decoder_type );
+
+int libgzipf_decoder_reset(
+     libgzipf_decoder_t *decoder,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_prime_bits(
+     libgzipf_decoder_t *decoder,
+     uint8_t number_of_bits,
+     uint8_t value,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_set_dictionary(
+     libgzipf_decoder_t *decoder,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_decode(
+     libgzipf_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_get_dictionary(
+     libgzipf_decoder_t *decoder,
+     uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_get_number_of_bits(
+     libgzipf_decoder_t *decoder,
+     uint8_t *number_of_bits,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_is_end_of_stream(
+     libgzipf_decoder_t *decoder,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_get_block_state(
+     libgzipf_decoder_t *decoder,
+     uint8_t *block_state_data,
+     size_t block_state_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_set_block_state(
+     libgzipf_decoder_t *decoder,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_decoder_get_referenced_history_size(
+     libgzipf_decoder_t *decoder,
+     size_t *history_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_DECODER_H ) */
+
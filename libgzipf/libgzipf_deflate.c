@@ -25,11 +25,21 @@
 #include <types.h>
 
 #include "libgzipf_bit_stream.h"
+#include "libgzipf_cpu.h"
+#include "libgzipf_definitions.h"
 #include "libgzipf_deflate.h"
 #include "libgzipf_huffman_tree.h"
 #include "libgzipf_libcerror.h"
 #include "libgzipf_libcnotify.h"
 
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+#include <arm_neon.h>
+#endif
+
 const uint8_t libgzipf_deflate_code_sizes_sequence[ 19 ]  = {
 	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
         14, 1, 15 };
@@ -51,28 +61,369 @@ const uint16_t libgzipf_deflate_distance_codes_number_of_extra_bits[ 30 ] = {
 	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
 	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
 
-/* Initializes the dynamic Huffman trees
+/* The Adler-32 kernel, which is determined on first use
+ */
+int libgzipf_deflate_adler32_kernel = LIBGZIPF_DEFLATE_ADLER32_KERNEL_UNDETERMINED;
+
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+
+/* The weights of the 32 byte columns used by the NEON Adler-32 kernel
+ */
+static const uint16_t libgzipf_deflate_adler32_neon_weights[ 32 ] = {
+	32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+	16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+#endif
+
+/* The smallest multiple of a match distance of 1 - 7 that is at least 8
+ */
+const uint8_t libgzipf_deflate_match_pattern_distances[ 8 ] = {
+	0, 8, 8, 9, 8, 10, 12, 14 };
+
+/* The lookup table of the fixed Huffman literal and length codes
+ * It is indexed by the next 9 bits of the bit stream and every entry
+ * contains the symbol in bits 0 - 15 and the code size in bits 16 - 23
+ */
+const uint32_t libgzipf_deflate_fixed_huffman_literals_lookup_table[ 512 ] = {
+	0x00070100UL, 0x00080050UL, 0x00080010UL, 0x00080118UL, 0x00070110UL, 0x00080070UL,
+	0x00080030UL, 0x000900c0UL, 0x00070108UL, 0x00080060UL, 0x00080020UL, 0x000900a0UL,
+	0x00080000UL, 0x00080080UL, 0x00080040UL, 0x000900e0UL, 0x00070104UL, 0x00080058UL,
+	0x00080018UL, 0x00090090UL, 0x00070114UL, 0x00080078UL, 0x00080038UL, 0x000900d0UL,
+	0x0007010cUL, 0x00080068UL, 0x00080028UL, 0x000900b0UL, 0x00080008UL, 0x00080088UL,
+	0x00080048UL, 0x000900f0UL, 0x00070102UL, 0x00080054UL, 0x00080014UL, 0x0008011cUL,
+	0x00070112UL, 0x00080074UL, 0x00080034UL, 0x000900c8UL, 0x0007010aUL, 0x00080064UL,
+	0x00080024UL, 0x000900a8UL, 0x00080004UL, 0x00080084UL, 0x00080044UL, 0x000900e8UL,
+	0x00070106UL, 0x0008005cUL, 0x0008001cUL, 0x00090098UL, 0x00070116UL, 0x0008007cUL,
+	0x0008003cUL, 0x000900d8UL, 0x0007010eUL, 0x0008006cUL, 0x0008002cUL, 0x000900b8UL,
+	0x0008000cUL, 0x0008008cUL, 0x0008004cUL, 0x000900f8UL, 0x00070101UL, 0x00080052UL,
+	0x00080012UL, 0x0008011aUL, 0x00070111UL, 0x00080072UL, 0x00080032UL, 0x000900c4UL,
+	0x00070109UL, 0x00080062UL, 0x00080022UL, 0x000900a4UL, 0x00080002UL, 0x00080082UL,
+	0x00080042UL, 0x000900e4UL, 0x00070105UL, 0x0008005aUL, 0x0008001aUL, 0x00090094UL,
+	0x00070115UL, 0x0008007aUL, 0x0008003aUL, 0x000900d4UL, 0x0007010dUL, 0x0008006aUL,
+	0x0008002aUL, 0x000900b4UL, 0x0008000aUL, 0x0008008aUL, 0x0008004aUL, 0x000900f4UL,
+	0x00070103UL, 0x00080056UL, 0x00080016UL, 0x0008011eUL, 0x00070113UL, 0x00080076UL,
+	0x00080036UL, 0x000900ccUL, 0x0007010bUL, 0x00080066UL, 0x00080026UL, 0x000900acUL,
+	0x00080006UL, 0x00080086UL, 0x00080046UL, 0x000900ecUL, 0x00070107UL, 0x0008005eUL,
+	0x0008001eUL, 0x0009009cUL, 0x00070117UL, 0x0008007eUL, 0x0008003eUL, 0x000900dcUL,
+	0x0007010fUL, 0x0008006eUL, 0x0008002eUL, 0x000900bcUL, 0x0008000eUL, 0x0008008eUL,
+	0x0008004eUL, 0x000900fcUL, 0x00070100UL, 0x00080051UL, 0x00080011UL, 0x00080119UL,
+	0x00070110UL, 0x00080071UL, 0x00080031UL, 0x000900c2UL, 0x00070108UL, 0x00080061UL,
+	0x00080021UL, 0x000900a2UL, 0x00080001UL, 0x00080081UL, 0x00080041UL, 0x000900e2UL,
+	0x00070104UL, 0x00080059UL, 0x00080019UL, 0x00090092UL, 0x00070114UL, 0x00080079UL,
+	0x00080039UL, 0x000900d2UL, 0x0007010cUL, 0x00080069UL, 0x00080029UL, 0x000900b2UL,
+	0x00080009UL, 0x00080089UL, 0x00080049UL, 0x000900f2UL, 0x00070102UL, 0x00080055UL,
+	0x00080015UL, 0x0008011dUL, 0x00070112UL, 0x00080075UL, 0x00080035UL, 0x000900caUL,
+	0x0007010aUL, 0x00080065UL, 0x00080025UL, 0x000900aaUL, 0x00080005UL, 0x00080085UL,
+	0x00080045UL, 0x000900eaUL, 0x00070106UL, 0x0008005dUL, 0x0008001dUL, 0x0009009aUL,
+	0x00070116UL, 0x0008007dUL, 0x0008003dUL, 0x000900daUL, 0x0007010eUL, 0x0008006dUL,
+	0x0008002dUL, 0x000900baUL, 0x0008000dUL, 0x0008008dUL, 0x0008004dUL, 0x000900faUL,
+	0x00070101UL, 0x00080053UL, 0x00080013UL, 0x0008011bUL, 0x00070111UL, 0x00080073UL,
+	0x00080033UL, 0x000900c6UL, 0x00070109UL, 0x00080063UL, 0x00080023UL, 0x000900a6UL,
+	0x00080003UL, 0x00080083UL, 0x00080043UL, 0x000900e6UL, 0x00070105UL, 0x0008005bUL,
+	0x0008001bUL, 0x00090096UL, 0x00070115UL, 0x0008007bUL, 0x0008003bUL, 0x000900d6UL,
+	0x0007010dUL, 0x0008006bUL, 0x0008002bUL, 0x000900b6UL, 0x0008000bUL, 0x0008008bUL,
+	0x0008004bUL, 0x000900f6UL, 0x00070103UL, 0x00080057UL, 0x00080017UL, 0x0008011fUL,
+	0x00070113UL, 0x00080077UL, 0x00080037UL, 0x000900ceUL, 0x0007010bUL, 0x00080067UL,
+	0x00080027UL, 0x000900aeUL, 0x00080007UL, 0x00080087UL, 0x00080047UL, 0x000900eeUL,
+	0x00070107UL, 0x0008005fUL, 0x0008001fUL, 0x0009009eUL, 0x00070117UL, 0x0008007fUL,
+	0x0008003fUL, 0x000900deUL, 0x0007010fUL, 0x0008006fUL, 0x0008002fUL, 0x000900beUL,
+	0x0008000fUL, 0x0008008fUL, 0x0008004fUL, 0x000900feUL, 0x00070100UL, 0x00080050UL,
+	0x00080010UL, 0x00080118UL, 0x00070110UL, 0x00080070UL, 0x00080030UL, 0x000900c1UL,
+	0x00070108UL, 0x00080060UL, 0x00080020UL, 0x000900a1UL, 0x00080000UL, 0x00080080UL,
+	0x00080040UL, 0x000900e1UL, 0x00070104UL, 0x00080058UL, 0x00080018UL, 0x00090091UL,
+	0x00070114UL, 0x00080078UL, 0x00080038UL, 0x000900d1UL, 0x0007010cUL, 0x00080068UL,
+	0x00080028UL, 0x000900b1UL, 0x00080008UL, 0x00080088UL, 0x00080048UL, 0x000900f1UL,
+	0x00070102UL, 0x00080054UL, 0x00080014UL, 0x0008011cUL, 0x00070112UL, 0x00080074UL,
+	0x00080034UL, 0x000900c9UL, 0x0007010aUL, 0x00080064UL, 0x00080024UL, 0x000900a9UL,
+	0x00080004UL, 0x00080084UL, 0x00080044UL, 0x000900e9UL, 0x00070106UL, 0x0008005cUL,
+	0x0008001cUL, 0x00090099UL, 0x00070116UL, 0x0008007cUL, 0x0008003cUL, 0x000900d9UL,
+	0x0007010eUL, 0x0008006cUL, 0x0008002cUL, 0x000900b9UL, 0x0008000cUL, 0x0008008cUL,
+	0x0008004cUL, 0x000900f9UL, 0x00070101UL, 0x00080052UL, 0x00080012UL, 0x0008011aUL,
+	0x00070111UL, 0x00080072UL, 0x00080032UL, 0x000900c5UL, 0x00070109UL, 0x00080062UL,
+	0x00080022UL, 0x000900a5UL, 0x00080002UL, 0x00080082UL, 0x00080042UL, 0x000900e5UL,
+	0x00070105UL, 0x0008005aUL, 0x0008001aUL, 0x00090095UL, 0x00070115UL, 0x0008007aUL,
+	0x0008003aUL, 0x000900d5UL, 0x0007010dUL, 0x0008006aUL, 0x0008002aUL, 0x000900b5UL,
+	0x0008000aUL, 0x0008008aUL, 0x0008004aUL, 0x000900f5UL, 0x00070103UL, 0x00080056UL,
+	0x00080016UL, 0x0008011eUL, 0x00070113UL, 0x00080076UL, 0x00080036UL, 0x000900cdUL,
+	0x0007010bUL, 0x00080066UL, 0x00080026UL, 0x000900adUL, 0x00080006UL, 0x00080086UL,
+	0x00080046UL, 0x000900edUL, 0x00070107UL, 0x0008005eUL, 0x0008001eUL, 0x0009009dUL,
+	0x00070117UL, 0x0008007eUL, 0x0008003eUL, 0x000900ddUL, 0x0007010fUL, 0x0008006eUL,
+	0x0008002eUL, 0x000900bdUL, 0x0008000eUL, 0x0008008eUL, 0x0008004eUL, 0x000900fdUL,
+	0x00070100UL, 0x00080051UL, 0x00080011UL, 0x00080119UL, 0x00070110UL, 0x00080071UL,
+	0x00080031UL, 0x000900c3UL, 0x00070108UL, 0x00080061UL, 0x00080021UL, 0x000900a3UL,
+	0x00080001UL, 0x00080081UL, 0x00080041UL, 0x000900e3UL, 0x00070104UL, 0x00080059UL,
+	0x00080019UL, 0x00090093UL, 0x00070114UL, 0x00080079UL, 0x00080039UL, 0x000900d3UL,
+	0x0007010cUL, 0x00080069UL, 0x00080029UL, 0x000900b3UL, 0x00080009UL, 0x00080089UL,
+	0x00080049UL, 0x000900f3UL, 0x00070102UL, 0x00080055UL, 0x00080015UL, 0x0008011dUL,
+	0x00070112UL, 0x00080075UL, 0x00080035UL, 0x000900cbUL, 0x0007010aUL, 0x00080065UL,
+	0x00080025UL, 0x000900abUL, 0x00080005UL, 0x00080085UL, 0x00080045UL, 0x000900ebUL,
+	0x00070106UL, 0x0008005dUL, 0x0008001dUL, 0x0009009bUL, 0x00070116UL, 0x0008007dUL,
+	0x0008003dUL, 0x000900dbUL, 0x0007010eUL, 0x0008006dUL, 0x0008002dUL, 0x000900bbUL,
+	0x0008000dUL, 0x0008008dUL, 0x0008004dUL, 0x000900fbUL, 0x00070101UL, 0x00080053UL,
+	0x00080013UL, 0x0008011bUL, 0x00070111UL, 0x00080073UL, 0x00080033UL, 0x000900c7UL,
+	0x00070109UL, 0x00080063UL, 0x00080023UL, 0x000900a7UL, 0x00080003UL, 0x00080083UL,
+	0x00080043UL, 0x000900e7UL, 0x00070105UL, 0x0008005bUL, 0x0008001bUL, 0x00090097UL,
+	0x00070115UL, 0x0008007bUL, 0x0008003bUL, 0x000900d7UL, 0x0007010dUL, 0x0008006bUL,
+	0x0008002bUL, 0x000900b7UL, 0x0008000bUL, 0x0008008bUL, 0x0008004bUL, 0x000900f7UL,
+	0x00070103UL, 0x00080057UL, 0x00080017UL, 0x0008011fUL, 0x00070113UL, 0x00080077UL,
+	0x00080037UL, 0x000900cfUL, 0x0007010bUL, 0x00080067UL, 0x00080027UL, 0x000900afUL,
+	0x00080007UL, 0x00080087UL, 0x00080047UL, 0x000900efUL, 0x00070107UL, 0x0008005fUL,
+	0x0008001fUL, 0x0009009fUL, 0x00070117UL, 0x0008007fUL, 0x0008003fUL, 0x000900dfUL,
+	0x0007010fUL, 0x0008006fUL, 0x0008002fUL, 0x000900bfUL, 0x0008000fUL, 0x0008008fUL,
+	0x0008004fUL, 0x000900ffUL };
+
+/* The lookup table of the fixed Huffman distance codes
+ * It is indexed by the next 5 bits of the bit stream
+ */
+const uint32_t libgzipf_deflate_fixed_huffman_distances_lookup_table[ 32 ] = {
+	0x00050000UL, 0x00050010UL, 0x00050008UL, 0x00050018UL, 0x00050004UL, 0x00050014UL,
+	0x0005000cUL, 0x0005001cUL, 0x00050002UL, 0x00050012UL, 0x0005000aUL, 0x0005001aUL,
+	0x00050006UL, 0x00050016UL, 0x0005000eUL, 0x0005001eUL, 0x00050001UL, 0x00050011UL,
+	0x00050009UL, 0x00050019UL, 0x00050005UL, 0x00050015UL, 0x0005000dUL, 0x0005001dUL,
+	0x00050003UL, 0x00050013UL, 0x0005000bUL, 0x0005001bUL, 0x00050007UL, 0x00050017UL,
+	0x0005000fUL, 0x0005001fUL };
+
+/* The fixed Huffman trees
+ * These only consist of a primary lookup table that contains every code
+ */
+const libgzipf_huffman_tree_t libgzipf_deflate_fixed_huffman_literals_tree = {
+	9, NULL, NULL, 9, libgzipf_deflate_fixed_huffman_literals_lookup_table, NULL, 512 };
+
+const libgzipf_huffman_tree_t libgzipf_deflate_fixed_huffman_distances_tree = {
+	5, NULL, NULL, 5, libgzipf_deflate_fixed_huffman_distances_lookup_table, NULL, 32 };
+
+/* Builds the lookup table of the Huffman codes of the code sizes
+ * It is indexed by the next 7 bits of the bit stream and every entry
+ * contains the symbol in bits 0 - 15 and the code size in bits 16 - 23,
+ * the entries of unused Huffman codes are 0
  * Returns 1 on success or -1 on error
  */
-int libgzipf_deflate_build_dynamic_huffman_trees(
+int libgzipf_deflate_build_codes_lookup_table(
+     const uint8_t *code_sizes_array,
+     uint32_t *lookup_table,
+     libcerror_error_t **error )
+{
+	uint16_t code_size_counts[ 8 ];
+	uint16_t next_huffman_codes[ 8 ];
+
+	static char *function   = "libgzipf_deflate_build_codes_lookup_table";
+	uint16_t huffman_code   = 0;
+	uint16_t lookup_index   = 0;
+	uint16_t reversed_code  = 0;
+	uint16_t symbol         = 0;
+	uint8_t bit_index       = 0;
+	uint8_t code_size       = 0;
+	int left_value          = 0;
+
+	if( code_sizes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( uint16_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     lookup_table,
+	     0,
+	     sizeof( uint32_t ) * 128 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < 19;
+	     symbol++ )
+	{
+		code_size = code_sizes_array[ symbol ];
+
+		if( code_size > 7 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %" PRIu16 " code size: %" PRIu8 " value out of bounds.",
+			 function,
+			 symbol,
+			 code_size );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+
+	/* Check if the Huffman codes are over-subscribed
+	 */
+	left_value = 1;
+
+	for( bit_index = 1;
+	     bit_index <= 7;
+	     bit_index++ )
+	{
+		left_value <<= 1;
+		left_value  -= code_size_counts[ bit_index ];
+
+		if( left_value < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: code sizes are over-subscribed.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	huffman_code = 0;
+
+	for( bit_index = 1;
+	     bit_index <= 7;
+	     bit_index++ )
+	{
+		huffman_code = ( huffman_code + code_size_counts[ bit_index - 1 ] ) << 1;
+
+		next_huffman_codes[ bit_index ] = huffman_code;
+	}
+	for( symbol = 0;
+	     symbol < 19;
+	     symbol++ )
+	{
+		code_size = code_sizes_array[ symbol ];
+
+		if( code_size == 0 )
+		{
+			continue;
+		}
+		huffman_code = next_huffman_codes[ code_size ]++;
+
+		/* The Huffman codes are stored in the bit stream with the most significant bit first
+		 */
+		reversed_code = 0;
+
+		for( bit_index = 0;
+		     bit_index < code_size;
+		     bit_index++ )
+		{
+			reversed_code <<= 1;
+			reversed_code  |= ( huffman_code >> bit_index ) & 0x0001;
+		}
+		for( lookup_index = reversed_code;
+		     lookup_index < 128;
+		     lookup_index += (uint16_t) 1 << code_size )
+		{
+			lookup_table[ lookup_index ] = ( (uint32_t) code_size << 16 ) | symbol;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the code sizes of the dynamic Huffman trees
+ * The code sizes array must be able to contain 316 code sizes
+ * Returns 1 on success or -1 on error
+ */
+int libgzipf_deflate_read_dynamic_code_sizes(
      libgzipf_bit_stream_t *bit_stream,
-     libgzipf_huffman_tree_t *literals_tree,
-     libgzipf_huffman_tree_t *distances_tree,
+     uint8_t *code_sizes_array,
+     uint16_t *number_of_literal_codes,
+     uint16_t *number_of_distance_codes,
      libcerror_error_t **error )
 {
-	uint8_t code_size_array[ 316 ];
+	uint32_t codes_lookup_table[ 128 ];
+	uint8_t codes_code_sizes_array[ 19 ];
+
+	static char *function                  = "libgzipf_deflate_read_dynamic_code_sizes";
+	uint32_t code_size_index               = 0;
+	uint32_t code_size_value               = 0;
+	uint32_t lookup_value                  = 0;
+	uint32_t number_of_code_sizes          = 0;
+	uint32_t safe_number_of_distance_codes = 0;
+	uint32_t safe_number_of_literal_codes  = 0;
+	uint32_t times_to_repeat               = 0;
+	uint16_t symbol                        = 0;
+	uint8_t code_size                      = 0;
+	uint8_t number_of_extra_bits           = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_literal_codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of literal codes.",
+		 function );
 
-	libgzipf_huffman_tree_t *codes_tree = NULL;
-	static char *function              = "libgzipf_deflate_build_dynamic_huffman_trees";
-	uint32_t code_size                 = 0;
-	uint32_t code_size_index           = 0;
-	uint32_t code_size_sequence        = 0;
-	uint32_t number_of_code_sizes      = 0;
-	uint32_t number_of_distance_codes  = 0;
-	uint32_t number_of_literal_codes   = 0;
-	uint32_t times_to_repeat           = 0;
-	uint16_t symbol                    = 0;
+		return( -1 );
+	}
+	if( number_of_distance_codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of distance codes.",
+		 function );
 
+		return( -1 );
+	}
 	if( libgzipf_bit_stream_get_value(
 	     bit_stream,
 	     14,
@@ -86,16 +437,16 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 		 "%s: unable to retrieve value from bit stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	number_of_literal_codes  = number_of_code_sizes & 0x0000001fUL;
-	number_of_code_sizes   >>= 5;
-	number_of_distance_codes = number_of_code_sizes & 0x0000001fUL;
-	number_of_code_sizes   >>= 5;
+	safe_number_of_literal_codes  = number_of_code_sizes & 0x0000001fUL;
+	number_of_code_sizes        >>= 5;
+	safe_number_of_distance_codes = number_of_code_sizes & 0x0000001fUL;
+	number_of_code_sizes        >>= 5;
 
-	number_of_literal_codes += 257;
+	safe_number_of_literal_codes += 257;
 
-	if( number_of_literal_codes > 286 )
+	if( safe_number_of_literal_codes > 286 )
 	{
 		libcerror_error_set(
 		 error,
@@ -104,11 +455,11 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 		 "%s: invalid number of literal codes value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	number_of_distance_codes += 1;
+	safe_number_of_distance_codes += 1;
 
-	if( number_of_distance_codes > 30 )
+	if( safe_number_of_distance_codes > 30 )
 	{
 		libcerror_error_set(
 		 error,
@@ -117,7 +468,7 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 		 "%s: invalid number of distance codes value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_code_sizes += 4;
 
@@ -128,7 +479,7 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 		if( libgzipf_bit_stream_get_value(
 		     bit_stream,
 		     3,
-		     &code_size,
+		     &code_size_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -138,76 +489,70 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 			 "%s: unable to retrieve value from bit stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		code_size_sequence = libgzipf_deflate_code_sizes_sequence[ code_size_index ];
-
-		code_size_array[ code_size_sequence ] = (uint8_t) code_size;
+		codes_code_sizes_array[ libgzipf_deflate_code_sizes_sequence[ code_size_index ] ] = (uint8_t) code_size_value;
 	}
 	while( code_size_index < 19 )
 	{
-		code_size_sequence = libgzipf_deflate_code_sizes_sequence[ code_size_index++ ];
-
-		code_size_array[ code_size_sequence ] = 0;
-	}
-	if( libgzipf_huffman_tree_initialize(
-	     &codes_tree,
-	     19,
-	     15,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build codes tree.",
-		 function );
-
-		goto on_error;
+		codes_code_sizes_array[ libgzipf_deflate_code_sizes_sequence[ code_size_index++ ] ] = 0;
 	}
-	if( libgzipf_huffman_tree_build(
-	     codes_tree,
-	     code_size_array,
-	     19,
+	if( libgzipf_deflate_build_codes_lookup_table(
+	     codes_code_sizes_array,
+	     codes_lookup_table,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build codes tree.",
+		 "%s: unable to build codes lookup table.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	number_of_code_sizes = number_of_literal_codes + number_of_distance_codes;
+	number_of_code_sizes = safe_number_of_literal_codes + safe_number_of_distance_codes;
 
 	code_size_index = 0;
 
 	while( code_size_index < number_of_code_sizes )
 	{
-		if( libgzipf_huffman_tree_get_symbol_from_bit_stream(
-		     codes_tree,
-		     bit_stream,
-		     &symbol,
-		     error ) != 1 )
+		/* A single code consumes at most 14 bits: a 7-bit Huffman code with 7 extra bits
+		 */
+		if( bit_stream->bit_buffer_size < 14 )
+		{
+			libgzipf_bit_stream_refill(
+			 bit_stream );
+		}
+		lookup_value = codes_lookup_table[ libgzipf_bit_stream_peek( bit_stream, 7 ) ];
+
+		code_size = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		if( ( code_size == 0 )
+		 || ( code_size > bit_stream->bit_buffer_size ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve literal value from bit stream.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code size Huffman code.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 code_size );
+
+		symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
 		if( symbol < 16 )
 		{
-			code_size_array[ code_size_index++ ] = (uint8_t) symbol;
+			code_sizes_array[ code_size_index++ ] = (uint8_t) symbol;
 
 			continue;
 		}
-		code_size = 0;
+		code_size_value = 0;
 
 		if( symbol == 16 )
 		{
@@ -220,76 +565,41 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 				 "%s: invalid code size index value out of bounds.",
 				 function );
 
-				goto on_error;
-			}
-			code_size = (uint32_t) code_size_array[ code_size_index - 1 ];
-
-			if( libgzipf_bit_stream_get_value(
-			     bit_stream,
-			     2,
-			     &times_to_repeat,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
-
-				goto on_error;
+				return( -1 );
 			}
-			times_to_repeat += 3;
+			code_size_value      = (uint32_t) code_sizes_array[ code_size_index - 1 ];
+			number_of_extra_bits = 2;
+			times_to_repeat      = 3;
 		}
 		else if( symbol == 17 )
 		{
-			if( libgzipf_bit_stream_get_value(
-			     bit_stream,
-			     3,
-			     &times_to_repeat,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
-
-				goto on_error;
-			}
-			times_to_repeat += 3;
+			number_of_extra_bits = 3;
+			times_to_repeat      = 3;
 		}
-		else if( symbol == 18 )
+		else
 		{
-			if( libgzipf_bit_stream_get_value(
-			     bit_stream,
-			     7,
-			     &times_to_repeat,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
-
-				goto on_error;
-			}
-			times_to_repeat += 11;
+			number_of_extra_bits = 7;
+			times_to_repeat      = 11;
 		}
-		else
+		if( number_of_extra_bits > bit_stream->bit_buffer_size )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid code value value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
+		times_to_repeat += libgzipf_bit_stream_peek(
+		                    bit_stream,
+		                    number_of_extra_bits );
+
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 number_of_extra_bits );
+
 		if( ( code_size_index + times_to_repeat ) > number_of_code_sizes )
 		{
 			libcerror_error_set(
@@ -299,16 +609,16 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 			 "%s: invalid times to repeat value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		while( times_to_repeat > 0 )
 		{
-			code_size_array[ code_size_index++ ] = (uint8_t) code_size;
+			code_sizes_array[ code_size_index++ ] = (uint8_t) code_size_value;
 
 			times_to_repeat--;
 		}
 	}
-	if( code_size_array[ 256 ] == 0 )
+	if( code_sizes_array[ 256 ] == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -317,20 +627,44 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 		 "%s: end-of-block code value missing in literal codes array.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libgzipf_huffman_tree_free(
-	     &codes_tree,
+	*number_of_literal_codes  = (uint16_t) safe_number_of_literal_codes;
+	*number_of_distance_codes = (uint16_t) safe_number_of_distance_codes;
+
+	return( 1 );
+}
+
+/* Initializes the dynamic Huffman trees
+ * Returns 1 on success or -1 on error
+ */
+int libgzipf_deflate_build_dynamic_huffman_trees(
+     libgzipf_bit_stream_t *bit_stream,
+     libgzipf_huffman_tree_t *literals_tree,
+     libgzipf_huffman_tree_t *distances_tree,
+     libcerror_error_t **error )
+{
+	uint8_t code_size_array[ 316 ];
+
+	static char *function             = "libgzipf_deflate_build_dynamic_huffman_trees";
+	uint16_t number_of_distance_codes = 0;
+	uint16_t number_of_literal_codes  = 0;
+
+	if( libgzipf_deflate_read_dynamic_code_sizes(
+	     bit_stream,
+	     code_size_array,
+	     &number_of_literal_codes,
+	     &number_of_distance_codes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free codes tree.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read dynamic code sizes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libgzipf_huffman_tree_build(
 	     literals_tree,
@@ -345,7 +679,7 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build literals tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libgzipf_huffman_tree_build(
 	     distances_tree,
@@ -360,18 +694,9 @@ int libgzipf_deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build distances tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( codes_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &codes_tree,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Initializes the fixed Huffman trees
@@ -445,26 +770,314 @@ int libgzipf_deflate_build_fixed_huffman_trees(
 	return( 1 );
 }
 
-/* Decodes a Huffman compressed block
+/* Decodes a Huffman compressed block while the input and output have sufficient slack
+ * Every symbol is decoded from a single refill of the bit buffer without
+ * bounds checks on the byte stream and uncompressed data, the remainder
+ * of the block is left to libgzipf_deflate_decode_huffman
+ * The minimum match offset is lowered to the offset of the uncompressed data
+ * referred to by a distance code if smaller
+ * Returns 1 if the end of block was reached, 0 if not or -1 on error
+ */
+int libgzipf_deflate_decode_huffman_fast(
+     libgzipf_bit_stream_t *bit_stream,
+     const libgzipf_huffman_tree_t *literals_tree,
+     const libgzipf_huffman_tree_t *distances_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     size_t *minimum_match_offset,
+     libcerror_error_t **error )
+{
+	static char *function        = "libgzipf_deflate_decode_huffman_fast";
+	size_t data_offset           = 0;
+	size_t match_offset          = 0;
+	uint32_t lookup_value        = 0;
+	uint16_t compression_offset  = 0;
+	uint16_t compression_size    = 0;
+	uint16_t symbol              = 0;
+	uint8_t code_size            = 0;
+	uint8_t number_of_extra_bits = 0;
+	int result                   = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->storage_type != LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bit stream storage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( literals_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( distances_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( minimum_match_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum match offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset  = *uncompressed_data_offset;
+	match_offset = *minimum_match_offset;
+
+	/* A single symbol consumes at most 48 bits: a 15-bit literal code with 5 extra bits
+	 * followed by a 15-bit distance code with 13 extra bits
+	 */
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    && ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= LIBGZIPF_DEFLATE_FAST_MINIMUM_INPUT_SIZE )
+	    && ( data_offset < uncompressed_data_size )
+	    && ( ( uncompressed_data_size - data_offset ) >= LIBGZIPF_DEFLATE_FAST_MINIMUM_OUTPUT_SIZE ) )
+	{
+		if( bit_stream->bit_buffer_size < 48 )
+		{
+			libgzipf_bit_stream_refill(
+			 bit_stream );
+		}
+		lookup_value = libgzipf_huffman_tree_get_lookup_value(
+		                literals_tree,
+		                bit_stream );
+
+		code_size = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		if( code_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid literal Huffman code.",
+			 function );
+
+			goto on_error;
+		}
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 code_size );
+
+		symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
+		if( symbol < 256 )
+		{
+			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		if( symbol == 256 )
+		{
+			result = 1;
+
+			break;
+		}
+		if( symbol >= 286 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid code value: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			goto on_error;
+		}
+		symbol -= 257;
+
+		number_of_extra_bits = (uint8_t) libgzipf_deflate_literal_codes_number_of_extra_bits[ symbol ];
+
+		compression_size = libgzipf_deflate_literal_codes_base[ symbol ] + (uint16_t) libgzipf_bit_stream_peek( bit_stream, number_of_extra_bits );
+
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 number_of_extra_bits );
+
+		lookup_value = libgzipf_huffman_tree_get_lookup_value(
+		                distances_tree,
+		                bit_stream );
+
+		code_size = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		if( code_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance Huffman code.",
+			 function );
+
+			goto on_error;
+		}
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 code_size );
+
+		symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
+		if( symbol >= 30 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance code value: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			goto on_error;
+		}
+		number_of_extra_bits = (uint8_t) libgzipf_deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+		compression_offset = libgzipf_deflate_distance_codes_base[ symbol ] + (uint16_t) libgzipf_bit_stream_peek( bit_stream, number_of_extra_bits );
+
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 number_of_extra_bits );
+
+		if( compression_offset > data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compression offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( data_offset - compression_offset ) < match_offset )
+		{
+			match_offset = data_offset - compression_offset;
+		}
+		libgzipf_deflate_copy_match(
+		 &( uncompressed_data[ data_offset ] ),
+		 compression_offset,
+		 compression_size );
+
+		data_offset += compression_size;
+	}
+	*uncompressed_data_offset = data_offset;
+	*minimum_match_offset     = match_offset;
+
+	return( result );
+
+on_error:
+	*uncompressed_data_offset = data_offset;
+	*minimum_match_offset     = match_offset;
+
+	return( -1 );
+}
+
+/* Decodes a fixed Huffman compressed block
  * Returns 1 on success or -1 on error
  */
-int libgzipf_deflate_decode_huffman(
+int libgzipf_deflate_decode_fixed_huffman(
      libgzipf_bit_stream_t *bit_stream,
-     libgzipf_huffman_tree_t *literals_tree,
-     libgzipf_huffman_tree_t *distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	static char *function         = "libgzipf_deflate_decode_huffman";
-	size_t data_offset            = 0;
-	uint32_t extra_bits           = 0;
-	uint16_t compression_offset   = 0;
-	uint16_t compression_size     = 0;
-	uint16_t number_of_extra_bits = 0;
-	uint16_t symbol               = 0;
+	static char *function        = "libgzipf_deflate_decode_fixed_huffman";
+	size_t data_offset           = 0;
+	uint32_t lookup_value        = 0;
+	uint16_t compression_offset  = 0;
+	uint16_t compression_size    = 0;
+	uint16_t symbol              = 0;
+	uint8_t code_size            = 0;
+	uint8_t number_of_extra_bits = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
 
+		return( -1 );
+	}
+	if( bit_stream->storage_type != LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bit stream storage type.",
+		 function );
+
+		return( -1 );
+	}
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -502,21 +1115,35 @@ int libgzipf_deflate_decode_huffman(
 
 	do
 	{
-		if( libgzipf_huffman_tree_get_symbol_from_bit_stream(
-		     literals_tree,
-		     bit_stream,
-		     &symbol,
-		     error ) != 1 )
+		/* A single symbol consumes at most 31 bits: a 9-bit literal code with 5 extra bits
+		 * followed by a 5-bit distance code with 13 extra bits
+		 */
+		if( bit_stream->bit_buffer_size < 31 )
+		{
+			libgzipf_bit_stream_refill(
+			 bit_stream );
+		}
+		lookup_value = libgzipf_deflate_fixed_huffman_literals_lookup_table[ libgzipf_bit_stream_peek( bit_stream, 9 ) ];
+
+		code_size = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		if( code_size > bit_stream->bit_buffer_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve literal value from bit stream.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 code_size );
+
+		symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
 		if( symbol < 256 )
 		{
 			if( data_offset >= uncompressed_data_size )
@@ -537,27 +1164,231 @@ int libgzipf_deflate_decode_huffman(
 		{
 			symbol -= 257;
 
-			number_of_extra_bits = libgzipf_deflate_literal_codes_number_of_extra_bits[ symbol ];
+			number_of_extra_bits = (uint8_t) libgzipf_deflate_literal_codes_number_of_extra_bits[ symbol ];
 
-			if( libgzipf_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			if( ( number_of_extra_bits + 5 ) > bit_stream->bit_buffer_size )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve literal extra value from bit stream.",
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid byte stream offset value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			compression_size = libgzipf_deflate_literal_codes_base[ symbol ] + (uint16_t) libgzipf_bit_stream_peek( bit_stream, number_of_extra_bits );
+
+			libgzipf_bit_stream_consume(
+			 bit_stream,
+			 number_of_extra_bits );
+
+			lookup_value = libgzipf_deflate_fixed_huffman_distances_lookup_table[ libgzipf_bit_stream_peek( bit_stream, 5 ) ];
+
+			libgzipf_bit_stream_consume(
+			 bit_stream,
+			 5 );
+
+			symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
+			if( symbol >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance code value: %" PRIu16 ".",
+				 function,
+				 symbol );
+
+				goto on_error;
+			}
+			number_of_extra_bits = (uint8_t) libgzipf_deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+			if( number_of_extra_bits > bit_stream->bit_buffer_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid byte stream offset value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			compression_offset = libgzipf_deflate_distance_codes_base[ symbol ] + (uint16_t) libgzipf_bit_stream_peek( bit_stream, number_of_extra_bits );
+
+			libgzipf_bit_stream_consume(
+			 bit_stream,
+			 number_of_extra_bits );
+
+			if( compression_offset > data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid compression offset value out of bounds.",
 				 function );
 
 				goto on_error;
 			}
-			compression_size = libgzipf_deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
+			if( (size_t) compression_size > ( uncompressed_data_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
 
+				goto on_error;
+			}
+			if( ( uncompressed_data_size - data_offset ) >= LIBGZIPF_DEFLATE_FAST_MINIMUM_OUTPUT_SIZE )
+			{
+				libgzipf_deflate_copy_match(
+				 &( uncompressed_data[ data_offset ] ),
+				 compression_offset,
+				 compression_size );
+
+				data_offset += compression_size;
+			}
+			else
+			{
+				while( compression_size > 0 )
+				{
+					uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+
+					data_offset++;
+					compression_size--;
+				}
+			}
+		}
+		else if( symbol != 256 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid code value: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			goto on_error;
+		}
+	}
+	while( symbol != 256 );
+
+	*uncompressed_data_offset = data_offset;
+
+	return( 1 );
+
+on_error:
+	*uncompressed_data_offset = data_offset;
+
+	return( -1 );
+}
+
+/* Decodes a Huffman compressed block
+ * Returns 1 on success or -1 on error
+ */
+int libgzipf_deflate_decode_huffman(
+     libgzipf_bit_stream_t *bit_stream,
+     const libgzipf_huffman_tree_t *literals_tree,
+     const libgzipf_huffman_tree_t *distances_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function         = "libgzipf_deflate_decode_huffman";
+	size_t data_offset            = 0;
+	size_t match_offset           = 0;
+	uint32_t extra_bits           = 0;
+	uint16_t compression_offset   = 0;
+	uint16_t compression_size     = 0;
+	uint16_t number_of_extra_bits = 0;
+	uint16_t symbol               = 0;
+	int result                    = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = *uncompressed_data_offset;
+
+	if( bit_stream->storage_type == LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		result = libgzipf_deflate_decode_huffman_fast(
+		          bit_stream,
+		          literals_tree,
+		          distances_tree,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &data_offset,
+		          &match_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode Huffman compressed data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Decode the remainder of the block near the end of the byte stream or uncompressed data
+	 */
+	if( result == 0 )
+	{
+		do
+		{
 			if( libgzipf_huffman_tree_get_symbol_from_bit_stream(
-			     distances_tree,
+			     literals_tree,
 			     bit_stream,
 			     &symbol,
 			     error ) != 1 )
@@ -566,74 +1397,141 @@ int libgzipf_deflate_decode_huffman(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve distance value from bit stream.",
+				 "%s: unable to retrieve literal value from bit stream.",
 				 function );
 
 				goto on_error;
 			}
-			number_of_extra_bits = libgzipf_deflate_distance_codes_number_of_extra_bits[ symbol ];
+			if( symbol < 256 )
+			{
+				if( data_offset >= uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid uncompressed data value too small.",
+					 function );
+
+					goto on_error;
+				}
+				uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+			}
+			else if( ( symbol > 256 )
+			      && ( symbol < 286 ) )
+			{
+				symbol -= 257;
+
+				number_of_extra_bits = libgzipf_deflate_literal_codes_number_of_extra_bits[ symbol ];
+
+				if( libgzipf_bit_stream_get_value(
+				     bit_stream,
+				     (uint8_t) number_of_extra_bits,
+				     &extra_bits,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve literal extra value from bit stream.",
+					 function );
+
+					goto on_error;
+				}
+				compression_size = libgzipf_deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+				if( libgzipf_huffman_tree_get_symbol_from_bit_stream(
+				     distances_tree,
+				     bit_stream,
+				     &symbol,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve distance value from bit stream.",
+					 function );
+
+					goto on_error;
+				}
+				if( symbol >= 30 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid distance code value: %" PRIu16 ".",
+					 function,
+					 symbol );
+
+					goto on_error;
+				}
+				number_of_extra_bits = libgzipf_deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+				if( libgzipf_bit_stream_get_value(
+				     bit_stream,
+				     (uint8_t) number_of_extra_bits,
+				     &extra_bits,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve distance extra value from bit stream.",
+					 function );
 
-			if( libgzipf_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve distance extra value from bit stream.",
-				 function );
+					goto on_error;
+				}
+				compression_offset = libgzipf_deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
 
-				goto on_error;
-			}
-			compression_offset = libgzipf_deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
+				if( compression_offset > data_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid compression offset value out of bounds.",
+					 function );
 
-			if( compression_offset > data_offset )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid compression offset value out of bounds.",
-				 function );
+					goto on_error;
+				}
+				if( ( data_offset + compression_size ) > uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid uncompressed data value too small.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				while( compression_size > 0 )
+				{
+					uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+
+					data_offset++;
+					compression_size--;
+				}
 			}
-			if( ( data_offset + compression_size ) > uncompressed_data_size )
+			else if( symbol != 256 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: invalid code value: %" PRIu16 ".",
+				 function,
+				 symbol );
 
 				goto on_error;
 			}
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
-
-				data_offset++;
-				compression_size--;
-			}
-		}
-		else if( symbol != 256 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid code value: %" PRIu16 ".",
-			 function,
-			 symbol );
-
-			goto on_error;
 		}
+		while( symbol != 256 );
 	}
-	while( symbol != 256 );
 
 	*uncompressed_data_offset = data_offset;
 
@@ -645,59 +1543,22 @@ on_error:
 	return( -1 );
 }
 
-/* Calculates the little-endian Adler-32 of a buffer
- * It uses the initial value to calculate a new Adler-32
- * Returns 1 if successful or -1 on error
+/* Updates an Adler-32 a byte at a time
+ * Returns the updated Adler-32
  */
-int libgzipf_deflate_calculate_adler32(
-     uint32_t *checksum_value,
-     const uint8_t *data,
-     size_t data_size,
-     uint32_t initial_value,
-     libcerror_error_t **error )
+uint32_t libgzipf_deflate_update_adler32_scalar(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size )
 {
-	static char *function = "libgzipf_deflate_calculate_adler32";
-	size_t data_offset    = 0;
-	uint32_t lower_word   = 0;
-	uint32_t upper_word   = 0;
-	uint32_t value_32bit  = 0;
-	int block_index       = 0;
-
-	if( checksum_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid checksum value.",
-		 function );
-
-		return( -1 );
-	}
-	if( data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
-		 function );
-
-		return( -1 );
-	}
-	if( data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid data size value exceeds maximum.",
-		 function );
+	size_t data_offset   = 0;
+	uint32_t lower_word  = 0;
+	uint32_t upper_word  = 0;
+	uint32_t value_32bit = 0;
+	int block_index      = 0;
 
-		return( -1 );
-	}
-	lower_word = initial_value & 0xffff;
-	upper_word = ( initial_value >> 16 ) & 0xffff;
+	lower_word = checksum & 0xffff;
+	upper_word = ( checksum >> 16 ) & 0xffff;
 
 	while( data_size >= 0x15b0 )
 	{
@@ -877,18 +1738,594 @@ int libgzipf_deflate_calculate_adler32(
 		upper_word &= 0x0000ffffUL;
 		upper_word += ( value_32bit << 4 ) - value_32bit;
 
-		if( upper_word > 65521 )
-		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( upper_word >= 65521 )
-		{
-			upper_word -= 65521;
-		}
+		if( upper_word > 65521 )
+		{
+			value_32bit = upper_word >> 16;
+			upper_word &= 0x0000ffffUL;
+			upper_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( upper_word >= 65521 )
+		{
+			upper_word -= 65521;
+		}
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+/* Determines the fastest Adler-32 kernel supported by the CPU
+ * Returns the Adler-32 kernel
+ */
+int libgzipf_deflate_determine_adler32_kernel(
+     void )
+{
+	uint32_t cpu_features = libgzipf_cpu_get_features();
+
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
+	if( ( cpu_features & LIBGZIPF_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		return( LIBGZIPF_DEFLATE_ADLER32_KERNEL_AVX2 );
+	}
+	if( ( cpu_features & LIBGZIPF_CPU_FEATURE_SSSE3 ) != 0 )
+	{
+		return( LIBGZIPF_DEFLATE_ADLER32_KERNEL_SSSE3 );
+	}
+#endif
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+	if( ( cpu_features & LIBGZIPF_CPU_FEATURE_NEON ) != 0 )
+	{
+		return( LIBGZIPF_DEFLATE_ADLER32_KERNEL_NEON );
+	}
+#endif
+	return( LIBGZIPF_DEFLATE_ADLER32_KERNEL_SCALAR );
+}
+
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
+
+/* Updates an Adler-32 using SSSE3 instructions
+ * The data is processed in blocks of 32 bytes, where the lower word is the sum of
+ * the bytes and the upper word the sum of the bytes weighted by their distance
+ * to the end of the block. At most 173 blocks (5536 bytes) are processed before
+ * the modulo calculation to prevent the 32-bit sums from overflowing
+ * Returns the updated Adler-32
+ */
+LIBGZIPF_CPU_TARGET_SSSE3 \
+uint32_t libgzipf_deflate_update_adler32_ssse3(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size )
+{
+	__m128i data_bytes1            = _mm_setzero_si128();
+	__m128i data_bytes2            = _mm_setzero_si128();
+	__m128i lower_word_vector      = _mm_setzero_si128();
+	__m128i previous_sums_vector   = _mm_setzero_si128();
+	__m128i upper_word_vector      = _mm_setzero_si128();
+
+	const __m128i ones_vector      = _mm_set1_epi16( 1 );
+	const __m128i zero_vector      = _mm_setzero_si128();
+	const __m128i weights_vector1  = _mm_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17 );
+	const __m128i weights_vector2  = _mm_setr_epi8( 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+
+	size_t number_of_blocks        = 0;
+	uint32_t block_index           = 0;
+	uint32_t lower_word            = 0;
+	uint32_t number_of_loop_blocks = 0;
+	uint32_t upper_word            = 0;
+
+	lower_word = checksum & 0xffff;
+	upper_word = ( checksum >> 16 ) & 0xffff;
+
+	number_of_blocks = data_size / 32;
+	data_size       %= 32;
+
+	while( number_of_blocks > 0 )
+	{
+		number_of_loop_blocks = 173;
+
+		if( number_of_blocks < 173 )
+		{
+			number_of_loop_blocks = (uint32_t) number_of_blocks;
+		}
+		number_of_blocks -= number_of_loop_blocks;
+
+		/* The lower word before the blocks is added to the upper word once per byte
+		 */
+		previous_sums_vector = _mm_cvtsi32_si128( (int) ( lower_word * number_of_loop_blocks ) );
+		upper_word_vector    = _mm_cvtsi32_si128( (int) upper_word );
+		lower_word_vector    = _mm_setzero_si128();
+
+		for( block_index = 0;
+		     block_index < number_of_loop_blocks;
+		     block_index++ )
+		{
+			data_bytes1 = _mm_loadu_si128(
+			               (const __m128i *) data );
+			data_bytes2 = _mm_loadu_si128(
+			               (const __m128i *) &( data[ 16 ] ) );
+
+			previous_sums_vector = _mm_add_epi32(
+			                        previous_sums_vector,
+			                        lower_word_vector );
+
+			lower_word_vector = _mm_add_epi32(
+			                     lower_word_vector,
+			                     _mm_sad_epu8(
+			                      data_bytes1,
+			                      zero_vector ) );
+			lower_word_vector = _mm_add_epi32(
+			                     lower_word_vector,
+			                     _mm_sad_epu8(
+			                      data_bytes2,
+			                      zero_vector ) );
+
+			upper_word_vector = _mm_add_epi32(
+			                     upper_word_vector,
+			                     _mm_madd_epi16(
+			                      _mm_maddubs_epi16(
+			                       data_bytes1,
+			                       weights_vector1 ),
+			                      ones_vector ) );
+			upper_word_vector = _mm_add_epi32(
+			                     upper_word_vector,
+			                     _mm_madd_epi16(
+			                      _mm_maddubs_epi16(
+			                       data_bytes2,
+			                       weights_vector2 ),
+			                      ones_vector ) );
+
+			data += 32;
+		}
+		/* Every previous sum is added to the upper word for all 32 bytes of a block
+		 */
+		upper_word_vector = _mm_add_epi32(
+		                     upper_word_vector,
+		                     _mm_slli_epi32(
+		                      previous_sums_vector,
+		                      5 ) );
+
+		lower_word_vector = _mm_add_epi32(
+		                     lower_word_vector,
+		                     _mm_shuffle_epi32(
+		                      lower_word_vector,
+		                      _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		lower_word_vector = _mm_add_epi32(
+		                     lower_word_vector,
+		                     _mm_shuffle_epi32(
+		                      lower_word_vector,
+		                      _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word_vector = _mm_add_epi32(
+		                     upper_word_vector,
+		                     _mm_shuffle_epi32(
+		                      upper_word_vector,
+		                      _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		upper_word_vector = _mm_add_epi32(
+		                     upper_word_vector,
+		                     _mm_shuffle_epi32(
+		                      upper_word_vector,
+		                      _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32( lower_word_vector );
+		upper_word  = (uint32_t) _mm_cvtsi128_si32( upper_word_vector );
+
+		lower_word %= 65521;
+		upper_word %= 65521;
+	}
+	checksum = ( upper_word << 16 ) | lower_word;
+
+	if( data_size > 0 )
+	{
+		checksum = libgzipf_deflate_update_adler32_scalar(
+		            checksum,
+		            data,
+		            data_size );
+	}
+	return( checksum );
+}
+
+/* Updates an Adler-32 using AVX2 instructions
+ * This is the 256-bit equivalent of the SSSE3 variant
+ * Returns the updated Adler-32
+ */
+LIBGZIPF_CPU_TARGET_AVX2 \
+uint32_t libgzipf_deflate_update_adler32_avx2(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size )
+{
+	__m256i data_bytes             = _mm256_setzero_si256();
+	__m256i lower_word_vector      = _mm256_setzero_si256();
+	__m256i previous_sums_vector   = _mm256_setzero_si256();
+	__m256i upper_word_vector      = _mm256_setzero_si256();
+	__m128i sum_vector             = _mm_setzero_si128();
+
+	const __m256i ones_vector      = _mm256_set1_epi16( 1 );
+	const __m256i zero_vector      = _mm256_setzero_si256();
+	const __m256i weights_vector   = _mm256_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+
+	size_t number_of_blocks        = 0;
+	uint32_t block_index           = 0;
+	uint32_t lower_word            = 0;
+	uint32_t number_of_loop_blocks = 0;
+	uint32_t upper_word            = 0;
+
+	lower_word = checksum & 0xffff;
+	upper_word = ( checksum >> 16 ) & 0xffff;
+
+	number_of_blocks = data_size / 32;
+	data_size       %= 32;
+
+	while( number_of_blocks > 0 )
+	{
+		number_of_loop_blocks = 173;
+
+		if( number_of_blocks < 173 )
+		{
+			number_of_loop_blocks = (uint32_t) number_of_blocks;
+		}
+		number_of_blocks -= number_of_loop_blocks;
+
+		previous_sums_vector = _mm256_setr_epi32( (int) ( lower_word * number_of_loop_blocks ), 0, 0, 0, 0, 0, 0, 0 );
+		upper_word_vector    = _mm256_setr_epi32( (int) upper_word, 0, 0, 0, 0, 0, 0, 0 );
+		lower_word_vector    = _mm256_setzero_si256();
+
+		for( block_index = 0;
+		     block_index < number_of_loop_blocks;
+		     block_index++ )
+		{
+			data_bytes = _mm256_loadu_si256(
+			              (const __m256i *) data );
+
+			previous_sums_vector = _mm256_add_epi32(
+			                        previous_sums_vector,
+			                        lower_word_vector );
+
+			lower_word_vector = _mm256_add_epi32(
+			                     lower_word_vector,
+			                     _mm256_sad_epu8(
+			                      data_bytes,
+			                      zero_vector ) );
+
+			upper_word_vector = _mm256_add_epi32(
+			                     upper_word_vector,
+			                     _mm256_madd_epi16(
+			                      _mm256_maddubs_epi16(
+			                       data_bytes,
+			                       weights_vector ),
+			                      ones_vector ) );
+
+			data += 32;
+		}
+		upper_word_vector = _mm256_add_epi32(
+		                     upper_word_vector,
+		                     _mm256_slli_epi32(
+		                      previous_sums_vector,
+		                      5 ) );
+
+		sum_vector = _mm_add_epi32(
+		              _mm256_castsi256_si128(
+		               lower_word_vector ),
+		              _mm256_extracti128_si256(
+		               lower_word_vector,
+		               1 ) );
+		sum_vector = _mm_add_epi32(
+		              sum_vector,
+		              _mm_shuffle_epi32(
+		               sum_vector,
+		               _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		sum_vector = _mm_add_epi32(
+		              sum_vector,
+		              _mm_shuffle_epi32(
+		               sum_vector,
+		               _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32( sum_vector );
+
+		sum_vector = _mm_add_epi32(
+		              _mm256_castsi256_si128(
+		               upper_word_vector ),
+		              _mm256_extracti128_si256(
+		               upper_word_vector,
+		               1 ) );
+		sum_vector = _mm_add_epi32(
+		              sum_vector,
+		              _mm_shuffle_epi32(
+		               sum_vector,
+		               _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		sum_vector = _mm_add_epi32(
+		              sum_vector,
+		              _mm_shuffle_epi32(
+		               sum_vector,
+		               _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word = (uint32_t) _mm_cvtsi128_si32( sum_vector );
+
+		lower_word %= 65521;
+		upper_word %= 65521;
+	}
+	checksum = ( upper_word << 16 ) | lower_word;
+
+	if( data_size > 0 )
+	{
+		checksum = libgzipf_deflate_update_adler32_scalar(
+		            checksum,
+		            data,
+		            data_size );
+	}
+	return( checksum );
+}
+
+#endif /* defined( LIBGZIPF_CPU_HAVE_X86_64 ) */
+
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+
+/* Updates an Adler-32 using NEON instructions
+ * The bytes of every column of the 32 byte blocks are summed separately and
+ * weighted by their distance to the end of the block after the blocks are processed
+ * Returns the updated Adler-32
+ */
+uint32_t libgzipf_deflate_update_adler32_neon(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size )
+{
+	uint8x16_t data_bytes1         = vdupq_n_u8( 0 );
+	uint8x16_t data_bytes2         = vdupq_n_u8( 0 );
+	uint16x8_t column_sums1        = vdupq_n_u16( 0 );
+	uint16x8_t column_sums2        = vdupq_n_u16( 0 );
+	uint16x8_t column_sums3        = vdupq_n_u16( 0 );
+	uint16x8_t column_sums4        = vdupq_n_u16( 0 );
+	uint32x4_t lower_word_vector   = vdupq_n_u32( 0 );
+	uint32x4_t upper_word_vector   = vdupq_n_u32( 0 );
+	uint32x2_t sums_vector         = vdup_n_u32( 0 );
+
+	size_t number_of_blocks        = 0;
+	uint32_t block_index           = 0;
+	uint32_t lower_word            = 0;
+	uint32_t number_of_loop_blocks = 0;
+	uint32_t upper_word            = 0;
+
+	lower_word = checksum & 0xffff;
+	upper_word = ( checksum >> 16 ) & 0xffff;
+
+	number_of_blocks = data_size / 32;
+	data_size       %= 32;
+
+	while( number_of_blocks > 0 )
+	{
+		number_of_loop_blocks = 173;
+
+		if( number_of_blocks < 173 )
+		{
+			number_of_loop_blocks = (uint32_t) number_of_blocks;
+		}
+		number_of_blocks -= number_of_loop_blocks;
+
+		/* The upper word vector contains the previous sums until the
+		 * weighted column sums are added
+		 */
+		upper_word_vector = vsetq_lane_u32(
+		                     lower_word * number_of_loop_blocks,
+		                     vdupq_n_u32( 0 ),
+		                     0 );
+		lower_word_vector = vdupq_n_u32( 0 );
+
+		column_sums1 = vdupq_n_u16( 0 );
+		column_sums2 = vdupq_n_u16( 0 );
+		column_sums3 = vdupq_n_u16( 0 );
+		column_sums4 = vdupq_n_u16( 0 );
+
+		for( block_index = 0;
+		     block_index < number_of_loop_blocks;
+		     block_index++ )
+		{
+			data_bytes1 = vld1q_u8(
+			               data );
+			data_bytes2 = vld1q_u8(
+			               &( data[ 16 ] ) );
+
+			upper_word_vector = vaddq_u32(
+			                     upper_word_vector,
+			                     lower_word_vector );
+
+			lower_word_vector = vpadalq_u16(
+			                     lower_word_vector,
+			                     vpadalq_u8(
+			                      vpaddlq_u8(
+			                       data_bytes1 ),
+			                      data_bytes2 ) );
+
+			column_sums1 = vaddw_u8(
+			                column_sums1,
+			                vget_low_u8(
+			                 data_bytes1 ) );
+			column_sums2 = vaddw_u8(
+			                column_sums2,
+			                vget_high_u8(
+			                 data_bytes1 ) );
+			column_sums3 = vaddw_u8(
+			                column_sums3,
+			                vget_low_u8(
+			                 data_bytes2 ) );
+			column_sums4 = vaddw_u8(
+			                column_sums4,
+			                vget_high_u8(
+			                 data_bytes2 ) );
+
+			data += 32;
+		}
+		upper_word_vector = vshlq_n_u32(
+		                     upper_word_vector,
+		                     5 );
+
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_low_u16(
+		                      column_sums1 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 0 ] ) ) );
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_high_u16(
+		                      column_sums1 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 4 ] ) ) );
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_low_u16(
+		                      column_sums2 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 8 ] ) ) );
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_high_u16(
+		                      column_sums2 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 12 ] ) ) );
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_low_u16(
+		                      column_sums3 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 16 ] ) ) );
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_high_u16(
+		                      column_sums3 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 20 ] ) ) );
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_low_u16(
+		                      column_sums4 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 24 ] ) ) );
+		upper_word_vector = vmlal_u16(
+		                     upper_word_vector,
+		                     vget_high_u16(
+		                      column_sums4 ),
+		                     vld1_u16(
+		                      &( libgzipf_deflate_adler32_neon_weights[ 28 ] ) ) );
+
+		sums_vector = vpadd_u32(
+		               vpadd_u32(
+		                vget_low_u32(
+		                 lower_word_vector ),
+		                vget_high_u32(
+		                 lower_word_vector ) ),
+		               vpadd_u32(
+		                vget_low_u32(
+		                 upper_word_vector ),
+		                vget_high_u32(
+		                 upper_word_vector ) ) );
+
+		lower_word += vget_lane_u32(
+		               sums_vector,
+		               0 );
+		upper_word += vget_lane_u32(
+		               sums_vector,
+		               1 );
+
+		lower_word %= 65521;
+		upper_word %= 65521;
+	}
+	checksum = ( upper_word << 16 ) | lower_word;
+
+	if( data_size > 0 )
+	{
+		checksum = libgzipf_deflate_update_adler32_scalar(
+		            checksum,
+		            data,
+		            data_size );
+	}
+	return( checksum );
+}
+
+#endif /* defined( LIBGZIPF_CPU_HAVE_NEON ) */
+
+/* Calculates the little-endian Adler-32 of a buffer
+ * It uses the initial value to calculate a new Adler-32
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_deflate_calculate_adler32(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_deflate_calculate_adler32";
+	uint32_t checksum     = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_deflate_adler32_kernel == LIBGZIPF_DEFLATE_ADLER32_KERNEL_UNDETERMINED )
+	{
+		libgzipf_deflate_adler32_kernel = libgzipf_deflate_determine_adler32_kernel();
+	}
+	switch( libgzipf_deflate_adler32_kernel )
+	{
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
+		case LIBGZIPF_DEFLATE_ADLER32_KERNEL_AVX2:
+			checksum = libgzipf_deflate_update_adler32_avx2(
+			            initial_value,
+			            data,
+			            data_size );
+			break;
+
+		case LIBGZIPF_DEFLATE_ADLER32_KERNEL_SSSE3:
+			checksum = libgzipf_deflate_update_adler32_ssse3(
+			            initial_value,
+			            data,
+			            data_size );
+			break;
+#endif
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+		case LIBGZIPF_DEFLATE_ADLER32_KERNEL_NEON:
+			checksum = libgzipf_deflate_update_adler32_neon(
+			            initial_value,
+			            data,
+			            data_size );
+			break;
+#endif
+		default:
+			checksum = libgzipf_deflate_update_adler32_scalar(
+			            initial_value,
+			            data,
+			            data_size );
+			break;
 	}
-	*checksum_value = ( upper_word << 16 ) | lower_word;
+	*checksum_value = checksum;
 
 	return( 1 );
 }
@@ -1122,14 +2559,132 @@ int libgzipf_deflate_read_block_header(
 	return( 1 );
 }
 
+/* Determines the data range of a stored (uncompressed) block from its block header
+ * The number of bits is the number of unused bits of the first byte, where the block
+ * header starts in the most significant of these bits, or 0 if the block header starts
+ * at the first bit of the first byte
+ * Returns 1 if the block is a stored block, 0 if not or -1 on error
+ */
+int libgzipf_deflate_get_stored_block_data_range(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t number_of_bits,
+     size_t *block_data_offset,
+     size_t *block_data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libgzipf_deflate_get_stored_block_data_range";
+	size_t data_offset      = 0;
+	uint16_t block_size     = 0;
+	uint16_t block_size_xor = 0;
+	uint16_t header_value   = 0;
+	uint8_t bit_offset      = 0;
+	uint8_t block_type      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 7 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 0 )
+	{
+		bit_offset = 8 - number_of_bits;
+	}
+	/* The 3-bit block header is followed by padding up to the next byte boundary
+	 * and the 16-bit block size and its 1's complement
+	 */
+	data_offset = ( (size_t) bit_offset + 3 + 7 ) / 8;
+
+	if( data_size < ( data_offset + 4 ) )
+	{
+		return( 0 );
+	}
+	header_value = data[ 0 ];
+
+	if( data_offset > 1 )
+	{
+		header_value |= (uint16_t) data[ 1 ] << 8;
+	}
+	block_type = (uint8_t) ( ( header_value >> ( bit_offset + 1 ) ) & 0x0003 );
+
+	if( block_type != LIBGZIPF_DEFLATE_BLOCK_TYPE_UNCOMPRESSED )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ data_offset ] ),
+	 block_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ data_offset + 2 ] ),
+	 block_size_xor );
+
+	if( ( block_size ^ block_size_xor ) != 0xffff )
+	{
+		return( 0 );
+	}
+	*block_data_offset = data_offset + 4;
+	*block_data_size   = (size_t) block_size;
+
+	return( 1 );
+}
+
 /* Reads a block of compressed data
  * Returns 1 on success or -1 on error
  */
 int libgzipf_deflate_read_block(
      libgzipf_bit_stream_t *bit_stream,
      uint8_t block_type,
-     libgzipf_huffman_tree_t *fixed_huffman_literals_tree,
-     libgzipf_huffman_tree_t *fixed_huffman_distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
@@ -1215,6 +2770,16 @@ int libgzipf_deflate_read_block(
 					goto on_error;
 				}
 			}
+			/* Return the bytes that were read ahead into the bit buffer
+			 * since the uncompressed data is copied from the byte stream
+			 */
+			while( bit_stream->bit_buffer_size >= 8 )
+			{
+				bit_stream->byte_stream_offset -= 1;
+				bit_stream->bit_buffer_size    -= 8;
+			}
+			bit_stream->bit_buffer = 0;
+
 			if( libgzipf_bit_stream_get_value(
 			     bit_stream,
 			     32,
@@ -1297,10 +2862,8 @@ int libgzipf_deflate_read_block(
 			break;
 
 		case LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
-			if( libgzipf_deflate_decode_huffman(
+			if( libgzipf_deflate_decode_fixed_huffman(
 			     bit_stream,
-			     fixed_huffman_literals_tree,
-			     fixed_huffman_distances_tree,
 			     uncompressed_data,
 			     uncompressed_data_size,
 			     &safe_uncompressed_data_offset,
@@ -1452,15 +3015,13 @@ int libgzipf_deflate_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	libgzipf_bit_stream_t *bit_stream                     = NULL;
-	libgzipf_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	libgzipf_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                                 = "libgzipf_deflate_decompress";
-	size_t compressed_data_offset                         = 0;
-	size_t safe_uncompressed_data_size                    = 0;
-	size_t uncompressed_data_offset                       = 0;
-	uint8_t block_type                                    = 0;
-	uint8_t last_block_flag                               = 0;
+	libgzipf_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "libgzipf_deflate_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -1547,8 +3108,22 @@ int libgzipf_deflate_decompress(
 
 		goto on_error;
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	/* The bit buffer can hold the final blocks after all compressed data was read
+	 */
+	while( last_block_flag == 0 )
 	{
+		if( ( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
+		 && ( bit_stream->bit_buffer_size < 3 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small - missing final block.",
+			 function );
+
+			goto on_error;
+		}
 		if( libgzipf_deflate_read_block_header(
 		     bit_stream,
 		     &block_type,
@@ -1564,62 +3139,9 @@ int libgzipf_deflate_decompress(
 
 			goto on_error;
 		}
-		if( block_type == LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( libgzipf_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libgzipf_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libgzipf_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
 		if( libgzipf_deflate_read_block(
 		     bit_stream,
 		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
 		     uncompressed_data,
 		     safe_uncompressed_data_size,
 		     &uncompressed_data_offset,
@@ -1634,42 +3156,6 @@ int libgzipf_deflate_decompress(
 
 			goto on_error;
 		}
-		if( last_block_flag != 0 )
-		{
-			break;
-		}
-	}
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		if( libgzipf_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		if( libgzipf_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
 	}
 	if( libgzipf_bit_stream_free(
 	     &bit_stream,
@@ -1689,18 +3175,6 @@ int libgzipf_deflate_decompress(
 	return( 1 );
 
 on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libgzipf_bit_stream_free(
@@ -1720,17 +3194,15 @@ int libgzipf_deflate_decompress_zlib(
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	libgzipf_bit_stream_t *bit_stream                     = NULL;
-	libgzipf_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	libgzipf_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                                 = "libgzipf_deflate_decompress_zlib";
-	size_t compressed_data_offset                         = 0;
-	size_t safe_uncompressed_data_size                    = 0;
-	size_t uncompressed_data_offset                       = 0;
-	uint32_t calculated_checksum                          = 0;
-	uint32_t stored_checksum                              = 0;
-	uint8_t block_type                                    = 0;
-	uint8_t last_block_flag                               = 0;
+	libgzipf_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "libgzipf_deflate_decompress_zlib";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t stored_checksum           = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -1832,8 +3304,22 @@ int libgzipf_deflate_decompress_zlib(
 
 		goto on_error;
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	/* The bit buffer can hold the final blocks after all compressed data was read
+	 */
+	while( last_block_flag == 0 )
 	{
+		if( ( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
+		 && ( bit_stream->bit_buffer_size < 3 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small - missing final block.",
+			 function );
+
+			goto on_error;
+		}
 		if( libgzipf_deflate_read_block_header(
 		     bit_stream,
 		     &block_type,
@@ -1849,62 +3335,9 @@ int libgzipf_deflate_decompress_zlib(
 
 			goto on_error;
 		}
-		if( block_type == LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( libgzipf_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libgzipf_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libgzipf_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
 		if( libgzipf_deflate_read_block(
 		     bit_stream,
 		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
 		     uncompressed_data,
 		     safe_uncompressed_data_size,
 		     &uncompressed_data_offset,
@@ -1919,18 +3352,32 @@ int libgzipf_deflate_decompress_zlib(
 
 			goto on_error;
 		}
-		if( last_block_flag != 0 )
-		{
-			break;
-		}
+	}
+	/* Return the bytes that were read ahead into the bit buffer, the remaining
+	 * bits are the padding of the last byte of the compressed data
+	 */
+	while( bit_stream->bit_buffer_size >= 8 )
+	{
+		bit_stream->byte_stream_offset -= 1;
+		bit_stream->bit_buffer_size    -= 8;
+	}
+	bit_stream->bit_buffer      = 0;
+	bit_stream->bit_buffer_size = 0;
+
+	if( ( bit_stream->byte_stream_offset < compressed_data_offset )
+	 || ( bit_stream->byte_stream_offset > bit_stream->byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream offset value out of bounds.",
+		 function );
+
+		goto on_error;
 	}
 	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
 	{
-		while( bit_stream->bit_buffer_size >= 8 )
-		{
-			bit_stream->byte_stream_offset -= 1;
-			bit_stream->bit_buffer_size    -= 8;
-		}
 		byte_stream_copy_to_uint32_big_endian(
 		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
 		 stored_checksum );
@@ -1965,38 +3412,6 @@ int libgzipf_deflate_decompress_zlib(
 			goto on_error;
 		}
 	}
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		if( libgzipf_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		if( libgzipf_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	if( libgzipf_bit_stream_free(
 	     &bit_stream,
 	     error ) != 1 )
@@ -2015,18 +3430,6 @@ int libgzipf_deflate_decompress_zlib(
 	return( 1 );
 
 on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libgzipf_bit_stream_free(
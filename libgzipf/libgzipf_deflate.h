@@ -23,9 +23,18 @@
 #define _LIBGZIPF_DEFLATE_COMPRESSION_H
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+
 #include "libgzipf_bit_stream.h"
+#include "libgzipf_cpu.h"
+#include "libgzipf_definitions.h"
 #include "libgzipf_huffman_tree.h"
 #include "libgzipf_libcerror.h"
 
@@ -43,6 +52,121 @@ enum LIBGZIPF_DEFLATE_BLOCK_TYPES
 	LIBGZIPF_DEFLATE_BLOCK_TYPE_RESERVED		= 0x03
 };
 
+/* The Adler-32 kernels
+ */
+enum LIBGZIPF_DEFLATE_ADLER32_KERNELS
+{
+	LIBGZIPF_DEFLATE_ADLER32_KERNEL_UNDETERMINED	= 0,
+	LIBGZIPF_DEFLATE_ADLER32_KERNEL_SCALAR		= 1,
+	LIBGZIPF_DEFLATE_ADLER32_KERNEL_SSSE3		= 2,
+	LIBGZIPF_DEFLATE_ADLER32_KERNEL_AVX2		= 3,
+	LIBGZIPF_DEFLATE_ADLER32_KERNEL_NEON		= 4
+};
+
+extern const uint16_t libgzipf_deflate_literal_codes_base[ 29 ];
+
+extern const uint16_t libgzipf_deflate_literal_codes_number_of_extra_bits[ 29 ];
+
+extern const uint16_t libgzipf_deflate_distance_codes_base[ 30 ];
+
+extern const uint16_t libgzipf_deflate_distance_codes_number_of_extra_bits[ 30 ];
+
+extern const uint8_t libgzipf_deflate_match_pattern_distances[ 8 ];
+
+extern const uint32_t libgzipf_deflate_fixed_huffman_literals_lookup_table[ 512 ];
+
+extern const uint32_t libgzipf_deflate_fixed_huffman_distances_lookup_table[ 32 ];
+
+extern const libgzipf_huffman_tree_t libgzipf_deflate_fixed_huffman_literals_tree;
+
+extern const libgzipf_huffman_tree_t libgzipf_deflate_fixed_huffman_distances_tree;
+
+extern int libgzipf_deflate_adler32_kernel;
+
+/* Copies a match (back-reference) of the uncompressed data
+ * The match is copied in chunks that can write up to 15 bytes past its end,
+ * the caller is responsible for making sure the uncompressed data has sufficient slack
+ */
+static LIBGZIPF_INLINE void libgzipf_deflate_copy_match(
+     uint8_t *match_data,
+     uint16_t distance,
+     uint16_t size )
+{
+	const uint8_t *match_source = NULL;
+	uint8_t *match_end          = NULL;
+
+	match_source = match_data - distance;
+	match_end    = match_data + size;
+
+	if( distance >= 16 )
+	{
+		do
+		{
+#if defined( __SSE2__ )
+			_mm_storeu_si128(
+			 (__m128i *) match_data,
+			 _mm_loadu_si128(
+			  (const __m128i *) match_source ) );
+#elif defined( __ARM_NEON )
+			vst1q_u8(
+			 match_data,
+			 vld1q_u8(
+			  match_source ) );
+#else
+			memory_copy(
+			 match_data,
+			 match_source,
+			 16 );
+#endif
+			match_data   += 16;
+			match_source += 16;
+		}
+		while( match_data < match_end );
+	}
+	else
+	{
+		if( distance < 8 )
+		{
+			/* Expand the repeating pattern to the first 8 bytes and continue
+			 * with a distance that is a multiple of the pattern size of at least 8
+			 */
+			match_data[ 0 ] = match_source[ 0 ];
+			match_data[ 1 ] = match_source[ 1 ];
+			match_data[ 2 ] = match_source[ 2 ];
+			match_data[ 3 ] = match_source[ 3 ];
+			match_data[ 4 ] = match_source[ 4 ];
+			match_data[ 5 ] = match_source[ 5 ];
+			match_data[ 6 ] = match_source[ 6 ];
+			match_data[ 7 ] = match_source[ 7 ];
+
+			match_data   += 8;
+			match_source  = match_data - libgzipf_deflate_match_pattern_distances[ distance ];
+		}
+		while( match_data < match_end )
+		{
+			memory_copy(
+			 match_data,
+			 match_source,
+			 8 );
+
+			match_data   += 8;
+			match_source += 8;
+		}
+	}
+}
+
+int libgzipf_deflate_build_codes_lookup_table(
+     const uint8_t *code_sizes_array,
+     uint32_t *lookup_table,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_read_dynamic_code_sizes(
+     libgzipf_bit_stream_t *bit_stream,
+     uint8_t *code_sizes_array,
+     uint16_t *number_of_literal_codes,
+     uint16_t *number_of_distance_codes,
+     libcerror_error_t **error );
+
 int libgzipf_deflate_build_dynamic_huffman_trees(
      libgzipf_bit_stream_t *bit_stream,
      libgzipf_huffman_tree_t *literals_tree,
@@ -54,15 +178,65 @@ int libgzipf_deflate_build_fixed_huffman_trees(
      libgzipf_huffman_tree_t *distances_tree,
      libcerror_error_t **error );
 
+int libgzipf_deflate_decode_huffman_fast(
+     libgzipf_bit_stream_t *bit_stream,
+     const libgzipf_huffman_tree_t *literals_tree,
+     const libgzipf_huffman_tree_t *distances_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     size_t *minimum_match_offset,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_decode_fixed_huffman(
+     libgzipf_bit_stream_t *bit_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
 int libgzipf_deflate_decode_huffman(
      libgzipf_bit_stream_t *bit_stream,
-     libgzipf_huffman_tree_t *literals_tree,
-     libgzipf_huffman_tree_t *distances_tree,
+     const libgzipf_huffman_tree_t *literals_tree,
+     const libgzipf_huffman_tree_t *distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error );
 
+int libgzipf_deflate_determine_adler32_kernel(
+     void );
+
+uint32_t libgzipf_deflate_update_adler32_scalar(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size );
+
+#if defined( LIBGZIPF_CPU_HAVE_X86_64 )
+
+LIBGZIPF_CPU_TARGET_SSSE3 \
+uint32_t libgzipf_deflate_update_adler32_ssse3(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size );
+
+LIBGZIPF_CPU_TARGET_AVX2 \
+uint32_t libgzipf_deflate_update_adler32_avx2(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size );
+
+#endif /* defined( LIBGZIPF_CPU_HAVE_X86_64 ) */
+
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+
+uint32_t libgzipf_deflate_update_adler32_neon(
+          uint32_t checksum,
+          const uint8_t *data,
+          size_t data_size );
+
+#endif /* defined( LIBGZIPF_CPU_HAVE_NEON ) */
+
 int libgzipf_deflate_calculate_adler32(
      uint32_t *checksum_value,
      const uint8_t *data,
@@ -82,11 +256,17 @@ int libgzipf_deflate_read_block_header(
      uint8_t *last_block_flag,
      libcerror_error_t **error );
 
+int libgzipf_deflate_get_stored_block_data_range(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t number_of_bits,
+     size_t *block_data_offset,
+     size_t *block_data_size,
+     libcerror_error_t **error );
+
 int libgzipf_deflate_read_block(
      libgzipf_bit_stream_t *bit_stream,
      uint8_t block_type,
-     libgzipf_huffman_tree_t *fixed_huffman_literals_tree,
-     libgzipf_huffman_tree_t *fixed_huffman_distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
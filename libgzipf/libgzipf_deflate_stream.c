@@ -0,0 +1,1514 @@
+/*
+ * Deflate stream functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_bit_stream.h"
+#include "libgzipf_definitions.h"
+#include "libgzipf_deflate.h"
+#include "libgzipf_deflate_stream.h"
+#include "libgzipf_huffman_tree.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_libcnotify.h"
+
+/* Creates a deflate stream
+ * Make sure the value deflate_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_deflate_stream_initialize(
+     libgzipf_deflate_stream_t **deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_deflate_stream_initialize";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid deflate stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*deflate_stream = memory_allocate_structure(
+	                   libgzipf_deflate_stream_t );
+
+	if( *deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *deflate_stream,
+	     0,
+	     sizeof( libgzipf_deflate_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear deflate stream.",
+		 function );
+
+		memory_free(
+		 *deflate_stream );
+
+		*deflate_stream = NULL;
+
+		return( -1 );
+	}
+	( *deflate_stream )->bit_stream.storage_type = LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT;
+
+	return( 1 );
+
+on_error:
+	if( *deflate_stream != NULL )
+	{
+		memory_free(
+		 *deflate_stream );
+
+		*deflate_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_deflate_stream_free(
+     libgzipf_deflate_stream_t **deflate_stream,
+     libcerror_error_t **error )
+{
+	libgzipf_deflate_stream_huffman_trees_t *cache_entry = NULL;
+	static char *function                                = "libgzipf_deflate_stream_free";
+	int cache_entry_index                                = 0;
+	int result                                           = 1;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_stream != NULL )
+	{
+		for( cache_entry_index = 0;
+		     cache_entry_index < LIBGZIPF_MAXIMUM_CACHE_ENTRIES_DYNAMIC_HUFFMAN_TREES;
+		     cache_entry_index++ )
+		{
+			cache_entry = &( ( *deflate_stream )->dynamic_trees_cache[ cache_entry_index ] );
+
+			if( cache_entry->distances_tree != NULL )
+			{
+				if( libgzipf_huffman_tree_free(
+				     &( cache_entry->distances_tree ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free dynamic distances Huffman tree: %d.",
+					 function,
+					 cache_entry_index );
+
+					result = -1;
+				}
+			}
+			if( cache_entry->literals_tree != NULL )
+			{
+				if( libgzipf_huffman_tree_free(
+				     &( cache_entry->literals_tree ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free dynamic literals Huffman tree: %d.",
+					 function,
+					 cache_entry_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 *deflate_stream );
+
+		*deflate_stream = NULL;
+	}
+	return( result );
+}
+
+/* Resets a deflate stream to the start of a new stream
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_deflate_stream_reset(
+     libgzipf_deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_deflate_stream_reset";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream->state                   = LIBGZIPF_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	deflate_stream->block_type              = 0;
+	deflate_stream->last_block_flag         = 0;
+	deflate_stream->uncompressed_block_size = 0;
+	deflate_stream->dynamic_trees           = NULL;
+	deflate_stream->literals_tree           = NULL;
+	deflate_stream->distances_tree          = NULL;
+	deflate_stream->match_size              = 0;
+	deflate_stream->match_distance          = 0;
+
+	deflate_stream->bit_stream.byte_stream        = NULL;
+	deflate_stream->bit_stream.byte_stream_size   = 0;
+	deflate_stream->bit_stream.byte_stream_offset = 0;
+	deflate_stream->bit_stream.bit_buffer         = 0;
+	deflate_stream->bit_stream.bit_buffer_size    = 0;
+
+	return( 1 );
+}
+
+/* Sets the dynamic Huffman trees of the current block
+ * The trees are retrieved from the cache when a previous block had identical code sizes,
+ * otherwise they are built in the least recently added cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_deflate_stream_set_dynamic_huffman_trees(
+     libgzipf_deflate_stream_t *deflate_stream,
+     const uint8_t *code_sizes,
+     uint16_t number_of_literal_codes,
+     uint16_t number_of_distance_codes,
+     libcerror_error_t **error )
+{
+	libgzipf_deflate_stream_huffman_trees_t *cache_entry = NULL;
+	static char *function                                = "libgzipf_deflate_stream_set_dynamic_huffman_trees";
+	uint32_t hash                                        = 0;
+	uint16_t code_size_index                             = 0;
+	uint16_t number_of_code_sizes                        = 0;
+	int cache_entry_index                                = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_literal_codes == 0 )
+	 || ( number_of_literal_codes > 286 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of literal codes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_distance_codes > 30 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of distance codes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_code_sizes = number_of_literal_codes + number_of_distance_codes;
+
+	/* Calculate a FNV-1a hash of the code sizes
+	 */
+	hash = 0x811c9dc5UL ^ number_of_literal_codes;
+
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_sizes;
+	     code_size_index++ )
+	{
+		hash ^= code_sizes[ code_size_index ];
+		hash *= 0x01000193UL;
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < LIBGZIPF_MAXIMUM_CACHE_ENTRIES_DYNAMIC_HUFFMAN_TREES;
+	     cache_entry_index++ )
+	{
+		cache_entry = &( deflate_stream->dynamic_trees_cache[ cache_entry_index ] );
+
+		if( ( cache_entry->number_of_literal_codes == number_of_literal_codes )
+		 && ( cache_entry->number_of_distance_codes == number_of_distance_codes )
+		 && ( cache_entry->hash == hash )
+		 && ( memory_compare(
+		       cache_entry->code_sizes,
+		       code_sizes,
+		       number_of_code_sizes ) == 0 ) )
+		{
+			deflate_stream->dynamic_trees  = cache_entry;
+			deflate_stream->literals_tree  = cache_entry->literals_tree;
+			deflate_stream->distances_tree = cache_entry->distances_tree;
+
+			return( 1 );
+		}
+	}
+	cache_entry = &( deflate_stream->dynamic_trees_cache[ deflate_stream->dynamic_trees_cache_index ] );
+
+	/* Invalidate the cache entry until its trees have been built
+	 */
+	cache_entry->number_of_literal_codes = 0;
+
+	if( cache_entry->literals_tree == NULL )
+	{
+		if( libgzipf_huffman_tree_initialize(
+		     &( cache_entry->literals_tree ),
+		     288,
+		     15,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create dynamic literals Huffman tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( cache_entry->distances_tree == NULL )
+	{
+		if( libgzipf_huffman_tree_initialize(
+		     &( cache_entry->distances_tree ),
+		     30,
+		     15,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create dynamic distances Huffman tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libgzipf_huffman_tree_build(
+	     cache_entry->literals_tree,
+	     code_sizes,
+	     number_of_literal_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literals tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_huffman_tree_build(
+	     cache_entry->distances_tree,
+	     &( code_sizes[ number_of_literal_codes ] ),
+	     number_of_distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distances tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     cache_entry->code_sizes,
+	     code_sizes,
+	     number_of_code_sizes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry->hash                     = hash;
+	cache_entry->number_of_literal_codes  = number_of_literal_codes;
+	cache_entry->number_of_distance_codes = number_of_distance_codes;
+
+	deflate_stream->dynamic_trees_cache_index += 1;
+
+	if( deflate_stream->dynamic_trees_cache_index >= LIBGZIPF_MAXIMUM_CACHE_ENTRIES_DYNAMIC_HUFFMAN_TREES )
+	{
+		deflate_stream->dynamic_trees_cache_index = 0;
+	}
+	deflate_stream->dynamic_trees  = cache_entry;
+	deflate_stream->literals_tree  = cache_entry->literals_tree;
+	deflate_stream->distances_tree = cache_entry->distances_tree;
+
+	return( 1 );
+}
+
+/* Reads the dynamic Huffman trees of the current block
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_deflate_stream_read_dynamic_huffman_trees(
+     libgzipf_deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ 316 ];
+
+	static char *function             = "libgzipf_deflate_stream_read_dynamic_huffman_trees";
+	uint16_t number_of_distance_codes = 0;
+	uint16_t number_of_literal_codes  = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_deflate_read_dynamic_code_sizes(
+	     &( deflate_stream->bit_stream ),
+	     code_sizes,
+	     &number_of_literal_codes,
+	     &number_of_distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read dynamic code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_deflate_stream_set_dynamic_huffman_trees(
+	     deflate_stream,
+	     code_sizes,
+	     number_of_literal_codes,
+	     number_of_distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set dynamic Huffman trees.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes Huffman compressed data of the current block
+ * A symbol is only decoded when the bit buffer contains all the bits it can consume,
+ * unless no more compressed data follows, so that decoding can be resumed after
+ * more compressed data has been provided
+ * Returns 1 if the end of block was reached, 0 if more compressed data or uncompressed data space is needed or -1 on error
+ */
+int libgzipf_deflate_stream_decode_huffman(
+     libgzipf_deflate_stream_t *deflate_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libgzipf_bit_stream_t saved_bit_stream;
+
+	libgzipf_bit_stream_t *bit_stream = NULL;
+	static char *function             = "libgzipf_deflate_stream_decode_huffman";
+	size_t data_offset                = 0;
+	uint32_t lookup_value             = 0;
+	uint16_t compression_offset       = 0;
+	uint16_t compression_size         = 0;
+	uint16_t symbol                   = 0;
+	uint8_t code_size                 = 0;
+	uint8_t number_of_extra_bits      = 0;
+	int result                        = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( deflate_stream->literals_tree == NULL )
+	 || ( deflate_stream->distances_tree == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate stream - missing Huffman trees.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream  = &( deflate_stream->bit_stream );
+	data_offset = *uncompressed_data_offset;
+
+	/* Copy the remainder of a match that did not fit in the uncompressed data
+	 */
+	if( ( deflate_stream->match_size > 0 )
+	 && ( deflate_stream->match_distance <= data_offset )
+	 && ( ( data_offset - deflate_stream->match_distance ) < deflate_stream->minimum_match_offset ) )
+	{
+		deflate_stream->minimum_match_offset = data_offset - deflate_stream->match_distance;
+	}
+	while( ( deflate_stream->match_size > 0 )
+	    && ( data_offset < uncompressed_data_size ) )
+	{
+		uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - deflate_stream->match_distance ];
+
+		data_offset++;
+		deflate_stream->match_size--;
+	}
+	if( deflate_stream->match_size > 0 )
+	{
+		*uncompressed_data_offset = data_offset;
+
+		return( 0 );
+	}
+	result = libgzipf_deflate_decode_huffman_fast(
+	          bit_stream,
+	          deflate_stream->literals_tree,
+	          deflate_stream->distances_tree,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          &data_offset,
+	          &( deflate_stream->minimum_match_offset ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode Huffman compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Decode the remainder near the end of the compressed or uncompressed data
+	 */
+	while( result == 0 )
+	{
+		/* A single symbol consumes at most 48 bits
+		 */
+		if( bit_stream->bit_buffer_size < 48 )
+		{
+			libgzipf_bit_stream_refill(
+			 bit_stream );
+
+			if( ( bit_stream->bit_buffer_size < 48 )
+			 && ( ( flags & LIBGZIPF_DEFLATE_STREAM_FLAG_FINAL_INPUT ) == 0 ) )
+			{
+				break;
+			}
+		}
+		lookup_value = libgzipf_huffman_tree_get_lookup_value(
+		                deflate_stream->literals_tree,
+		                bit_stream );
+
+		code_size = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		if( ( code_size == 0 )
+		 || ( code_size > bit_stream->bit_buffer_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid literal Huffman code.",
+			 function );
+
+			goto on_error;
+		}
+		symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
+		/* The end of block symbol is still consumed when the uncompressed data is full
+		 */
+		if( ( symbol != 256 )
+		 && ( data_offset >= uncompressed_data_size ) )
+		{
+			break;
+		}
+		/* Keep the bit stream state so that a match that does not fit can be decoded again
+		 */
+		saved_bit_stream = *bit_stream;
+
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 code_size );
+
+		if( symbol < 256 )
+		{
+			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		if( symbol == 256 )
+		{
+			result = 1;
+
+			break;
+		}
+		if( symbol >= 286 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid code value: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			goto on_error;
+		}
+		symbol -= 257;
+
+		number_of_extra_bits = (uint8_t) libgzipf_deflate_literal_codes_number_of_extra_bits[ symbol ];
+
+		if( number_of_extra_bits > bit_stream->bit_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		compression_size = libgzipf_deflate_literal_codes_base[ symbol ] + (uint16_t) libgzipf_bit_stream_peek( bit_stream, number_of_extra_bits );
+
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 number_of_extra_bits );
+
+		lookup_value = libgzipf_huffman_tree_get_lookup_value(
+		                deflate_stream->distances_tree,
+		                bit_stream );
+
+		code_size = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		if( ( code_size == 0 )
+		 || ( code_size > bit_stream->bit_buffer_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance Huffman code.",
+			 function );
+
+			goto on_error;
+		}
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 code_size );
+
+		symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
+		if( symbol >= 30 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance code value: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			goto on_error;
+		}
+		number_of_extra_bits = (uint8_t) libgzipf_deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+		if( number_of_extra_bits > bit_stream->bit_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		compression_offset = libgzipf_deflate_distance_codes_base[ symbol ] + (uint16_t) libgzipf_bit_stream_peek( bit_stream, number_of_extra_bits );
+
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 number_of_extra_bits );
+
+		if( compression_offset > data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compression offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( ( flags & LIBGZIPF_DEFLATE_STREAM_FLAG_STOP_BEFORE_PARTIAL_MATCH ) != 0 )
+		 && ( (size_t) compression_size > ( uncompressed_data_size - data_offset ) ) )
+		{
+			*bit_stream = saved_bit_stream;
+
+			break;
+		}
+		if( ( data_offset - compression_offset ) < deflate_stream->minimum_match_offset )
+		{
+			deflate_stream->minimum_match_offset = data_offset - compression_offset;
+		}
+		while( ( compression_size > 0 )
+		    && ( data_offset < uncompressed_data_size ) )
+		{
+			uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+
+			data_offset++;
+			compression_size--;
+		}
+		/* Keep the remainder of the match for when more uncompressed data space is provided
+		 */
+		if( compression_size > 0 )
+		{
+			deflate_stream->match_size     = compression_size;
+			deflate_stream->match_distance = compression_offset;
+
+			break;
+		}
+	}
+	*uncompressed_data_offset = data_offset;
+
+	return( result );
+
+on_error:
+	*uncompressed_data_offset = data_offset;
+
+	return( -1 );
+}
+
+/* Retrieves the state of the current Huffman compressed block
+ * The block state consists of the block type, the last block flag, the number of
+ * literal and distance codes and the code sizes of a dynamic Huffman block
+ * Returns 1 if successful, 0 if the deflate stream is not in the middle
+ * of a Huffman compressed block where decoding can be resumed or -1 on error
+ */
+int libgzipf_deflate_stream_get_block_state(
+     libgzipf_deflate_stream_t *deflate_stream,
+     uint8_t *block_state_data,
+     size_t block_state_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "libgzipf_deflate_stream_get_block_state";
+	size_t safe_data_size             = 5;
+	uint16_t number_of_distance_codes = 0;
+	uint16_t number_of_literal_codes  = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_state_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block state data.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_state_data_size < (size_t) LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid block state data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The remainder of a match cannot be resumed from the block state
+	 */
+	if( ( deflate_stream->state != LIBGZIPF_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK_DATA )
+	 || ( deflate_stream->match_size > 0 ) )
+	{
+		return( 0 );
+	}
+	if( deflate_stream->block_type == LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC )
+	{
+		if( deflate_stream->dynamic_trees == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid deflate stream - missing dynamic Huffman trees.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_literal_codes  = deflate_stream->dynamic_trees->number_of_literal_codes;
+		number_of_distance_codes = deflate_stream->dynamic_trees->number_of_distance_codes;
+
+		safe_data_size += (size_t) number_of_literal_codes + (size_t) number_of_distance_codes;
+
+		if( memory_copy(
+		     &( block_state_data[ 5 ] ),
+		     deflate_stream->dynamic_trees->code_sizes,
+		     safe_data_size - 5 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy code sizes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	block_state_data[ 0 ] = deflate_stream->block_type;
+	block_state_data[ 1 ] = deflate_stream->last_block_flag;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( block_state_data[ 2 ] ),
+	 number_of_literal_codes );
+
+	block_state_data[ 4 ] = (uint8_t) number_of_distance_codes;
+
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Sets the state of a Huffman compressed block to resume decoding from
+ * The bit buffer is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_deflate_stream_set_block_state(
+     libgzipf_deflate_stream_t *deflate_stream,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "libgzipf_deflate_stream_set_block_state";
+	uint16_t number_of_distance_codes = 0;
+	uint16_t number_of_literal_codes  = 0;
+	uint8_t block_type                = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_state_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block state data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_state_data_size < 5 )
+	 || ( block_state_data_size > (size_t) LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block state data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_type = block_state_data[ 0 ];
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( block_state_data[ 2 ] ),
+	 number_of_literal_codes );
+
+	number_of_distance_codes = block_state_data[ 4 ];
+
+	if( block_type == LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
+	{
+		if( block_state_data_size != 5 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block state data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		deflate_stream->dynamic_trees  = NULL;
+		deflate_stream->literals_tree  = &libgzipf_deflate_fixed_huffman_literals_tree;
+		deflate_stream->distances_tree = &libgzipf_deflate_fixed_huffman_distances_tree;
+	}
+	else if( block_type == LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC )
+	{
+		if( block_state_data_size != ( 5 + (size_t) number_of_literal_codes + (size_t) number_of_distance_codes ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block state data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libgzipf_deflate_stream_set_dynamic_huffman_trees(
+		     deflate_stream,
+		     &( block_state_data[ 5 ] ),
+		     number_of_literal_codes,
+		     number_of_distance_codes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set dynamic Huffman trees.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block type: %" PRIu8 ".",
+		 function,
+		 block_type );
+
+		return( -1 );
+	}
+	deflate_stream->state           = LIBGZIPF_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK_DATA;
+	deflate_stream->block_type      = block_type;
+	deflate_stream->last_block_flag = (uint8_t) ( block_state_data[ 1 ] != 0 );
+	deflate_stream->match_size      = 0;
+	deflate_stream->match_distance  = 0;
+
+	return( 1 );
+}
+
+/* Decompresses data of a deflate stream
+ * The compressed data can be provided in parts, the bits that were read into the bit buffer
+ * are retained in the deflate stream so the compressed data offset only moves forward
+ * The uncompressed data before the uncompressed data offset is used for distance codes
+ * Returns 1 if the end of the stream, or the end of a block when requested, was reached,
+ * 0 if more compressed data or uncompressed data space is needed or -1 on error
+ */
+int libgzipf_deflate_stream_decompress(
+     libgzipf_deflate_stream_t *deflate_stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libgzipf_bit_stream_t *bit_stream = NULL;
+	static char *function             = "libgzipf_deflate_stream_decompress";
+	size_t copy_size                  = 0;
+	size_t data_offset                = 0;
+	uint32_t block_size               = 0;
+	uint32_t block_size_copy          = 0;
+	uint32_t value_32bit              = 0;
+	uint8_t end_of_block              = 0;
+	uint8_t need_input                = 0;
+	int result                        = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = &( deflate_stream->bit_stream );
+
+	bit_stream->byte_stream        = compressed_data;
+	bit_stream->byte_stream_size   = compressed_data_size;
+	bit_stream->byte_stream_offset = *compressed_data_offset;
+
+	data_offset = *uncompressed_data_offset;
+
+	deflate_stream->minimum_match_offset = data_offset;
+
+	while( result == 0 )
+	{
+		end_of_block = 0;
+
+		switch( deflate_stream->state )
+		{
+			case LIBGZIPF_DEFLATE_STREAM_STATE_BLOCK_HEADER:
+				if( bit_stream->bit_buffer_size < 3 )
+				{
+					libgzipf_bit_stream_refill(
+					 bit_stream );
+
+					if( bit_stream->bit_buffer_size < 3 )
+					{
+						need_input = 1;
+
+						break;
+					}
+				}
+				value_32bit = libgzipf_bit_stream_peek(
+				               bit_stream,
+				               3 );
+
+				libgzipf_bit_stream_consume(
+				 bit_stream,
+				 3 );
+
+				deflate_stream->last_block_flag = (uint8_t) ( value_32bit & 0x00000001UL );
+				deflate_stream->block_type      = (uint8_t) ( value_32bit >> 1 );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: block header last block flag\t: %" PRIu8 "\n",
+					 function,
+					 deflate_stream->last_block_flag );
+
+					libcnotify_printf(
+					 "%s: block header block type\t\t: %" PRIu8 "\n",
+					 function,
+					 deflate_stream->block_type );
+
+					libcnotify_printf(
+					 "\n" );
+				}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+				switch( deflate_stream->block_type )
+				{
+					case LIBGZIPF_DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+						deflate_stream->state = LIBGZIPF_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER;
+						break;
+
+					case LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+						deflate_stream->dynamic_trees  = NULL;
+						deflate_stream->literals_tree  = &libgzipf_deflate_fixed_huffman_literals_tree;
+						deflate_stream->distances_tree = &libgzipf_deflate_fixed_huffman_distances_tree;
+						deflate_stream->state          = LIBGZIPF_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK_DATA;
+						break;
+
+					case LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+						deflate_stream->state = LIBGZIPF_DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_HEADER;
+						break;
+
+					case LIBGZIPF_DEFLATE_BLOCK_TYPE_RESERVED:
+					default:
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+						 "%s: unsupported block type.",
+						 function );
+
+						goto on_error;
+				}
+				break;
+
+			case LIBGZIPF_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER:
+				/* Ignore the bits in the buffer upto the next byte
+				 */
+				libgzipf_bit_stream_consume(
+				 bit_stream,
+				 bit_stream->bit_buffer_size & 0x07 );
+
+				if( bit_stream->bit_buffer_size < 32 )
+				{
+					libgzipf_bit_stream_refill(
+					 bit_stream );
+
+					if( bit_stream->bit_buffer_size < 32 )
+					{
+						need_input = 1;
+
+						break;
+					}
+				}
+				block_size = libgzipf_bit_stream_peek(
+				              bit_stream,
+				              32 );
+
+				libgzipf_bit_stream_consume(
+				 bit_stream,
+				 32 );
+
+				block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
+				block_size     &= 0x0000ffffUL;
+
+				if( block_size != block_size_copy )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
+					 function,
+					 block_size,
+					 block_size_copy );
+
+					goto on_error;
+				}
+				deflate_stream->uncompressed_block_size = (uint16_t) block_size;
+				deflate_stream->state                   = LIBGZIPF_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA;
+
+				break;
+
+			case LIBGZIPF_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA:
+				/* Copy the bytes that were read ahead into the bit buffer first
+				 */
+				while( ( deflate_stream->uncompressed_block_size > 0 )
+				    && ( bit_stream->bit_buffer_size >= 8 )
+				    && ( data_offset < uncompressed_data_size ) )
+				{
+					uncompressed_data[ data_offset++ ] = (uint8_t) libgzipf_bit_stream_peek(
+					                                                bit_stream,
+					                                                8 );
+
+					libgzipf_bit_stream_consume(
+					 bit_stream,
+					 8 );
+
+					deflate_stream->uncompressed_block_size -= 1;
+				}
+				if( bit_stream->bit_buffer_size == 0 )
+				{
+					copy_size = (size_t) deflate_stream->uncompressed_block_size;
+
+					if( copy_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
+					{
+						copy_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+					}
+					if( copy_size > ( uncompressed_data_size - data_offset ) )
+					{
+						copy_size = uncompressed_data_size - data_offset;
+					}
+					if( copy_size > 0 )
+					{
+						if( memory_copy(
+						     &( uncompressed_data[ data_offset ] ),
+						     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+						     copy_size ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to copy uncompressed block data.",
+							 function );
+
+							goto on_error;
+						}
+						bit_stream->byte_stream_offset          += copy_size;
+						data_offset                             += copy_size;
+						deflate_stream->uncompressed_block_size -= (uint16_t) copy_size;
+					}
+				}
+				if( deflate_stream->uncompressed_block_size == 0 )
+				{
+					end_of_block = 1;
+				}
+				else if( data_offset < uncompressed_data_size )
+				{
+					need_input = 1;
+				}
+				break;
+
+			case LIBGZIPF_DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_HEADER:
+				/* Only read the header when it is completely available
+				 */
+				if( ( ( flags & LIBGZIPF_DEFLATE_STREAM_FLAG_FINAL_INPUT ) == 0 )
+				 && ( ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) + ( bit_stream->bit_buffer_size / 8 ) ) < LIBGZIPF_DEFLATE_MAXIMUM_DYNAMIC_HEADER_SIZE ) )
+				{
+					need_input = 1;
+
+					break;
+				}
+				if( libgzipf_deflate_stream_read_dynamic_huffman_trees(
+				     deflate_stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to read dynamic Huffman trees.",
+					 function );
+
+					goto on_error;
+				}
+				deflate_stream->state = LIBGZIPF_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK_DATA;
+
+				break;
+
+			case LIBGZIPF_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK_DATA:
+				result = libgzipf_deflate_stream_decode_huffman(
+				          deflate_stream,
+				          uncompressed_data,
+				          uncompressed_data_size,
+				          &data_offset,
+				          flags,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to decode Huffman compressed block.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					/* The Huffman decoder only stops without the final input flag set
+					 * when more compressed data or uncompressed data space is needed
+					 */
+					*compressed_data_offset   = bit_stream->byte_stream_offset;
+					*uncompressed_data_offset = data_offset;
+
+					return( 0 );
+				}
+				result       = 0;
+				end_of_block = 1;
+
+				break;
+
+			case LIBGZIPF_DEFLATE_STREAM_STATE_END_OF_STREAM:
+				result = 1;
+
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid deflate stream - unsupported state.",
+				 function );
+
+				goto on_error;
+		}
+		if( end_of_block != 0 )
+		{
+			deflate_stream->dynamic_trees  = NULL;
+			deflate_stream->literals_tree  = NULL;
+			deflate_stream->distances_tree = NULL;
+
+			if( deflate_stream->last_block_flag != 0 )
+			{
+				deflate_stream->state = LIBGZIPF_DEFLATE_STREAM_STATE_END_OF_STREAM;
+
+				result = 1;
+			}
+			else
+			{
+				deflate_stream->state = LIBGZIPF_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+
+				if( ( flags & LIBGZIPF_DEFLATE_STREAM_FLAG_STOP_AT_END_OF_BLOCK ) != 0 )
+				{
+					result = 1;
+				}
+			}
+		}
+		else if( need_input != 0 )
+		{
+			if( ( flags & LIBGZIPF_DEFLATE_STREAM_FLAG_FINAL_INPUT ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		else if( data_offset >= uncompressed_data_size )
+		{
+			break;
+		}
+	}
+	*compressed_data_offset   = bit_stream->byte_stream_offset;
+	*uncompressed_data_offset = data_offset;
+
+	return( result );
+
+on_error:
+	*compressed_data_offset   = bit_stream->byte_stream_offset;
+	*uncompressed_data_offset = data_offset;
+
+	return( -1 );
+}
+
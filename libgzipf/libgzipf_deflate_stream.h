@@ -0,0 +1,215 @@
+/*
+ * Deflate stream functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_DEFLATE_STREAM_H )
+#define _LIBGZIPF_DEFLATE_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_bit_stream.h"
+#include "libgzipf_definitions.h"
+#include "libgzipf_huffman_tree.h"
+#include "libgzipf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The deflate stream states
+ */
+enum LIBGZIPF_DEFLATE_STREAM_STATES
+{
+	LIBGZIPF_DEFLATE_STREAM_STATE_BLOCK_HEADER		= 0x00,
+	LIBGZIPF_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER	= 0x01,
+	LIBGZIPF_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA	= 0x02,
+	LIBGZIPF_DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_HEADER	= 0x03,
+	LIBGZIPF_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK_DATA	= 0x04,
+	LIBGZIPF_DEFLATE_STREAM_STATE_END_OF_STREAM		= 0x05
+};
+
+/* The deflate stream decompress flags
+ */
+enum LIBGZIPF_DEFLATE_STREAM_FLAGS
+{
+	/* No more compressed data follows the compressed data provided
+	 */
+	LIBGZIPF_DEFLATE_STREAM_FLAG_FINAL_INPUT		= 0x01,
+
+	/* Stop decompressing at the end of every block
+	 */
+	LIBGZIPF_DEFLATE_STREAM_FLAG_STOP_AT_END_OF_BLOCK	= 0x02,
+
+	/* Stop decompressing before a match that does not fit in the uncompressed data
+	 */
+	LIBGZIPF_DEFLATE_STREAM_FLAG_STOP_BEFORE_PARTIAL_MATCH	= 0x04
+};
+
+typedef struct libgzipf_deflate_stream_huffman_trees libgzipf_deflate_stream_huffman_trees_t;
+
+struct libgzipf_deflate_stream_huffman_trees
+{
+	/* The hash of the code sizes
+	 */
+	uint32_t hash;
+
+	/* The number of literal codes, 0 if the entry is not set
+	 */
+	uint16_t number_of_literal_codes;
+
+	/* The number of distance codes
+	 */
+	uint16_t number_of_distance_codes;
+
+	/* The code sizes of the literal codes followed by the distance codes
+	 */
+	uint8_t code_sizes[ 316 ];
+
+	/* The Huffman literals tree
+	 */
+	libgzipf_huffman_tree_t *literals_tree;
+
+	/* The Huffman distances tree
+	 */
+	libgzipf_huffman_tree_t *distances_tree;
+};
+
+typedef struct libgzipf_deflate_stream libgzipf_deflate_stream_t;
+
+struct libgzipf_deflate_stream
+{
+	/* The state
+	 */
+	uint8_t state;
+
+	/* The bit stream
+	 * The bit buffer is retained between calls to decompress
+	 */
+	libgzipf_bit_stream_t bit_stream;
+
+	/* The block type
+	 */
+	uint8_t block_type;
+
+	/* The last block flag
+	 */
+	uint8_t last_block_flag;
+
+	/* The remaining size of the uncompressed block
+	 */
+	uint16_t uncompressed_block_size;
+
+	/* The dynamic Huffman trees cache
+	 * The trees are reused for dynamic Huffman blocks with identical code sizes
+	 */
+	libgzipf_deflate_stream_huffman_trees_t dynamic_trees_cache[ LIBGZIPF_MAXIMUM_CACHE_ENTRIES_DYNAMIC_HUFFMAN_TREES ];
+
+	/* The index of the next dynamic Huffman trees cache entry to replace
+	 */
+	int dynamic_trees_cache_index;
+
+	/* The dynamic Huffman trees cache entry of the current block
+	 */
+	libgzipf_deflate_stream_huffman_trees_t *dynamic_trees;
+
+	/* The Huffman literals tree of the current block
+	 */
+	const libgzipf_huffman_tree_t *literals_tree;
+
+	/* The Huffman distances tree of the current block
+	 */
+	const libgzipf_huffman_tree_t *distances_tree;
+
+	/* The remaining size of a match that did not fit in the uncompressed data
+	 */
+	uint16_t match_size;
+
+	/* The distance of a match that did not fit in the uncompressed data
+	 */
+	uint16_t match_distance;
+
+	/* The lowest offset in the uncompressed data referred to by a distance code
+	 * during the last decompress, or its initial uncompressed data offset if lower
+	 */
+	size_t minimum_match_offset;
+};
+
+int libgzipf_deflate_stream_initialize(
+     libgzipf_deflate_stream_t **deflate_stream,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_free(
+     libgzipf_deflate_stream_t **deflate_stream,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_reset(
+     libgzipf_deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_set_dynamic_huffman_trees(
+     libgzipf_deflate_stream_t *deflate_stream,
+     const uint8_t *code_sizes,
+     uint16_t number_of_literal_codes,
+     uint16_t number_of_distance_codes,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_read_dynamic_huffman_trees(
+     libgzipf_deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_decode_huffman(
+     libgzipf_deflate_stream_t *deflate_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_get_block_state(
+     libgzipf_deflate_stream_t *deflate_stream,
+     uint8_t *block_state_data,
+     size_t block_state_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_set_block_state(
+     libgzipf_deflate_stream_t *deflate_stream,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_deflate_stream_decompress(
+     libgzipf_deflate_stream_t *deflate_stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_DEFLATE_STREAM_H ) */
+
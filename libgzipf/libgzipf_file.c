@@ -29,18 +29,16 @@
 #include <string.h>
 #endif
 
-#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
-#include <zlib.h>
-#endif
-
-#include "libgzipf_bit_stream.h"
 #include "libgzipf_checksum.h"
 #include "libgzipf_compressed_segment.h"
+#include "libgzipf_cpu.h"
 #include "libgzipf_debug.h"
 #include "libgzipf_definitions.h"
+#include "libgzipf_decoder.h"
 #include "libgzipf_deflate.h"
 #include "libgzipf_file.h"
 #include "libgzipf_huffman_tree.h"
+#include "libgzipf_index.h"
 #include "libgzipf_io_handle.h"
 #include "libgzipf_libbfio.h"
 #include "libgzipf_libcdata.h"
@@ -54,6 +52,7 @@
 #include "libgzipf_member_footer.h"
 #include "libgzipf_member_header.h"
 #include "libgzipf_segment_descriptor.h"
+#include "libgzipf_sequential_reader.h"
 #include "libgzipf_types.h"
 
 /* Creates a file
@@ -158,6 +157,14 @@ int libgzipf_file_initialize(
 
 		goto on_error;
 	}
+	internal_file->maximum_segment_compressed_data_size   = LIBGZIPF_COMPRESSED_SEGMENT_SIZE;
+	internal_file->maximum_segment_uncompressed_data_size = LIBGZIPF_UNCOMPRESSED_SEGMENT_SIZE;
+
+	/* Determine the CPU features before the index builder and checksum verifier
+	 * threads can use them
+	 */
+	libgzipf_cpu_get_features();
+
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_file->read_write_lock ),
@@ -338,19 +345,18 @@ int libgzipf_file_signal_abort(
 	return( 1 );
 }
 
-/* Opens a file
+/* Sets the decoder
+ * The decoder can only be set before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libgzipf_file_open(
+int libgzipf_file_set_decoder(
      libgzipf_file_t *file,
-     const char *filename,
-     int access_flags,
+     int decoder,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle        = NULL;
 	libgzipf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libgzipf_file_open";
-	size_t filename_length                  = 0;
+	static char *function                   = "libgzipf_file_set_decoder";
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -365,102 +371,106 @@ int libgzipf_file_open(
 	}
 	internal_file = (libgzipf_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( libgzipf_decoder_is_supported(
+	     decoder ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported decoder: %d.",
+		 function,
+		 decoder );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBGZIPF_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported accesss flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) != 0 )
+#endif
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	else
+	{
+		internal_file->decoder_type = decoder;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	filename_length = narrow_string_length(
-	                   filename );
+	return( result );
+}
 
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+/* Sets the checksum policy
+ * The checksum policy can only be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_set_checksum_policy(
+     libgzipf_file_t *file,
+     int checksum_policy,
+     libcerror_error_t **error )
+{
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_set_checksum_policy";
+	int result                              = 1;
+
+	if( file == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-                goto on_error;
+		return( -1 );
 	}
-	if( libgzipf_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( ( checksum_policy != LIBGZIPF_CHECKSUM_POLICY_FULL )
+	 && ( checksum_policy != LIBGZIPF_CHECKSUM_POLICY_DEFERRED )
+	 && ( checksum_policy != LIBGZIPF_CHECKSUM_POLICY_OFF ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum policy: %d.",
 		 function,
-		 filename );
+		 checksum_policy );
 
-                goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -474,11 +484,24 @@ int libgzipf_file_open(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_file->file_io_handle_created_in_library = 1;
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
 
+		result = -1;
+	}
+	else
+	{
+		internal_file->checksum_policy = checksum_policy;
+	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
@@ -491,38 +514,29 @@ int libgzipf_file_open(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_file->file_io_handle_created_in_library = 0;
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
+	return( result );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a file
+/* Sets the checkpoint spacing
+ * A checkpoint is created when either the maximum compressed or the maximum
+ * uncompressed size is reached
+ * The native decoder creates the checkpoint within a Huffman compressed block,
+ * before a match that would exceed the maximum uncompressed size, other decoders
+ * create it at the next DEFLATE block boundary
  * Returns 1 if successful or -1 on error
  */
-int libgzipf_file_open_wide(
+int libgzipf_file_set_checkpoint_spacing(
      libgzipf_file_t *file,
-     const wchar_t *filename,
-     int access_flags,
+     size_t maximum_compressed_size,
+     size_t maximum_uncompressed_size,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle        = NULL;
 	libgzipf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libgzipf_file_open_wide";
-	size_t filename_length                  = 0;
+	static char *function                   = "libgzipf_file_set_checkpoint_spacing";
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -537,105 +551,63 @@ int libgzipf_file_open_wide(
 	}
 	internal_file = (libgzipf_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( ( maximum_compressed_size == 0 )
+	 || ( maximum_compressed_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum compressed size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBGZIPF_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( ( maximum_uncompressed_size == 0 )
+	 || ( maximum_uncompressed_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum uncompressed size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) != 0 )
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+#endif
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-#endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
+		result = -1;
 	}
-	if( libgzipf_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
-
-		goto on_error;
+		internal_file->maximum_segment_compressed_data_size   = maximum_compressed_size;
+		internal_file->maximum_segment_uncompressed_data_size = maximum_uncompressed_size;
 	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -643,59 +615,122 @@ int libgzipf_file_open_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_file->file_io_handle_created_in_library = 1;
+	return( result );
+}
 
-#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+/* Sets the index mode
+ * The index mode can only be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_set_index_mode(
+     libgzipf_file_t *file,
+     int index_mode,
+     libcerror_error_t **error )
+{
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_set_index_mode";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		internal_file->file_io_handle_created_in_library = 0;
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
 
-		goto on_error;
+	if( ( index_mode != LIBGZIPF_INDEX_MODE_ON_DEMAND )
+	 && ( index_mode != LIBGZIPF_INDEX_MODE_BACKGROUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index mode: %d.",
+		 function,
+		 index_mode );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	return( 1 );
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
 
-on_error:
-	if( file_io_handle != NULL )
+		result = -1;
+	}
+	else
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		internal_file->index_mode = index_mode;
 	}
-	return( -1 );
-}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+		return( -1 );
+	}
+#endif
+	return( result );
+}
 
-/* Opens a file using a Basic File IO (bfio) handle
+/* Sets the index progress callback
+ * The callback is called by the background index builder thread after each part
+ * of the file that has been indexed and can only be set before the file is opened
+ * The callback has reported completion when libgzipf_file_wait_for_index returns
+ * after the file has been fully indexed
  * Returns 1 if successful or -1 on error
  */
-int libgzipf_file_open_file_io_handle(
+int libgzipf_file_set_index_progress_callback(
      libgzipf_file_t *file,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+     void (*progress_callback)(
+             size64_t indexed_compressed_size,
+             size64_t indexed_uncompressed_size,
+             uint8_t is_complete,
+             void *user_data ),
+     void *user_data,
      libcerror_error_t **error )
 {
-	libgzipf_internal_file_t *internal_file  = NULL;
-	static char *function                    = "libgzipf_file_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library = 0;
-	int bfio_access_flags                    = 0;
-	int file_io_handle_is_open               = 0;
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_set_index_progress_callback";
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -710,6 +745,21 @@ int libgzipf_file_open_file_io_handle(
 	}
 	internal_file = (libgzipf_internal_file_t *) file;
 
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
@@ -719,15 +769,65 @@ int libgzipf_file_open_file_io_handle(
 		 "%s: invalid file - file IO handle already set.",
 		 function );
 
+		result = -1;
+	}
+	else
+	{
+		internal_file->index_progress_callback           = progress_callback;
+		internal_file->index_progress_callback_user_data = user_data;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+#endif
+	return( result );
+}
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_open(
+     libgzipf_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_open";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
@@ -739,7 +839,7 @@ int libgzipf_file_open_file_io_handle(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 "%s: unsupported accesss flags.",
 		 function );
 
 		return( -1 );
@@ -755,56 +855,68 @@ int libgzipf_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBGZIPF_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		goto on_error;
 	}
-	if( libgzipf_internal_file_open_read(
-	     internal_file,
+#endif
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+                goto on_error;
+	}
+	if( libgzipf_file_open_file_io_handle(
+	     file,
 	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file IO handle.",
-		 function );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
 
-		goto on_error;
+                goto on_error;
 	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -821,8 +933,7 @@ int libgzipf_file_open_file_io_handle(
 		goto on_error;
 	}
 #endif
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_file->file_io_handle_created_in_library = 1;
 
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -836,8 +947,7 @@ int libgzipf_file_open_file_io_handle(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_file->file_io_handle                   = NULL;
-		internal_file->file_io_handle_opened_in_library = 0;
+		internal_file->file_io_handle_created_in_library = 0;
 
 		goto on_error;
 	}
@@ -845,26 +955,30 @@ int libgzipf_file_open_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( ( file_io_handle_is_open == 0 )
-	 && ( file_io_handle_opened_in_library != 0 ) )
+	if( file_io_handle != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
- */
-int libgzipf_file_close(
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_open_wide(
      libgzipf_file_t *file,
+     const wchar_t *filename,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle        = NULL;
 	libgzipf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libgzipf_file_close";
-	int result                              = 0;
+	static char *function                   = "libgzipf_file_open_wide";
+	size_t filename_length                  = 0;
 
 	if( file == NULL )
 	{
@@ -879,276 +993,3143 @@ int libgzipf_file_close(
 	}
 	internal_file = (libgzipf_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file->read_write_lock,
+	if( ( ( access_flags & LIBGZIPF_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libgzipf_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
 
-				result = -1;
-			}
-		}
+		goto on_error;
 	}
 #endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
+		goto on_error;
 	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
+	if( libgzipf_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
+		goto on_error;
 	}
-	internal_file->file_io_handle             = NULL;
-	internal_file->current_offset             = 0;
-	internal_file->members_read               = 0;
-	internal_file->file_size                  = 0;
-	internal_file->compressed_segments_offset = 0;
-	internal_file->uncompressed_segments_size = 0;
-	internal_file->uncompressed_data_size     = 0;
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-	if( libgzipf_io_handle_clear(
-	     internal_file->io_handle,
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		result = -1;
+		internal_file->file_io_handle_created_in_library = 0;
+
+		goto on_error;
 	}
-	if( internal_file->member_descriptor != NULL )
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
 	{
-		if( libgzipf_member_descriptor_free(
-		     &( internal_file->member_descriptor ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free member descriptor.",
-			 function );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			result = -1;
-		}
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_open_file_io_handle(
+     libgzipf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libgzipf_internal_file_t *internal_file  = NULL;
+	static char *function                    = "libgzipf_file_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library = 0;
+	int bfio_access_flags                    = 0;
+	int file_io_handle_is_open               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_file->member_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_member_descriptor_free,
-	     error ) != 1 )
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty the member descriptors array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_file->segment_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_segment_descriptor_free,
-	     error ) != 1 )
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty the segment descriptors array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( internal_file->compressed_segments_list != NULL )
+	if( ( ( access_flags & LIBGZIPF_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( libfdata_list_free(
-		     &( internal_file->compressed_segments_list ),
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBGZIPF_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBGZIPF_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed segments list.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libgzipf_internal_file_open_read(
+	     internal_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle                   = file_io_handle;
+	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle                   = NULL;
+		internal_file->file_io_handle_opened_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( ( file_io_handle_is_open == 0 )
+	 && ( file_io_handle_opened_in_library != 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Opens a file using an index written by libgzipf_file_write_index
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_open_with_index(
+     libgzipf_file_t *file,
+     const char *filename,
+     const char *index_filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle  = NULL;
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_open_with_index";
+	size_t index_filename_length            = 0;
+	int index_mode                          = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index replaces indexing the file in the background
+	 */
+	index_mode                = internal_file->index_mode;
+	internal_file->index_mode = LIBGZIPF_INDEX_MODE_ON_DEMAND;
+
+	result = libgzipf_file_open(
+	          file,
+	          filename,
+	          access_flags,
+	          error );
+
+	internal_file->index_mode = index_mode;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	index_filename_length = narrow_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libgzipf_internal_file_open_index(
+	     internal_file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	libgzipf_file_close(
+	 file,
+	 NULL );
+
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file using an index written by libgzipf_file_write_index
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_open_with_index_wide(
+     libgzipf_file_t *file,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle  = NULL;
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_open_with_index_wide";
+	size_t index_filename_length            = 0;
+	int index_mode                          = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index replaces indexing the file in the background
+	 */
+	index_mode                = internal_file->index_mode;
+	internal_file->index_mode = LIBGZIPF_INDEX_MODE_ON_DEMAND;
+
+	result = libgzipf_file_open_wide(
+	          file,
+	          filename,
+	          access_flags,
+	          error );
+
+	internal_file->index_mode = index_mode;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	index_filename_length = wide_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libgzipf_internal_file_open_index(
+	     internal_file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file: %ls.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	libgzipf_file_close(
+	 file,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file using a file IO handle and an index written by libgzipf_file_write_index
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_open_file_io_handle_with_index(
+     libgzipf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_open_file_io_handle_with_index";
+	int index_mode                          = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index replaces indexing the file in the background
+	 */
+	index_mode                = internal_file->index_mode;
+	internal_file->index_mode = LIBGZIPF_INDEX_MODE_ON_DEMAND;
+
+	result = libgzipf_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          access_flags,
+	          error );
+
+	internal_file->index_mode = index_mode;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_internal_file_open_index(
+	     internal_file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
+
+		libgzipf_file_close(
+		 file,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libgzipf_file_close(
+     libgzipf_file_t *file,
+     libcerror_error_t **error )
+{
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_close";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* The index builder and the checksum verifier are freed before grabbing
+	 * the read/write lock since their threads use the lock. The index builder
+	 * is freed first since it passes the members it reads to the verifier
+	 */
+	if( internal_file->index_builder != NULL )
+	{
+		if( libgzipf_index_builder_free(
+		     &( internal_file->index_builder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index builder.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->checksum_verifier != NULL )
+	{
+		if( libgzipf_checksum_verifier_free(
+		     &( internal_file->checksum_verifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free checksum verifier.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libgzipf_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle             = NULL;
+	internal_file->current_offset             = 0;
+	internal_file->sequential_read_offset     = 0;
+	internal_file->members_read               = 0;
+	internal_file->file_size                  = 0;
+	internal_file->compressed_segments_offset = 0;
+	internal_file->uncompressed_segments_size = 0;
+	internal_file->uncompressed_data_size     = 0;
+
+	if( libgzipf_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->member_descriptor != NULL )
+	{
+		if( libgzipf_member_descriptor_free(
+		     &( internal_file->member_descriptor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free member descriptor.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_empty(
+	     internal_file->member_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_member_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty the member descriptors array.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     internal_file->segment_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_segment_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty the segment descriptors array.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->compressed_segments_list != NULL )
+	{
+		if( libfdata_list_free(
+		     &( internal_file->compressed_segments_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed segments list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_segments_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->compressed_segments_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed segments cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->sequential_reader != NULL )
+	{
+		if( libgzipf_sequential_reader_free(
+		     &( internal_file->sequential_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sequential reader.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		memory_free(
+		 internal_file->uncompressed_data );
+
+		internal_file->uncompressed_data = NULL;
+	}
+	if( internal_file->segment_data != NULL )
+	{
+		memory_free(
+		 internal_file->segment_data );
+
+		internal_file->segment_data = NULL;
+	}
+	internal_file->segment_data_size           = 0;
+	internal_file->allocated_segment_data_size = 0;
+	internal_file->collect_segment_data        = 0;
+
+	if( internal_file->decoder != NULL )
+	{
+		if( libgzipf_decoder_free(
+		     &( internal_file->decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoder.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_data != NULL )
+	{
+		memory_free(
+		 internal_file->compressed_data );
+
+		internal_file->uncompressed_data = NULL;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Writes the index of the file
+ * The index contains the member and segment descriptors, which allows
+ * the file to be reopened without decompressing it
+ * The members of the file are read if this has not been done before
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_write_index(
+     libgzipf_file_t *file,
+     const char *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	static char *function                  = "libgzipf_file_write_index";
+	size_t index_filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	index_filename_length = narrow_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libgzipf_file_write_index_file_io_handle(
+	     file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the index of the file
+ * The index contains the member and segment descriptors, which allows
+ * the file to be reopened without decompressing it
+ * The members of the file are read if this has not been done before
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_write_index_wide(
+     libgzipf_file_t *file,
+     const wchar_t *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	static char *function                  = "libgzipf_file_write_index_wide";
+	size_t index_filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	index_filename_length = wide_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libgzipf_file_write_index_file_io_handle(
+	     file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %ls.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the index of the file using a file IO handle
+ * The members of the file are read if this has not been done before
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_file_write_index_file_io_handle(
+     libgzipf_file_t *file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_write_index_file_io_handle";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* Wait for the index builder before grabbing the read/write lock
+	 * since the index builder thread uses the lock
+	 */
+	if( libgzipf_internal_file_wait_for_index_builder(
+	     internal_file,
+	     -1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libgzipf_internal_file_write_index(
+	     internal_file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_open_read(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_internal_file_open_read";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_segments_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed segments list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_segments_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed segments cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_file->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->file_size < 10 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->compressed_data = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * LIBGZIPF_MAXIMUM_DEFLATE_BLOCK_SIZE );
+
+	if( internal_file->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libgzipf_decoder_initialize(
+	     &( internal_file->decoder ),
+	     internal_file->decoder_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->uncompressed_data = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE );
+
+	if( internal_file->uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->compressed_segments_offset = 0;
+	internal_file->uncompressed_segments_size = 0;
+
+	/* Without multi-threading support the deferred checksum policy falls back
+	 * to verifying the checksums while the file is indexed
+	 */
+	internal_file->calculate_checksums = 0;
+
+	if( internal_file->checksum_policy == LIBGZIPF_CHECKSUM_POLICY_FULL )
+	{
+		internal_file->calculate_checksums = 1;
+	}
+#if !defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	else if( internal_file->checksum_policy == LIBGZIPF_CHECKSUM_POLICY_DEFERRED )
+	{
+		internal_file->calculate_checksums = 1;
+	}
+#endif
+	if( libfdata_list_initialize(
+	     &( internal_file->compressed_segments_list ),
+	     (intptr_t *) internal_file->segment_descriptors_array,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libgzipf_compressed_segment_read_element_data,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed segments list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->compressed_segments_cache ),
+	     LIBGZIPF_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed segments cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( internal_file->checksum_policy == LIBGZIPF_CHECKSUM_POLICY_DEFERRED )
+	{
+		if( libgzipf_checksum_verifier_initialize(
+		     &( internal_file->checksum_verifier ),
+		     internal_file->member_descriptors_array,
+		     internal_file->segment_descriptors_array,
+		     internal_file->read_write_lock,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create checksum verifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_checksum_verifier_start(
+		     internal_file->checksum_verifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start checksum verifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_file->index_mode == LIBGZIPF_INDEX_MODE_BACKGROUND )
+	{
+		if( libgzipf_index_builder_initialize(
+		     &( internal_file->index_builder ),
+		     (intptr_t *) internal_file,
+		     (int (*)(intptr_t *, libbfio_handle_t *, size64_t *, size64_t *, uint8_t *, libcerror_error_t **)) &libgzipf_internal_file_build_index,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index builder.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_index_builder_set_progress_callback(
+		     internal_file->index_builder,
+		     internal_file->index_progress_callback,
+		     internal_file->index_progress_callback_user_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set progress callback of index builder.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_index_builder_start(
+		     internal_file->index_builder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start index builder.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( internal_file->index_builder != NULL )
+	{
+		libgzipf_index_builder_free(
+		 &( internal_file->index_builder ),
+		 NULL );
+	}
+	if( internal_file->checksum_verifier != NULL )
+	{
+		libgzipf_checksum_verifier_free(
+		 &( internal_file->checksum_verifier ),
+		 NULL );
+	}
+#endif
+	if( internal_file->compressed_segments_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->compressed_segments_cache ),
+		 NULL );
+	}
+	if( internal_file->compressed_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_file->compressed_segments_list ),
+		 NULL );
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		memory_free(
+		 internal_file->uncompressed_data );
+
+		internal_file->uncompressed_data = NULL;
+	}
+	if( internal_file->segment_data != NULL )
+	{
+		memory_free(
+		 internal_file->segment_data );
+
+		internal_file->segment_data = NULL;
+	}
+	internal_file->segment_data_size           = 0;
+	internal_file->allocated_segment_data_size = 0;
+	internal_file->collect_segment_data        = 0;
+
+	if( internal_file->decoder != NULL )
+	{
+		libgzipf_decoder_free(
+		 &( internal_file->decoder ),
+		 NULL );
+	}
+	if( internal_file->compressed_data != NULL )
+	{
+		memory_free(
+		 internal_file->compressed_data );
+
+		internal_file->uncompressed_data = NULL;
+	}
+	libcdata_array_free(
+	 &( internal_file->segment_descriptors_array ),
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_segment_descriptor_free,
+	 NULL );
+
+	libcdata_array_free(
+	 &( internal_file->member_descriptors_array ),
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_member_descriptor_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Opens the index of a file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_open_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_internal_file_open_index";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libgzipf_internal_file_read_index(
+	     internal_file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the index of a file
+ * The index replaces reading the members of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_read_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libgzipf_member_descriptor_t *member_descriptor   = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
+	static char *function                             = "libgzipf_internal_file_read_index";
+	size64_t file_size                                = 0;
+	size64_t segment_end_offset                       = 0;
+	off64_t compressed_segments_offset                = 0;
+	off64_t index_file_offset                         = 0;
+	uint32_t checksum                                 = 0;
+	uint32_t fingerprint                              = 0;
+	uint32_t flags                                    = 0;
+	uint32_t stored_fingerprint                       = 0;
+	uint8_t index_file_io_handle_opened_in_library    = 0;
+	int entry_index                                   = 0;
+	int member_index                                  = 0;
+	int number_of_members                             = 0;
+	int number_of_segments                            = 0;
+	int result                                        = 0;
+	int segment_index                                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->members_read != 0 )
+	 || ( internal_file->member_descriptor != NULL )
+	 || ( internal_file->uncompressed_segments_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - members already read.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if index file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     index_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		index_file_io_handle_opened_in_library = 1;
+	}
+	result = libgzipf_index_read_file_header(
+	          index_file_io_handle,
+	          &index_file_offset,
+	          &flags,
+	          &file_size,
+	          &stored_fingerprint,
+	          &number_of_members,
+	          &number_of_segments,
+	          &compressed_segments_offset,
+	          &checksum,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index file signature or format version.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file size and fingerprint detect an index of another or a modified file
+	 */
+	if( libgzipf_index_calculate_fingerprint(
+	     internal_file->file_io_handle,
+	     internal_file->file_size,
+	     &fingerprint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size != internal_file->file_size )
+	 || ( stored_fingerprint != fingerprint ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: index does not match file.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size64_t) compressed_segments_offset > internal_file->file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed segments offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	for( member_index = 0;
+	     member_index < number_of_members;
+	     member_index++ )
+	{
+		if( libgzipf_member_descriptor_initialize(
+		     &member_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create member descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_index_read_member_descriptor(
+		     index_file_io_handle,
+		     &index_file_offset,
+		     member_descriptor,
+		     &checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member descriptor: %d.",
+			 function,
+			 member_index );
+
+			goto on_error;
+		}
+		if( ( member_descriptor->number_of_segment_descriptors > 0 )
+		 && ( member_descriptor->first_segment_descriptor_index > ( number_of_segments - member_descriptor->number_of_segment_descriptors ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid member descriptor: %d - segment descriptors value out of bounds.",
+			 function,
+			 member_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_file->member_descriptors_array,
+		     &entry_index,
+		     (intptr_t *) member_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append member descriptor to array.",
+			 function );
+
+			goto on_error;
+		}
+		member_descriptor = NULL;
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libgzipf_segment_descriptor_initialize(
+		     &segment_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create segment descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_index_read_segment_descriptor(
+		     index_file_io_handle,
+		     &index_file_offset,
+		     segment_descriptor,
+		     &checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment descriptor: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( segment_descriptor->is_stored != 0 )
+		{
+			segment_end_offset = (size64_t) segment_descriptor->stored_data_offset
+			                   + segment_descriptor->uncompressed_data_size;
+		}
+		else
+		{
+			segment_end_offset = (size64_t) segment_descriptor->compressed_data_offset
+			                   + segment_descriptor->compressed_data_size;
+		}
+		if( segment_end_offset > internal_file->file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment descriptor: %d - data range value out of bounds.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		/* The index does not depend on the decoder it was created with,
+		 * except for a segment that starts in the middle of a block
+		 */
+		if( segment_descriptor->block_state_data_size > 0 )
+		{
+			segment_descriptor->decoder_type = LIBGZIPF_DECODER_NATIVE;
+		}
+		else
+		{
+			segment_descriptor->decoder_type = internal_file->decoder->decoder_type;
+		}
+
+		if( libgzipf_internal_file_append_compressed_segment(
+		     internal_file,
+		     segment_descriptor,
+		     &entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append compressed segment.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->uncompressed_segments_size += segment_descriptor->uncompressed_data_size;
+
+		segment_descriptor = NULL;
+	}
+	result = libgzipf_index_read_file_footer(
+	          index_file_io_handle,
+	          &index_file_offset,
+	          checksum,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file footer.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in index checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		index_file_io_handle_opened_in_library = 0;
+	}
+	if( libfdata_list_get_size(
+	     internal_file->compressed_segments_list,
+	     &( internal_file->uncompressed_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of compressed segments list.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->compressed_segments_offset = compressed_segments_offset;
+	internal_file->members_read               = 1;
+
+	if( ( flags & LIBGZIPF_FILE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		internal_file->flags |= LIBGZIPF_FILE_FLAG_IS_CORRUPTED;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( internal_file->checksum_verifier != NULL )
+	{
+		if( libgzipf_checksum_verifier_set_number_of_members(
+		     internal_file->checksum_verifier,
+		     number_of_members,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of members of checksum verifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( segment_descriptor != NULL )
+	{
+		libgzipf_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( member_descriptor != NULL )
+	{
+		libgzipf_member_descriptor_free(
+		 &member_descriptor,
+		 NULL );
+	}
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the index of a file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_write_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libgzipf_member_descriptor_t *member_descriptor   = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
+	static char *function                             = "libgzipf_internal_file_write_index";
+	off64_t index_file_offset                         = 0;
+	uint32_t checksum                                 = 0;
+	uint32_t fingerprint                              = 0;
+	uint8_t index_file_io_handle_opened_in_library    = 0;
+	int member_index                                  = 0;
+	int number_of_members                             = 0;
+	int number_of_segments                            = 0;
+	int result                                        = 0;
+	int segment_index                                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->members_read == 0 )
+	{
+		if( libgzipf_internal_file_read_members(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     -1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read members.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->member_descriptors_array,
+	     &number_of_members,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of member descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->segment_descriptors_array,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segment descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_index_calculate_fingerprint(
+	     internal_file->file_io_handle,
+	     internal_file->file_size,
+	     &fingerprint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if index file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     index_file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		index_file_io_handle_opened_in_library = 1;
+	}
+	if( libgzipf_index_write_file_header(
+	     index_file_io_handle,
+	     &index_file_offset,
+	     (uint32_t) ( internal_file->flags & LIBGZIPF_FILE_FLAG_IS_CORRUPTED ),
+	     internal_file->file_size,
+	     fingerprint,
+	     number_of_members,
+	     number_of_segments,
+	     internal_file->compressed_segments_offset,
+	     &checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file header.",
+		 function );
+
+		goto on_error;
+	}
+	for( member_index = 0;
+	     member_index < number_of_members;
+	     member_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->member_descriptors_array,
+		     member_index,
+		     (intptr_t **) &member_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve member descriptor: %d.",
+			 function,
+			 member_index );
+
+			goto on_error;
+		}
+		if( libgzipf_index_write_member_descriptor(
+		     index_file_io_handle,
+		     &index_file_offset,
+		     member_descriptor,
+		     &checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write member descriptor: %d.",
+			 function,
+			 member_index );
+
+			goto on_error;
+		}
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->segment_descriptors_array,
+		     segment_index,
+		     (intptr_t **) &segment_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment descriptor: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( libgzipf_index_write_segment_descriptor(
+		     index_file_io_handle,
+		     &index_file_offset,
+		     segment_descriptor,
+		     &checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write segment descriptor: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+	}
+	if( libgzipf_index_write_file_footer(
+	     index_file_io_handle,
+	     &index_file_offset,
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file footer.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		index_file_io_handle_opened_in_library = 0;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if the DEFLATE block at a specific offset is a stored (uncompressed) block
+ * The number of bits is the number of unused bits of the byte before the file offset,
+ * which contain the start of the block header
+ * Returns 1 if a stored block, 0 if not or -1 on error
+ */
+int libgzipf_internal_file_get_stored_block_data_range(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t number_of_bits,
+     off64_t *data_offset,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t block_header_data[ 6 ];
+
+	const uint8_t *block_header = NULL;
+	static char *function       = "libgzipf_internal_file_get_stored_block_data_range";
+	off64_t block_header_offset = 0;
+	size_t block_data_offset    = 0;
+	size_t block_data_size      = 0;
+	size_t block_header_size    = 6;
+	ssize_t read_count          = 0;
+	int result                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	block_header_offset = file_offset;
+
+	if( number_of_bits > 0 )
+	{
+		block_header_offset -= 1;
+	}
+	/* The block header is normally still in the compressed data buffer
+	 */
+	if( ( internal_file->compressed_data != NULL )
+	 && ( block_header_offset >= internal_file->compressed_data_file_offset )
+	 && ( ( block_header_offset + (off64_t) block_header_size ) <= ( internal_file->compressed_data_file_offset + (off64_t) internal_file->compressed_data_size ) ) )
+	{
+		block_header = &( internal_file->compressed_data[ block_header_offset - internal_file->compressed_data_file_offset ] );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              block_header_data,
+		              block_header_size,
+		              block_header_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_header_offset,
+			 block_header_offset );
+
+			return( -1 );
+		}
+		block_header      = block_header_data;
+		block_header_size = (size_t) read_count;
+	}
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          block_header,
+	          block_header_size,
+	          number_of_bits,
+	          &block_data_offset,
+	          &block_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine stored block data range.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*data_offset = block_header_offset + (off64_t) block_data_offset;
+		*data_size   = block_data_size;
+	}
+	return( result );
+}
+
+/* Reads a DEFLATE compressed block
+ * The checksum is updated with the CRC-32 of the uncompressed data of the block
+ * if checksums are calculated
+ * If the decoder supports block state, reading pauses in the middle of a Huffman
+ * compressed block once the maximum uncompressed data size, if not 0, is reached
+ * The referenced history size is the number of bytes before the start of the block
+ * that distance codes refer to, or the maximum distance if the decoder cannot determine it
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_read_deflate_block(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size_t maximum_uncompressed_data_size,
+     uint32_t *checksum,
+     size_t *compressed_block_size,
+     size_t *uncompressed_block_size,
+     size_t *referenced_history_size,
+     uint8_t *is_last_block,
+     uint8_t *decompression_error,
+     libcerror_error_t **error )
+{
+	uint8_t block_state_data[ LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE ];
+
+	off64_t compressed_data_end_offset    = 0;
+	off64_t compressed_block_offset       = 0;
+	size_t block_state_data_size          = 0;
+	size_t data_index                     = 0;
+	size_t decode_history_size            = 0;
+	size_t decode_offset                  = 0;
+	size_t decode_size                    = 0;
+	size_t history_size                   = 0;
+	size_t uncompressed_data_limit        = 0;
+	size_t remaining_compressed_data_size = 0;
+	size_t safe_uncompressed_block_offset = 0;
+	uint8_t end_of_input                  = 0;
+	uint8_t flags                         = 0;
+	uint8_t need_input                    = 0;
+	static char *function                 = "libgzipf_internal_file_read_deflate_block";
+	size_t safe_compressed_block_size     = 0;
+	size_t uncompressed_block_offset      = 0;
+	size_t safe_referenced_history_size   = 0;
+	size_t safe_uncompressed_block_size   = 0;
+	ssize_t read_count                    = 0;
+	uint8_t safe_decompression_error      = 0;
+	uint8_t safe_is_last_block            = 0;
+	int result                            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( referenced_history_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid referenced history size.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_last_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is last block.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_error == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression error.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compressed block offset\t: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	/* The native decoder uses the preceding uncompressed data as history,
+	 * hence the block is decoded directly after the uncompressed data of the previous block
+	 */
+	if( internal_file->decoder->uses_history != 0 )
+	{
+		uncompressed_block_offset = internal_file->uncompressed_data_offset;
+		history_size              = (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
+	}
+	safe_uncompressed_block_offset = uncompressed_block_offset;
+
+	/* A decoder that cannot resume in the middle of a block always decodes the whole block
+	 */
+	if( internal_file->decoder->supports_block_state != 0 )
+	{
+		uncompressed_data_limit = maximum_uncompressed_data_size;
+	}
+	/* A decoder that cannot determine the history distance codes refer to
+	 * is assumed to refer to the full history
+	 */
+	result = libgzipf_decoder_get_referenced_history_size(
+	          internal_file->decoder,
+	          &decode_history_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve referenced history size from decoder.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		safe_referenced_history_size = (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
+	}
+	result = 0;
+
+	compressed_block_offset = internal_file->compressed_data_file_offset
+	                        + (off64_t) internal_file->compressed_data_offset;
+
+	if( compressed_block_offset != file_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( result == 0 )
+	{
+		remaining_compressed_data_size = internal_file->compressed_data_size - internal_file->compressed_data_offset;
+		compressed_data_end_offset     = internal_file->compressed_data_file_offset + (off64_t) internal_file->compressed_data_size;
+
+		/* Slide the remaining compressed data to the start of the buffer and fill the rest
+		 */
+		if( ( end_of_input == 0 )
+		 && ( ( need_input != 0 )
+		  ||  ( remaining_compressed_data_size < LIBGZIPF_DEFLATE_MAXIMUM_DYNAMIC_HEADER_SIZE ) ) )
+		{
+			for( data_index = 0;
+			     data_index < remaining_compressed_data_size;
+			     data_index++ )
+			{
+				internal_file->compressed_data[ data_index ] = internal_file->compressed_data[ internal_file->compressed_data_offset + data_index ];
+			}
+			internal_file->compressed_data_file_offset += (off64_t) internal_file->compressed_data_offset;
+			internal_file->compressed_data_size         = remaining_compressed_data_size;
+			internal_file->compressed_data_offset       = 0;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( internal_file->compressed_data[ remaining_compressed_data_size ] ),
+			              LIBGZIPF_MAXIMUM_DEFLATE_BLOCK_SIZE - remaining_compressed_data_size,
+			              compressed_data_end_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 compressed_data_end_offset,
+				 compressed_data_end_offset );
+
+				return( -1 );
+			}
+			internal_file->compressed_data_size += (size_t) read_count;
+
+			compressed_data_end_offset += (off64_t) read_count;
+
+			if( ( read_count == 0 )
+			 || ( (size64_t) compressed_data_end_offset >= internal_file->file_size ) )
+			{
+				end_of_input = 1;
+			}
+		}
+		flags = LIBGZIPF_DECODER_FLAG_STOP_AT_END_OF_BLOCK;
+
+		if( end_of_input != 0 )
+		{
+			flags |= LIBGZIPF_DECODER_FLAG_FINAL_INPUT;
+		}
+		decode_size = LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE;
+
+		if( uncompressed_data_limit > 0 )
+		{
+			if( uncompressed_data_limit <= safe_uncompressed_block_size )
+			{
+				decode_size = uncompressed_block_offset;
+			}
+			else if( ( uncompressed_data_limit - safe_uncompressed_block_size ) < ( decode_size - uncompressed_block_offset ) )
+			{
+				decode_size = uncompressed_block_offset + ( uncompressed_data_limit - safe_uncompressed_block_size );
+			}
+			/* Do not decode a match past the maximum uncompressed data size
+			 */
+			if( decode_size < LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE )
+			{
+				flags |= LIBGZIPF_DECODER_FLAG_STOP_BEFORE_PARTIAL_MATCH;
+			}
+		}
+		decode_offset = safe_uncompressed_block_offset;
+
+		result = libgzipf_decoder_decode(
+		          internal_file->decoder,
+		          internal_file->compressed_data,
+		          internal_file->compressed_data_size,
+		          &( internal_file->compressed_data_offset ),
+		          internal_file->uncompressed_data,
+		          decode_size,
+		          &safe_uncompressed_block_offset,
+		          flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block of compressed data.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			safe_decompression_error = 1;
+
+			break;
+		}
+		/* Distance codes can only refer to the history before the block
+		 * in the first maximum distance of uncompressed data of the block
+		 */
+		if( ( safe_referenced_history_size < (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+		 && ( safe_uncompressed_block_size < (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ) )
+		{
+			if( libgzipf_decoder_get_referenced_history_size(
+			     internal_file->decoder,
+			     &decode_history_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve referenced history size from decoder.",
+				 function );
+
+				return( -1 );
+			}
+			/* Remove the uncompressed data of the block decoded before the decode
+			 */
+			decode_offset -= uncompressed_block_offset;
+			decode_offset += safe_uncompressed_block_size;
+
+			if( decode_history_size > ( decode_offset + safe_referenced_history_size ) )
+			{
+				safe_referenced_history_size = decode_history_size - decode_offset;
+			}
 		}
-	}
-	if( internal_file->compressed_segments_cache != NULL )
-	{
-		if( libfcache_cache_free(
-		     &( internal_file->compressed_segments_cache ),
-		     error ) != 1 )
+		if( result == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed segments cache.",
-			 function );
+			if( ( safe_uncompressed_block_offset < decode_size )
+			 && ( ( decode_size >= LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE )
+			  ||  ( ( decode_size - safe_uncompressed_block_offset ) >= LIBGZIPF_DEFLATE_MAXIMUM_MATCH_SIZE ) ) )
+			{
+				need_input = 1;
+			}
+			else if( decode_size < LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE )
+			{
+				/* The maximum uncompressed data size was reached or the decoder stopped
+				 * before a match that does not fit, pause if decoding can be resumed
+				 * from the block state. Otherwise more compressed data is needed or
+				 * the remainder of the current match is decoded first, a byte at a time
+				 * so that decoding pauses directly after the match instead of continuing
+				 * with the symbols that follow it
+				 */
+				result = libgzipf_decoder_get_block_state(
+				          internal_file->decoder,
+				          block_state_data,
+				          LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE,
+				          &block_state_data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve block state from decoder.",
+					 function );
 
-			result = -1;
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					break;
+				}
+				if( safe_uncompressed_block_offset < decode_size )
+				{
+					need_input = 1;
+				}
+				else
+				{
+					uncompressed_data_limit += 1;
+				}
+			}
+			else
+			{
+				/* The buffer is full, checksum the uncompressed data of the block decoded
+				 * so far and move the history to the start of the buffer
+				 */
+				if( internal_file->calculate_checksums != 0 )
+				{
+					if( libgzipf_checksum_calculate_crc32(
+					     checksum,
+					     &( ( internal_file->uncompressed_data )[ uncompressed_block_offset ] ),
+					     safe_uncompressed_block_offset - uncompressed_block_offset,
+					     *checksum,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+						 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+						 "%s: unable to calculate checksum.",
+						 function );
+
+						return( -1 );
+					}
+				}
+				if( libgzipf_internal_file_append_segment_data(
+				     internal_file,
+				     &( ( internal_file->uncompressed_data )[ uncompressed_block_offset ] ),
+				     safe_uncompressed_block_offset - uncompressed_block_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append uncompressed data to segment data.",
+					 function );
+
+					return( -1 );
+				}
+				safe_uncompressed_block_size += safe_uncompressed_block_offset - uncompressed_block_offset;
+
+				if( history_size > 0 )
+				{
+					if( memory_copy(
+					     internal_file->uncompressed_data,
+					     &( ( internal_file->uncompressed_data )[ safe_uncompressed_block_offset - history_size ] ),
+					     history_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy uncompressed data to beginning of buffer.",
+						 function );
+
+						return( -1 );
+					}
+				}
+				uncompressed_block_offset      = history_size;
+				safe_uncompressed_block_offset = history_size;
+			}
 		}
 	}
-	if( internal_file->uncompressed_data != NULL )
-	{
-		memory_free(
-		 internal_file->uncompressed_data );
+	safe_compressed_block_size = (size_t) ( internal_file->compressed_data_file_offset
+	                           + (off64_t) internal_file->compressed_data_offset
+	                           - file_offset );
 
-		internal_file->uncompressed_data = NULL;
-	}
-#if !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) )
-	if( internal_file->fixed_huffman_distances_tree != NULL )
+	if( internal_file->decoder->uses_history != 0 )
 	{
-		if( libgzipf_huffman_tree_free(
-		     &( internal_file->fixed_huffman_distances_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			result = -1;
-		}
+		internal_file->uncompressed_data_offset = safe_uncompressed_block_offset;
 	}
-	if( internal_file->fixed_huffman_literals_tree != NULL )
+	if( safe_decompression_error == 0 )
 	{
-		if( libgzipf_huffman_tree_free(
-		     &( internal_file->fixed_huffman_literals_tree ),
-		     error ) != 1 )
+		result = libgzipf_decoder_is_end_of_stream(
+		          internal_file->decoder,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if decoder reached end of stream.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
+		safe_is_last_block = (uint8_t) result;
 	}
-	if( internal_file->bit_stream != NULL )
+	if( internal_file->calculate_checksums != 0 )
 	{
-		if( libgzipf_bit_stream_free(
-		     &( internal_file->bit_stream ),
+		if( libgzipf_checksum_calculate_crc32(
+		     checksum,
+		     &( ( internal_file->uncompressed_data )[ uncompressed_block_offset ] ),
+		     safe_uncompressed_block_offset - uncompressed_block_offset,
+		     *checksum,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free bit stream.",
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
 	}
-#endif /* !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) ) */
-
-	if( internal_file->compressed_data != NULL )
-	{
-		memory_free(
-		 internal_file->compressed_data );
-
-		internal_file->uncompressed_data = NULL;
-	}
-#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
+	if( libgzipf_internal_file_append_segment_data(
+	     internal_file,
+	     &( ( internal_file->uncompressed_data )[ uncompressed_block_offset ] ),
+	     safe_uncompressed_block_offset - uncompressed_block_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append uncompressed data to segment data.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	safe_uncompressed_block_size += safe_uncompressed_block_offset - uncompressed_block_offset;
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compressed block size\t: %" PRIzd "\n",
+		 function,
+		 safe_compressed_block_size );
+
+		libcnotify_printf(
+		 "%s: uncompressed block size\t: %" PRIzd "\n",
+		 function,
+		 safe_uncompressed_block_size );
+
+		libcnotify_printf(
+		 "%s: is last block\t\t: %s\n",
+		 function,
+		 safe_is_last_block ? "true" : "false" );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	*compressed_block_size   = safe_compressed_block_size;
+	*uncompressed_block_size = safe_uncompressed_block_size;
+	*referenced_history_size = safe_referenced_history_size;
+	*is_last_block           = safe_is_last_block;
+	*decompression_error     = safe_decompression_error;
+
+	return( 1 );
 }
 
-/* Opens a file for reading
+/* Appends uncompressed data that was decoded while indexing to the segment data
+ * Collecting stops if the segment data would exceed the maximum uncompressed
+ * data size of a segment by more than an uncompressed block
  * Returns 1 if successful or -1 on error
  */
-int libgzipf_internal_file_open_read(
+int libgzipf_internal_file_append_segment_data(
      libgzipf_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libgzipf_internal_file_open_read";
+	uint8_t *reallocation              = NULL;
+	static char *function              = "libgzipf_internal_file_append_segment_data";
+	size_t allocated_segment_data_size = 0;
+	size_t maximum_segment_data_size   = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1161,281 +4142,215 @@ int libgzipf_internal_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_segments_list != NULL )
+	if( ( internal_file->collect_segment_data == 0 )
+	 || ( data_size == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed segments list value already set.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	if( internal_file->compressed_segments_cache != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed segments cache value already set.",
-		 function );
+	maximum_segment_data_size = internal_file->maximum_segment_uncompressed_data_size
+	                          + (size_t) LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE;
 
-		return( -1 );
-	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &( internal_file->file_size ),
-	     error ) != 1 )
+	if( data_size > ( maximum_segment_data_size - internal_file->segment_data_size ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
-		 function );
+		internal_file->segment_data_size    = 0;
+		internal_file->collect_segment_data = 0;
 
-		goto on_error;
+		return( 1 );
 	}
-	if( internal_file->file_size < 10 )
+	if( ( internal_file->segment_data_size + data_size ) > internal_file->allocated_segment_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file size value out of bounds.",
-		 function );
+		allocated_segment_data_size = internal_file->allocated_segment_data_size * 2;
 
-		goto on_error;
-	}
-	internal_file->compressed_data = (uint8_t *) memory_allocate(
-	                                              sizeof( uint8_t ) * LIBGZIPF_MAXIMUM_DEFLATE_BLOCK_SIZE );
+		if( allocated_segment_data_size < ( internal_file->segment_data_size + data_size ) )
+		{
+			allocated_segment_data_size = internal_file->segment_data_size + data_size;
+		}
+		if( allocated_segment_data_size > maximum_segment_data_size )
+		{
+			allocated_segment_data_size = maximum_segment_data_size;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_file->segment_data,
+		                            sizeof( uint8_t ) * allocated_segment_data_size );
 
-	if( internal_file->compressed_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data.",
-		 function );
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segment data.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
+		internal_file->segment_data                = reallocation;
+		internal_file->allocated_segment_data_size = allocated_segment_data_size;
 	}
-#if !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) )
-	if( libgzipf_bit_stream_initialize(
-	     &( internal_file->bit_stream ),
-	     internal_file->compressed_data,
-	     LIBGZIPF_MAXIMUM_DEFLATE_BLOCK_SIZE,
-	     0,
-	     LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
-	     error ) != 1 )
+	if( memory_copy(
+	     &( ( internal_file->segment_data )[ internal_file->segment_data_size ] ),
+	     data,
+	     data_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to segment data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libgzipf_huffman_tree_initialize(
-	     &( internal_file->fixed_huffman_literals_tree ),
-	     288,
-	     15,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build fixed literals Huffman tree.",
-		 function );
+	internal_file->segment_data_size += data_size;
 
-		goto on_error;
-	}
-	if( libgzipf_huffman_tree_initialize(
-	     &( internal_file->fixed_huffman_distances_tree ),
-	     30,
-	     15,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Seeds the compressed segments cache with the segment data of a segment
+ * that was decoded while indexing, so that it is not decoded a second time when read
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_seed_compressed_segment(
+     libgzipf_internal_file_t *internal_file,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     int element_index,
+     libcerror_error_t **error )
+{
+	libgzipf_compressed_segment_t *compressed_segment = NULL;
+	static char *function                             = "libgzipf_internal_file_seed_compressed_segment";
+	uint8_t collect_segment_data                      = 0;
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build fixed distances Huffman tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libgzipf_deflate_build_fixed_huffman_trees(
-	     internal_file->fixed_huffman_literals_tree,
-	     internal_file->fixed_huffman_distances_tree,
-	     error ) != 1 )
+	if( segment_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to build fixed Huffman trees.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif /* !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) ) */
+	collect_segment_data = internal_file->collect_segment_data;
 
-	internal_file->uncompressed_data = (uint8_t *) memory_allocate(
-	                                                sizeof( uint8_t ) * LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE );
+	internal_file->collect_segment_data = 0;
 
-	if( internal_file->uncompressed_data == NULL )
+	/* The data of a stored segment is read directly from the file
+	 */
+	if( ( collect_segment_data == 0 )
+	 || ( segment_descriptor->is_stored != 0 )
+	 || ( internal_file->segment_data_size == 0 )
+	 || ( internal_file->segment_data_size != segment_descriptor->uncompressed_data_size ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create uncompressed data.",
-		 function );
-
-		goto on_error;
-	}
-	internal_file->compressed_segments_offset = 0;
-	internal_file->uncompressed_segments_size = 0;
-
-	if( libfdata_list_initialize(
-	     &( internal_file->compressed_segments_list ),
-	     (intptr_t *) internal_file->segment_descriptors_array,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libgzipf_compressed_segment_read_element_data,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		internal_file->segment_data_size = 0;
+
+		return( 1 );
+	}
+	if( libgzipf_compressed_segment_initialize(
+	     &compressed_segment,
+	     0,
+	     (size64_t) internal_file->segment_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed segments list.",
+		 "%s: unable to create compressed segment.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->compressed_segments_cache ),
-	     LIBGZIPF_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
+	if( memory_copy(
+	     compressed_segment->uncompressed_data,
+	     internal_file->segment_data,
+	     internal_file->segment_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy segment data to compressed segment.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_segment->decoded_data_size = compressed_segment->uncompressed_data_size;
+
+	internal_file->segment_data_size = 0;
+
+	if( libfdata_list_set_element_value_by_index(
+	     internal_file->compressed_segments_list,
+	     (intptr_t *) internal_file->file_io_handle,
+	     (libfdata_cache_t *) internal_file->compressed_segments_cache,
+	     element_index,
+	     (intptr_t *) compressed_segment,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_compressed_segment_free,
+	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed segments cache.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed segment: %d as element value.",
+		 function,
+		 element_index );
 
 		goto on_error;
 	}
 	return( 1 );
 
 on_error:
-	if( internal_file->compressed_segments_list != NULL )
-	{
-		libfdata_list_free(
-		 &( internal_file->compressed_segments_list ),
-		 NULL );
-	}
-	if( internal_file->uncompressed_data != NULL )
-	{
-		memory_free(
-		 internal_file->uncompressed_data );
+	internal_file->segment_data_size = 0;
 
-		internal_file->uncompressed_data = NULL;
-	}
-#if !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) )
-	if( internal_file->fixed_huffman_distances_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &( internal_file->fixed_huffman_distances_tree ),
-		 NULL );
-	}
-	if( internal_file->fixed_huffman_literals_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &( internal_file->fixed_huffman_literals_tree ),
-		 NULL );
-	}
-	if( internal_file->bit_stream != NULL )
+	if( compressed_segment != NULL )
 	{
-		libgzipf_bit_stream_free(
-		 &( internal_file->bit_stream ),
+		libgzipf_compressed_segment_free(
+		 &compressed_segment,
 		 NULL );
 	}
-#endif /* !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) ) */
-
-	if( internal_file->compressed_data != NULL )
-	{
-		memory_free(
-		 internal_file->compressed_data );
-
-		internal_file->uncompressed_data = NULL;
-	}
-	libcdata_array_free(
-	 &( internal_file->segment_descriptors_array ),
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_segment_descriptor_free,
-	 NULL );
-
-	libcdata_array_free(
-	 &( internal_file->member_descriptors_array ),
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libgzipf_member_descriptor_free,
-	 NULL );
-
 	return( -1 );
 }
 
-/* Reads a DEFLATE compressed block
+/* Appends a segment descriptor and its compressed segments list element
  * Returns 1 if successful or -1 on error
  */
-int libgzipf_internal_file_read_deflate_block(
+int libgzipf_internal_file_append_compressed_segment(
      libgzipf_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     libgzipf_member_descriptor_t *member_descriptor,
-     size_t *compressed_block_size,
-     size_t *uncompressed_block_size,
-     uint8_t *is_last_block,
-     uint8_t *decompression_error,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     int *segment_descriptor_index,
      libcerror_error_t **error )
 {
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-	size_t last_compressed_block_size     = 0;
-	uint8_t end_of_block                  = 0;
-	int result                            = 0;
-#else
-	size_t copy_size                      = 0;
-	size_t safe_uncompressed_block_offset = 0;
-	uint8_t block_type                    = 0;
-	uint8_t last_block_flag               = 0;
-#endif
-
-	static char *function                 = "libgzipf_internal_file_read_deflate_block";
-	size_t safe_compressed_block_size     = 0;
-	size_t uncompressed_block_offset      = 0;
-	size_t safe_uncompressed_block_size   = 0;
-	ssize_t read_count                    = 0;
-	uint8_t safe_decompression_error      = 0;
-	uint8_t safe_is_last_block            = 0;
+	static char *function       = "libgzipf_internal_file_append_compressed_segment";
+	size64_t element_data_size  = 0;
+	off64_t element_data_offset = 0;
+	int element_index           = 0;
+	int entry_index             = 0;
+	int number_of_entries       = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1448,352 +4363,348 @@ int libgzipf_internal_file_read_deflate_block(
 
 		return( -1 );
 	}
-#if !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) )
-	if( internal_file->bit_stream == NULL )
+	if( segment_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( member_descriptor == NULL )
+	if( segment_descriptor_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid member descriptor.",
+		 "%s: invalid segment descriptor index.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_block_size == NULL )
+	/* The element of a stored segment maps directly onto the data of the stored block
+	 */
+	if( segment_descriptor->is_stored != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed block size.",
-		 function );
+		element_data_offset = segment_descriptor->stored_data_offset;
+		element_data_size   = (size64_t) segment_descriptor->uncompressed_data_size;
+	}
+	else
+	{
+		element_data_offset = segment_descriptor->compressed_data_offset;
+		element_data_size   = (size64_t) segment_descriptor->compressed_data_size;
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* The index builder thread appends the segment while the file is being read
+	 */
+	if( internal_file->index_builder != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( uncompressed_block_size == NULL )
+#endif
+	/* The element data file index refers to the segment descriptor
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->segment_descriptors_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed block size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segment descriptors.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( is_last_block == NULL )
+	if( libfdata_list_append_element_with_mapped_size(
+	     internal_file->compressed_segments_list,
+	     &element_index,
+	     number_of_entries,
+	     element_data_offset,
+	     element_data_size,
+	     0,
+	     segment_descriptor->uncompressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid is last block.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element to compressed segments list.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( decompression_error == NULL )
+	if( libgzipf_internal_file_seed_compressed_segment(
+	     internal_file,
+	     segment_descriptor,
+	     element_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid decompression error.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to seed compressed segments cache.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              internal_file->compressed_data,
-	              LIBGZIPF_MAXIMUM_DEFLATE_BLOCK_SIZE,
-	              file_offset,
-	              error );
-
-	if( read_count < 0 )
+	if( libcdata_array_append_entry(
+	     internal_file->segment_descriptors_array,
+	     &entry_index,
+	     (intptr_t *) segment_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment descriptor.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( internal_file->index_builder != NULL )
 	{
-		libcnotify_printf(
-		 "%s: compressed block offset\t: %" PRIu32 " (0x%08" PRIx32 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
 
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-	internal_file->zlib_stream.next_in   = (Bytef *) internal_file->compressed_data;
-	internal_file->zlib_stream.avail_in  = (uInt) read_count;
-	internal_file->zlib_stream.next_out  = (Bytef *) internal_file->uncompressed_data;
-	internal_file->zlib_stream.avail_out = (uInt) LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE;
+			return( -1 );
+		}
+	}
+#endif
+	*segment_descriptor_index = entry_index;
 
-	safe_compressed_block_size   = 0;
-	uncompressed_block_offset    = 0;
-	safe_uncompressed_block_size = 0;
-	end_of_block                 = 0;
+	return( 1 );
 
-	while( ( end_of_block == 0 )
-	    && ( safe_is_last_block == 0 )
-	    && ( safe_decompression_error == 0 ) )
+on_error:
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( internal_file->index_builder != NULL )
 	{
-		last_compressed_block_size = safe_compressed_block_size;
-
-		safe_compressed_block_size   += (size_t) internal_file->zlib_stream.avail_in;
-		safe_uncompressed_block_size += (size_t) internal_file->zlib_stream.avail_out;
-
-		result = inflate(
-			  &( internal_file->zlib_stream ),
-			  Z_BLOCK );
+		libcthreads_read_write_lock_release_for_write(
+		 internal_file->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
 
-		safe_compressed_block_size   -= (size_t) internal_file->zlib_stream.avail_in;
-		safe_uncompressed_block_size -= (size_t) internal_file->zlib_stream.avail_out;
+/* Appends a segment descriptor of a member and its compressed segments list element
+ * and adds the checksum of the segment to that of the member
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_append_segment_descriptor(
+     libgzipf_internal_file_t *internal_file,
+     libgzipf_member_descriptor_t *member_descriptor,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function        = "libgzipf_internal_file_append_segment_descriptor";
+	int segment_descriptor_index = 0;
 
-		if( ( result == Z_OK )
-		 || ( result == Z_STREAM_END ) )
-		{
-			internal_file->last_number_of_compressed_stream_bits = (uint8_t) ( internal_file->zlib_stream.data_type & 0x07 );
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-			end_of_block       = ( ( internal_file->zlib_stream.data_type & 0x80 ) != 0 );
-			safe_is_last_block = ( result == Z_STREAM_END );
-		}
-		else if( result == Z_DATA_ERROR )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: unable to read compressed data: data error.\n",
-				 function );
-			}
-#endif
-			return( -1 );
-		}
-		else if( result == Z_BUF_ERROR )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				"%s: unable to read compressed data: no progress possible.\n",
-				 function );
-			}
-#endif
-			if( safe_compressed_block_size == last_compressed_block_size )
-			{
-				safe_decompression_error = 1;
-			}
-			else
-			{
-				return( -1 );
-			}
-		}
-		else if( result == Z_MEM_ERROR )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to read compressed data: insufficient memory.",
-			 function );
+		return( -1 );
+	}
+	if( member_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member descriptor.",
+		 function );
 
-			return( -1 );
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-			 "%s: zlib returned undefined error: %d.",
-			 function,
-			 result );
+		return( -1 );
+	}
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-#else
-	if( internal_file->distance_data_size > 0 )
+	if( segment_descriptor->has_checksum != 0 )
 	{
-		if( memory_copy(
-		     internal_file->uncompressed_data,
-		     internal_file->distance_data,
-		     internal_file->distance_data_size ) == NULL )
+		if( libgzipf_checksum_combine_crc32(
+		     &( member_descriptor->calculated_checksum ),
+		     member_descriptor->calculated_checksum,
+		     segment_descriptor->checksum,
+		     (size64_t) segment_descriptor->uncompressed_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy uncompressed data to beginning of buffer.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to combine checksum of segment with that of member.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	uncompressed_block_offset = internal_file->distance_data_size;
-
-	/* Do not flush the bit buffer */
-
-	internal_file->bit_stream->byte_stream_size   = (size_t) read_count;
-	internal_file->bit_stream->byte_stream_offset = 0;
-
-	if( libgzipf_deflate_read_block_header(
-	     internal_file->bit_stream,
-	     &block_type,
-	     &last_block_flag,
+	if( libgzipf_internal_file_append_compressed_segment(
+	     internal_file,
+	     segment_descriptor,
+	     &segment_descriptor_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed data block header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compressed segment.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_block_offset = internal_file->distance_data_size;
+	if( member_descriptor->number_of_segment_descriptors == 0 )
+	{
+		member_descriptor->first_segment_descriptor_index = segment_descriptor_index;
+	}
+	member_descriptor->number_of_segment_descriptors += 1;
 
-	if( libgzipf_deflate_read_block(
-	     internal_file->bit_stream,
-	     block_type,
-	     internal_file->fixed_huffman_literals_tree,
-	     internal_file->fixed_huffman_distances_tree,
-	     internal_file->uncompressed_data,
-	     LIBGZIPF_UNCOMPRESSED_BLOCK_SIZE,
-	     &safe_uncompressed_block_offset,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Sets the distance data of a DEFLATE compressed segment
+ * Only the end of the distance data that the segment refers to is stored, unless
+ * the uncompressed data that follows the segment in the member can refer to more
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_set_segment_distance_data(
+     libgzipf_internal_file_t *internal_file,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *distance_data,
+     size_t distance_data_size,
+     size_t referenced_history_size,
+     uint8_t is_last_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_internal_file_set_segment_distance_data";
+	size_t history_size   = 0;
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block of compressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
-
-		safe_decompression_error = 1;
+		return( -1 );
 	}
-	while( internal_file->bit_stream->bit_buffer_size >= 8 )
+	if( segment_descriptor == NULL )
 	{
-		internal_file->bit_stream->byte_stream_offset -= 1;
-		internal_file->bit_stream->bit_buffer        >>= 8;
-		internal_file->bit_stream->bit_buffer_size    -= 8;
-	}
-	safe_compressed_block_size   = internal_file->bit_stream->byte_stream_offset;
-	safe_uncompressed_block_size = safe_uncompressed_block_offset - uncompressed_block_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
 
-	if( safe_uncompressed_block_offset > 0 )
+		return( -1 );
+	}
+	if( distance_data == NULL )
 	{
-		if( safe_uncompressed_block_offset < LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
-		{
-			copy_size = safe_uncompressed_block_offset;
-		}
-		else
-		{
-			copy_size = LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
-		}
-		safe_uncompressed_block_offset = safe_uncompressed_block_offset - copy_size;
-
-		if( memory_copy(
-		     internal_file->distance_data,
-		     &( ( internal_file->uncompressed_data )[ safe_uncompressed_block_offset ] ),
-		     copy_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy uncompressed data to beginning of buffer.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distance data.",
+		 function );
 
-			return( -1 );
-		}
-		internal_file->distance_data_size = copy_size;
+		return( -1 );
 	}
-	safe_is_last_block = ( last_block_flag != 0 );
-
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
-
-	if( libgzipf_checksum_calculate_crc32(
-	     &( member_descriptor->calculated_checksum ),
-	     &( ( internal_file->uncompressed_data )[ uncompressed_block_offset ] ),
-	     safe_uncompressed_block_size,
-	     member_descriptor->calculated_checksum,
-	     error ) != 1 )
+	if( distance_data_size > (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-		 "%s: unable to calculate checksum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid distance data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
+	history_size = distance_data_size;
+
+	/* Reading continues from a segment into the next segment of the member,
+	 * which can refer to the distance data if the segment is smaller than the maximum distance
+	 */
+	if( ( segment_descriptor->uncompressed_data_size >= (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	 || ( is_last_block != 0 ) )
+	{
+		if( referenced_history_size < history_size )
+		{
+			history_size = referenced_history_size;
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: compressed block size\t: %" PRIzd "\n",
-		 function,
-		 safe_compressed_block_size );
-
-		libcnotify_printf(
-		 "%s: uncompressed block size\t: %" PRIzd "\n",
-		 function,
-		 safe_uncompressed_block_size );
-
-		libcnotify_printf(
-		 "%s: is last block\t\t: %s\n",
+		 "%s: distance data size\t\t: %" PRIzd " of %" PRIzd "\n",
 		 function,
-		 safe_is_last_block ? "true" : "false" );
-
-		libcnotify_printf(
-		 "\n" );
+		 history_size,
+		 distance_data_size );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	*compressed_block_size   = safe_compressed_block_size;
-	*uncompressed_block_size = safe_uncompressed_block_size;
-	*is_last_block           = safe_is_last_block;
-	*decompression_error     = safe_decompression_error;
+	if( libgzipf_segment_descriptor_set_distance_data(
+	     segment_descriptor,
+	     &( distance_data[ distance_data_size - history_size ] ),
+	     history_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set distance data in segment descriptor.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -1807,19 +4718,25 @@ int libgzipf_internal_file_read_deflate_stream(
      off64_t offset,
      libcerror_error_t **error )
 {
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-	uInt safe_distance_data_size                      = 0;
-	int result                                        = 0;
-#endif
+	uint8_t block_state_data[ LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE ];
+	uint8_t distance_data[ LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ];
 
 	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
 	static char *function                             = "libgzipf_internal_file_read_deflate_stream";
+	off64_t stored_data_offset                        = 0;
+	size_t block_state_data_size                      = 0;
 	size_t compressed_block_size                      = 0;
+	size_t distance_data_size                         = 0;
+	size_t maximum_uncompressed_data_size             = 0;
+	size_t referenced_history_size                    = 0;
+	size_t segment_history_size                       = 0;
+	size_t stored_data_size                           = 0;
 	size_t uncompressed_block_size                    = 0;
+	uint8_t is_in_block                               = 0;
 	uint8_t is_last_block                             = 0;
-	int element_index                                 = 0;
-	int entry_index                                   = 0;
-	int segment_descriptor_index                      = 0;
+	uint8_t is_stored_block                           = 0;
+	uint8_t number_of_bits                            = 0;
+	int result                                        = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1845,117 +4762,253 @@ int libgzipf_internal_file_read_deflate_stream(
 	}
 	if( member_descriptor->uncompressed_data_size == 0 )
 	{
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-		if( memory_set(
-		     &( internal_file->zlib_stream ),
-		     0,
-		     sizeof( z_stream ) ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear zlib stream.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_ZLIB_INFLATE_INIT2 ) || defined( ZLIB_DLL )
-		result = inflateInit2(
-		          &( internal_file->zlib_stream ),
-		          -15 );
-#else
-		result = _inflateInit2(
-		          &( internal_file->zlib_stream ),
-		          -15 );
-#endif
-		if( result != Z_OK )
+		if( libgzipf_decoder_reset(
+		     internal_file->decoder,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize zlib stream.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset decoder.",
 			 function );
 
 			goto on_error;
 		}
-#else
-		internal_file->bit_stream->bit_buffer      = 0;
-		internal_file->bit_stream->bit_buffer_size = 0;
-
-		internal_file->distance_data_size          = 0;
-
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
+		internal_file->compressed_data_size        = 0;
+		internal_file->compressed_data_offset      = 0;
+		internal_file->compressed_data_file_offset = internal_file->compressed_segments_offset;
+		internal_file->uncompressed_data_offset    = 0;
 	}
 	while( is_last_block == 0 )
 	{
-		if( segment_descriptor == NULL )
+		number_of_bits = 0;
+		is_in_block    = 0;
+
+		if( member_descriptor->uncompressed_data_size > 0 )
 		{
-			if( libgzipf_segment_descriptor_initialize(
-			     &segment_descriptor,
+			if( libgzipf_decoder_get_number_of_bits(
+			     internal_file->decoder,
+			     &number_of_bits,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create segment descriptor.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of bits from decoder.",
 				 function );
 
 				goto on_error;
 			}
-			segment_descriptor->compressed_data_offset = internal_file->compressed_segments_offset;
+			/* Reading of the previous segment could have paused in the middle of a block
+			 */
+			result = libgzipf_decoder_get_block_state(
+			          internal_file->decoder,
+			          block_state_data,
+			          LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE,
+			          &block_state_data_size,
+			          error );
 
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-			safe_distance_data_size = (uInt) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block state from decoder.",
+				 function );
 
-			result = inflateGetDictionary(
-			          &( internal_file->zlib_stream ),
-			          segment_descriptor->distance_data,
-			          &safe_distance_data_size );
+				goto on_error;
+			}
+			is_in_block = (uint8_t) result;
+		}
+		if( is_in_block != 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			result = libgzipf_internal_file_get_stored_block_data_range(
+			          internal_file,
+			          file_io_handle,
+			          internal_file->compressed_segments_offset,
+			          number_of_bits,
+			          &stored_data_offset,
+			          &stored_data_size,
+			          error );
 
-			if( result != Z_OK )
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve dictionary from zlib stream.",
+				 "%s: unable to determine if block is a stored block.",
 				 function );
 
 				goto on_error;
 			}
-			segment_descriptor->distance_data_size = (size_t) safe_distance_data_size;
-			segment_descriptor->number_of_bits     = internal_file->last_number_of_compressed_stream_bits;
-#else
-			if( member_descriptor->uncompressed_data_size > 0 )
+		}
+		/* A stored block is kept in a segment of its own so that its data
+		 * can be read directly from the file
+		 */
+		is_stored_block = (uint8_t) ( ( result != 0 ) && ( stored_data_size > 0 ) );
+
+		if( ( is_stored_block != 0 )
+		 && ( segment_descriptor != NULL )
+		 && ( segment_descriptor->uncompressed_data_size > 0 ) )
+		{
+			if( segment_descriptor->number_of_bits > 0 )
+			{
+				segment_descriptor->compressed_data_offset -= 1;
+				segment_descriptor->compressed_data_size   += 1;
+			}
+			if( libgzipf_internal_file_set_segment_distance_data(
+			     internal_file,
+			     segment_descriptor,
+			     distance_data,
+			     distance_data_size,
+			     segment_history_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set segment distance data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libgzipf_internal_file_append_segment_descriptor(
+			     internal_file,
+			     member_descriptor,
+			     segment_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			segment_descriptor = NULL;
+		}
+		if( segment_descriptor == NULL )
+		{
+			if( libgzipf_segment_descriptor_initialize(
+			     &segment_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create segment descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			segment_descriptor->compressed_data_offset = internal_file->compressed_segments_offset;
+			segment_descriptor->decoder_type           = internal_file->decoder->decoder_type;
+			segment_descriptor->has_checksum           = internal_file->calculate_checksums;
+
+			/* The uncompressed data of a DEFLATE compressed segment is collected
+			 * while it is decoded to seed the compressed segments cache
+			 */
+			internal_file->segment_data_size    = 0;
+			internal_file->collect_segment_data = (uint8_t) ( is_stored_block == 0 );
+
+			/* The distance data is set when the segment is complete and the history
+			 * its distance codes refer to is known
+			 */
+			distance_data_size   = 0;
+			segment_history_size = 0;
+
+			/* A segment that starts at the beginning of a member or that contains
+			 * a stored block does not need a checkpoint
+			 */
+			if( is_stored_block != 0 )
+			{
+				segment_descriptor->is_stored          = 1;
+				segment_descriptor->stored_data_offset = stored_data_offset;
+			}
+			else if( member_descriptor->uncompressed_data_size > 0 )
 			{
-				if( memory_copy(
-				     segment_descriptor->distance_data,
-				     internal_file->distance_data,
-				     internal_file->distance_data_size ) == NULL )
+				if( libgzipf_decoder_get_dictionary(
+				     internal_file->decoder,
+				     distance_data,
+				     LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE,
+				     &distance_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve distance data from decoder.",
+					 function );
+
+					goto on_error;
+				}
+				if( libgzipf_decoder_get_number_of_bits(
+				     internal_file->decoder,
+				     &( segment_descriptor->number_of_bits ),
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-					 "%s: unable to copy distance data to segment descriptor.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of bits from decoder.",
 					 function );
 
 					goto on_error;
 				}
-				segment_descriptor->distance_data_size = segment_descriptor->distance_data_size;
+				if( is_in_block != 0 )
+				{
+					if( libgzipf_segment_descriptor_set_block_state_data(
+					     segment_descriptor,
+					     block_state_data,
+					     block_state_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set block state data in segment descriptor.",
+						 function );
+
+						goto on_error;
+					}
+				}
 			}
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
+		}
+		/* A segment that is not a stored block can end in the middle of a block
+		 */
+		maximum_uncompressed_data_size = 0;
+
+		if( ( segment_descriptor->is_stored == 0 )
+		 && ( segment_descriptor->uncompressed_data_size < internal_file->maximum_segment_uncompressed_data_size ) )
+		{
+			maximum_uncompressed_data_size = internal_file->maximum_segment_uncompressed_data_size
+			                               - segment_descriptor->uncompressed_data_size;
 		}
 		if( libgzipf_internal_file_read_deflate_block(
 		     internal_file,
 		     file_io_handle,
 		     internal_file->compressed_segments_offset,
-		     member_descriptor,
+		     maximum_uncompressed_data_size,
+		     &( segment_descriptor->checksum ),
 		     &compressed_block_size,
 		     &uncompressed_block_size,
+		     &referenced_history_size,
 		     &is_last_block,
 		     &( member_descriptor->decompression_error ),
 		     error ) != 1 )
@@ -1971,6 +5024,34 @@ int libgzipf_internal_file_read_deflate_stream(
 
 			goto on_error;
 		}
+		if( ( is_stored_block != 0 )
+		 && ( uncompressed_block_size > stored_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed block size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* The data of a segment with a decompression error is not seeded
+		 * so that reading it reports the error
+		 */
+		if( member_descriptor->decompression_error != 0 )
+		{
+			internal_file->collect_segment_data = 0;
+		}
+		if( referenced_history_size > segment_descriptor->uncompressed_data_size )
+		{
+			referenced_history_size -= segment_descriptor->uncompressed_data_size;
+
+			if( referenced_history_size > segment_history_size )
+			{
+				segment_history_size = referenced_history_size;
+			}
+		}
 		segment_descriptor->compressed_data_size   += compressed_block_size;
 		segment_descriptor->uncompressed_data_size += uncompressed_block_size;
 
@@ -1981,41 +5062,44 @@ int libgzipf_internal_file_read_deflate_stream(
 		internal_file->compressed_segments_offset += compressed_block_size;
 		internal_file->uncompressed_segments_size += uncompressed_block_size;
 
+		/* The decoder pauses before a match that does not fit in the maximum uncompressed size
+		 */
 		if( ( segment_descriptor->uncompressed_data_size > 0 )
-		 && ( ( segment_descriptor->compressed_data_size >= LIBGZIPF_COMPRESSED_SEGMENT_SIZE )
+		 && ( ( segment_descriptor->compressed_data_size >= internal_file->maximum_segment_compressed_data_size )
+		  ||  ( segment_descriptor->uncompressed_data_size >= internal_file->maximum_segment_uncompressed_data_size )
+		  ||  ( ( internal_file->maximum_segment_uncompressed_data_size - segment_descriptor->uncompressed_data_size ) < LIBGZIPF_DEFLATE_MAXIMUM_MATCH_SIZE )
+		  ||  ( segment_descriptor->is_stored != 0 )
 		  ||  ( is_last_block != 0 )
 		  ||  ( member_descriptor->decompression_error != 0 ) ) )
 		{
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-			if( segment_descriptor->number_of_bits > 0 )
+			if( ( segment_descriptor->is_stored == 0 )
+			 && ( segment_descriptor->number_of_bits > 0 ) )
 			{
 				segment_descriptor->compressed_data_offset -= 1;
 				segment_descriptor->compressed_data_size   += 1;
 			}
-#endif
-			if( libfdata_list_append_element_with_mapped_size(
-			     internal_file->compressed_segments_list,
-			     &element_index,
-			     segment_descriptor_index,
-			     segment_descriptor->compressed_data_offset,
-			     segment_descriptor->compressed_data_size,
-			     0,
-			     segment_descriptor->uncompressed_data_size,
+			if( libgzipf_internal_file_set_segment_distance_data(
+			     internal_file,
+			     segment_descriptor,
+			     distance_data,
+			     distance_data_size,
+			     segment_history_size,
+			     is_last_block,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append element to compressed segments list.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set segment distance data.",
 				 function );
 
 				goto on_error;
 			}
-			if( libcdata_array_append_entry(
-			     internal_file->segment_descriptors_array,
-			     &entry_index,
-			     (intptr_t *) segment_descriptor,
+			if( libgzipf_internal_file_append_segment_descriptor(
+			     internal_file,
+			     member_descriptor,
+			     segment_descriptor,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -2028,8 +5112,6 @@ int libgzipf_internal_file_read_deflate_stream(
 				goto on_error;
 			}
 			segment_descriptor = NULL;
-
-			segment_descriptor_index++;
 		}
 		if( ( is_last_block != 0 )
 		 || ( member_descriptor->decompression_error != 0 ) )
@@ -2045,19 +5127,6 @@ int libgzipf_internal_file_read_deflate_stream(
 	if( ( is_last_block != 0 )
 	 || ( member_descriptor->decompression_error != 0 ) )
 	{
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-		if( inflateEnd(
-		     &( internal_file->zlib_stream ) ) != Z_OK )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to finalize zlib stream.",
-			 function );
-
-			goto on_error;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -2065,33 +5134,31 @@ int libgzipf_internal_file_read_deflate_stream(
 			 "\n" );
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
 
 		if( segment_descriptor != NULL )
 		{
-			if( libfdata_list_append_element_with_mapped_size(
-			     internal_file->compressed_segments_list,
-			     &element_index,
-			     0,
-			     segment_descriptor->compressed_data_offset,
-			     segment_descriptor->compressed_data_size,
-			     0,
-			     segment_descriptor->uncompressed_data_size,
+			if( libgzipf_internal_file_set_segment_distance_data(
+			     internal_file,
+			     segment_descriptor,
+			     distance_data,
+			     distance_data_size,
+			     segment_history_size,
+			     is_last_block,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append element to compressed segments list.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set segment distance data.",
 				 function );
 
 				goto on_error;
 			}
-			if( libcdata_array_append_entry(
-			     internal_file->segment_descriptors_array,
-			     &entry_index,
-			     (intptr_t *) segment_descriptor,
+			if( libgzipf_internal_file_append_segment_descriptor(
+			     internal_file,
+			     member_descriptor,
+			     segment_descriptor,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -2140,10 +5207,6 @@ on_error:
 		 &segment_descriptor,
 		 NULL );
 	}
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-	inflateEnd(
-	 &( internal_file->zlib_stream ) );
-#endif
 	return( -1 );
 }
 
@@ -2194,19 +5257,17 @@ int libgzipf_internal_file_read_member_header(
 
 		return( -1 );
 	}
-#if !( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) )
-	if( internal_file->bit_stream == NULL )
+	if( internal_file->decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing bit stream.",
+		 "%s: invalid file - missing decoder.",
 		 function );
 
 		return( -1 );
 	}
-#endif
 	if( libgzipf_member_header_initialize(
 	     &member_header,
 	     error ) != 1 )
@@ -2408,7 +5469,10 @@ int libgzipf_internal_file_read_member_footer(
 
 		goto on_error;
 	}
-	if( member_footer->checksum != member_descriptor->calculated_checksum )
+	member_descriptor->stored_checksum = member_footer->checksum;
+
+	if( ( internal_file->calculate_checksums != 0 )
+	 && ( member_footer->checksum != member_descriptor->calculated_checksum ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2457,9 +5521,10 @@ int libgzipf_internal_file_read_members(
      off64_t offset,
      libcerror_error_t **error )
 {
-	static char *function = "libgzipf_internal_file_read_members";
-	int entry_index       = 0;
-	int result            = 0;
+	static char *function  = "libgzipf_internal_file_read_members";
+	uint8_t end_of_members = 0;
+	int entry_index        = 0;
+	int result             = 0;
 
 	if( internal_file == NULL )
 	{
@@ -2520,76 +5585,476 @@ int libgzipf_internal_file_read_members(
 			 internal_file->compressed_segments_offset,
 			 internal_file->compressed_segments_offset );
 
-			return( -1 );
-		}
-		if( internal_file->member_descriptor->decompression_error != 0 )
-		{
-			internal_file->flags |= LIBGZIPF_FILE_FLAG_IS_CORRUPTED;
-		}
-		else
-		{
-			if( libgzipf_internal_file_read_member_footer(
-			     internal_file,
-			     file_io_handle,
-			     internal_file->compressed_segments_offset,
-			     internal_file->member_descriptor,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read member footer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 internal_file->compressed_segments_offset,
-				 internal_file->compressed_segments_offset );
+			return( -1 );
+		}
+		if( internal_file->member_descriptor->decompression_error != 0 )
+		{
+			internal_file->flags |= LIBGZIPF_FILE_FLAG_IS_CORRUPTED;
+		}
+		else
+		{
+			if( libgzipf_internal_file_read_member_footer(
+			     internal_file,
+			     file_io_handle,
+			     internal_file->compressed_segments_offset,
+			     internal_file->member_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read member footer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_file->compressed_segments_offset,
+				 internal_file->compressed_segments_offset );
+
+				return( -1 );
+			}
+		}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+		/* The index builder thread appends the member while the file is being read
+		 */
+		if( internal_file->index_builder != NULL )
+		{
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		result = libcdata_array_append_entry(
+		          internal_file->member_descriptors_array,
+		          &entry_index,
+		          (intptr_t *) internal_file->member_descriptor,
+		          error );
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+		if( internal_file->index_builder != NULL )
+		{
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append member descriptor to array.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->member_descriptor = NULL;
+
+		if( ( (size64_t) internal_file->compressed_segments_offset >= internal_file->file_size )
+		 || ( ( internal_file->flags & LIBGZIPF_FILE_FLAG_IS_CORRUPTED ) != 0 ) )
+		{
+			end_of_members = 1;
+		}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+		if( internal_file->checksum_verifier != NULL )
+		{
+			if( libgzipf_checksum_verifier_set_number_of_members(
+			     internal_file->checksum_verifier,
+			     entry_index + 1,
+			     end_of_members,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set number of members of checksum verifier.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		if( end_of_members != 0 )
+		{
+			break;
+		}
+	}
+	if( ( (size64_t) internal_file->compressed_segments_offset >= internal_file->file_size )
+	 || ( ( internal_file->flags & LIBGZIPF_FILE_FLAG_IS_CORRUPTED ) != 0 ) )
+	{
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+		if( internal_file->index_builder != NULL )
+		{
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		result = libfdata_list_get_size(
+		          internal_file->compressed_segments_list,
+		          &( internal_file->uncompressed_data_size ),
+		          error );
+
+		if( result == 1 )
+		{
+			internal_file->members_read = 1;
+		}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+		if( internal_file->index_builder != NULL )
+		{
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of compressed segments list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the index of the file on behalf of the index builder thread
+ * Every call indexes about one segment past the uncompressed data that has been indexed
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_internal_file_build_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t *indexed_compressed_size,
+     size64_t *indexed_uncompressed_size,
+     uint8_t *is_complete,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_internal_file_build_index";
+	off64_t offset        = 0;
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( indexed_compressed_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indexed compressed size.",
+		 function );
+
+		return( -1 );
+	}
+	if( indexed_uncompressed_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indexed uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_complete == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is complete.",
+		 function );
+
+		return( -1 );
+	}
+	/* The indexing state is only used by the index builder thread, the segments
+	 * and members it appends are protected by the read/write lock
+	 */
+	offset = (off64_t) ( internal_file->uncompressed_segments_size + internal_file->maximum_segment_uncompressed_data_size );
+
+	if( libgzipf_internal_file_read_members(
+	     internal_file,
+	     file_io_handle,
+	     offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read members.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfdata_list_get_size(
+	     internal_file->compressed_segments_list,
+	     indexed_uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of compressed segments list.",
+		 function );
+
+		result = -1;
+	}
+	*indexed_compressed_size = (size64_t) internal_file->compressed_segments_offset;
+	*is_complete             = internal_file->members_read;
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+
+/* Waits for the index builder to index the uncompressed data at a specific offset
+ * An offset of -1 waits until the file has been fully indexed
+ * This function must be called without holding the read/write lock since the index builder thread uses the lock
+ * Returns 1 if the offset has been indexed, 0 if not or -1 on error
+ */
+int libgzipf_internal_file_wait_for_index_builder(
+     libgzipf_internal_file_t *internal_file,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_internal_file_wait_for_index_builder";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->index_builder != NULL )
+	{
+		result = libgzipf_index_builder_wait(
+		          internal_file->index_builder,
+		          offset,
+		          error );
 
-				return( -1 );
-			}
-		}
-		if( libcdata_array_append_entry(
-		     internal_file->member_descriptors_array,
-		     &entry_index,
-		     (intptr_t *) internal_file->member_descriptor,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append member descriptor to array.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for index builder.",
 			 function );
 
 			return( -1 );
 		}
-		internal_file->member_descriptor = NULL;
-
-		if( ( (size64_t) internal_file->compressed_segments_offset >= internal_file->file_size )
-		 || ( ( internal_file->flags & LIBGZIPF_FILE_FLAG_IS_CORRUPTED ) != 0 ) )
-		{
-			break;
-		}
 	}
-	if( ( (size64_t) internal_file->compressed_segments_offset >= internal_file->file_size )
-	 || ( ( internal_file->flags & LIBGZIPF_FILE_FLAG_IS_CORRUPTED ) != 0 ) )
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the segment descriptor at a specific offset
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libgzipf_internal_file_get_segment_descriptor_at_offset(
+     libgzipf_internal_file_t *internal_file,
+     off64_t offset,
+     off64_t *element_data_offset,
+     libgzipf_segment_descriptor_t **segment_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function        = "libgzipf_internal_file_get_segment_descriptor_at_offset";
+	size64_t element_size        = 0;
+	off64_t element_offset       = 0;
+	uint32_t element_flags       = 0;
+	int element_index            = 0;
+	int segment_descriptor_index = 0;
+	int result                   = 0;
+
+	if( internal_file == NULL )
 	{
-		internal_file->members_read = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-		if( libfdata_list_get_size(
-		     internal_file->compressed_segments_list,
-		     &( internal_file->uncompressed_data_size ),
+		return( -1 );
+	}
+	/* When the file is indexed in the background only the index builder thread reads the members
+	 */
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( ( internal_file->members_read == 0 )
+	 && ( internal_file->index_builder == NULL ) )
+#else
+	if( internal_file->members_read == 0 )
+#endif
+	{
+		if( libgzipf_internal_file_read_members(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size of compressed segments list.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read members.",
 			 function );
 
 			return( -1 );
 		}
 	}
+	result = libfdata_list_get_element_index_at_offset(
+	          internal_file->compressed_segments_list,
+	          offset,
+	          &element_index,
+	          element_data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed segment index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfdata_list_get_element_by_index(
+	     internal_file->compressed_segments_list,
+	     element_index,
+	     &segment_descriptor_index,
+	     &element_offset,
+	     &element_size,
+	     &element_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed segment: %d.",
+		 function,
+		 element_index );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->segment_descriptors_array,
+	     segment_descriptor_index,
+	     (intptr_t **) segment_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment descriptor: %d.",
+		 function,
+		 segment_descriptor_index );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -2619,7 +6084,14 @@ int libgzipf_internal_file_get_compressed_segment_at_offset(
 
 		return( -1 );
 	}
+	/* When the file is indexed in the background only the index builder thread reads the members
+	 */
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( ( internal_file->members_read == 0 )
+	 && ( internal_file->index_builder == NULL ) )
+#else
 	if( internal_file->members_read == 0 )
+#endif
 	{
 		if( libgzipf_internal_file_read_members(
 		     internal_file,
@@ -2676,10 +6148,15 @@ ssize_t libgzipf_internal_file_read_buffer_from_file_io_handle(
          libcerror_error_t **error )
 {
 	libgzipf_compressed_segment_t *compressed_segment = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
 	static char *function                             = "libgzipf_internal_file_read_buffer_from_file_io_handle";
 	size_t buffer_offset                              = 0;
 	size_t read_size                                  = 0;
+	ssize_t read_count                                = 0;
 	off64_t element_data_offset                       = 0;
+	off64_t sequential_reader_start_offset            = 0;
+	off64_t stored_data_offset                        = 0;
+	uint8_t is_sequential_read                        = 0;
 	int result                                        = 0;
 
 	if( internal_file == NULL )
@@ -2731,6 +6208,10 @@ ssize_t libgzipf_internal_file_read_buffer_from_file_io_handle(
 	{
 		return( 0 );
 	}
+	/* A read that continues where the previous read ended is sequential
+	 */
+	is_sequential_read = (uint8_t) ( internal_file->current_offset == internal_file->sequential_read_offset );
+
 	while( buffer_offset < buffer_size )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -2743,6 +6224,203 @@ ssize_t libgzipf_internal_file_read_buffer_from_file_io_handle(
 			 internal_file->current_offset );
 		}
 #endif
+		/* The sequential reader continues the DEFLATE compressed stream where
+		 * it stopped, without the segments or the compressed segments cache
+		 * A read at another offset uses the segments instead
+		 */
+		if( ( internal_file->sequential_reader != NULL )
+		 && ( internal_file->sequential_reader->is_active != 0 )
+		 && ( internal_file->sequential_reader->current_offset == internal_file->current_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+
+			if( (size64_t) read_size > ( internal_file->uncompressed_data_size - internal_file->current_offset ) )
+			{
+				read_size = (size_t) ( internal_file->uncompressed_data_size - internal_file->current_offset );
+			}
+			read_count = libgzipf_sequential_reader_read_buffer(
+			              internal_file->sequential_reader,
+			              file_io_handle,
+			              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				internal_file->sequential_reader->is_active = 0;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer from sequential reader at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_file->current_offset,
+				 internal_file->current_offset );
+
+				return( -1 );
+			}
+			else if( read_count == 0 )
+			{
+				/* The end of the DEFLATE compressed stream of the member was reached,
+				 * the sequential reader is started again at the next member
+				 * unless it did not read any data since it was started
+				 */
+				internal_file->sequential_reader->is_active = 0;
+
+				if( internal_file->current_offset == sequential_reader_start_offset )
+				{
+					is_sequential_read = 0;
+				}
+			}
+			else
+			{
+				internal_file->current_offset += read_count;
+				buffer_offset                 += (size_t) read_count;
+
+				if( (size64_t) internal_file->current_offset >= internal_file->uncompressed_data_size )
+				{
+					break;
+				}
+				continue;
+			}
+		}
+		result = libgzipf_internal_file_get_segment_descriptor_at_offset(
+		          internal_file,
+		          internal_file->current_offset,
+		          &element_data_offset,
+		          &segment_descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment descriptor for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_file->current_offset,
+			 internal_file->current_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( segment_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing segment descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		/* Sequential reads of a fully indexed file start the sequential reader
+		 * at the beginning of a DEFLATE compressed segment, before the index is
+		 * complete indexing decodes the data and seeds the compressed segments cache
+		 */
+		if( ( is_sequential_read != 0 )
+		 && ( internal_file->members_read != 0 )
+		 && ( element_data_offset == 0 )
+		 && ( segment_descriptor->is_stored == 0 ) )
+		{
+			if( internal_file->sequential_reader == NULL )
+			{
+				if( libgzipf_sequential_reader_initialize(
+				     &( internal_file->sequential_reader ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create sequential reader.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( libgzipf_sequential_reader_start(
+			     internal_file->sequential_reader,
+			     segment_descriptor,
+			     file_io_handle,
+			     internal_file->current_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to start sequential reader at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_file->current_offset,
+				 internal_file->current_offset );
+
+				return( -1 );
+			}
+			sequential_reader_start_offset = internal_file->current_offset;
+
+			continue;
+		}
+		/* The data of a stored block is read directly from the file
+		 * without using the decoder or the compressed segments cache
+		 */
+		if( segment_descriptor->is_stored != 0 )
+		{
+			if( (size64_t) element_data_offset > segment_descriptor->uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid element data offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			read_size = segment_descriptor->uncompressed_data_size - (size_t) element_data_offset;
+
+			if( read_size > ( buffer_size - buffer_offset ) )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			stored_data_offset = segment_descriptor->stored_data_offset + element_data_offset;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              read_size,
+			              stored_data_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stored data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 stored_data_offset,
+				 stored_data_offset );
+
+				return( -1 );
+			}
+			internal_file->current_offset += read_size;
+			buffer_offset                 += read_size;
+
+			if( ( internal_file->members_read != 0 )
+			 && ( (size64_t) internal_file->current_offset >= internal_file->uncompressed_data_size ) )
+			{
+				break;
+			}
+			continue;
+		}
 		result = libgzipf_internal_file_get_compressed_segment_at_offset(
 		          internal_file,
 		          file_io_handle,
@@ -2790,12 +6468,33 @@ ssize_t libgzipf_internal_file_read_buffer_from_file_io_handle(
 
 			return( -1 );
 		}
-		read_size = compressed_segment->uncompressed_data_size - element_data_offset;
-
-		if( read_size > ( buffer_size - buffer_offset ) )
-		{
-			read_size = buffer_size - buffer_offset;
-		}
+		read_size = compressed_segment->uncompressed_data_size - element_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		/* Only the part of the segment up to the end of the read is decoded
+		 */
+		if( libgzipf_compressed_segment_decode(
+		     compressed_segment,
+		     segment_descriptor,
+		     compressed_segment->compressed_data,
+		     compressed_segment->compressed_data_size,
+		     (size_t) element_data_offset + read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode compressed segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_file->current_offset,
+			 internal_file->current_offset );
+
+			return( -1 );
+		}
 		if( memory_copy(
 		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
 		     &( compressed_segment->uncompressed_data[ element_data_offset ] ),
@@ -2819,6 +6518,8 @@ ssize_t libgzipf_internal_file_read_buffer_from_file_io_handle(
 			break;
 		}
 	}
+	internal_file->sequential_read_offset = internal_file->current_offset;
+
 	return( (ssize_t) buffer_offset );
 }
 
@@ -2835,6 +6536,11 @@ ssize_t libgzipf_file_read_buffer(
 	static char *function                   = "libgzipf_file_read_buffer";
 	ssize_t read_count                      = 0;
 
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	off64_t current_offset                  = 0;
+	off64_t last_offset                     = 0;
+#endif
+
 	if( file == NULL )
 	{
 		libcerror_error_set(
@@ -2860,6 +6566,66 @@ ssize_t libgzipf_file_read_buffer(
 		return( -1 );
 	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* Wait for the index builder before grabbing the read/write lock
+	 * since the index builder thread uses the lock
+	 */
+	if( ( internal_file->index_builder != NULL )
+	 && ( buffer_size > 0 ) )
+	{
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		current_offset = internal_file->current_offset;
+
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		/* A read that ends beyond the maximum offset waits until the file has been fully indexed
+		 */
+		if( ( buffer_size > (size_t) SSIZE_MAX )
+		 || ( current_offset > ( INT64_MAX - (off64_t) buffer_size ) ) )
+		{
+			last_offset = -1;
+		}
+		else
+		{
+			last_offset = current_offset + (off64_t) buffer_size - 1;
+		}
+		if( libgzipf_internal_file_wait_for_index_builder(
+		     internal_file,
+		     last_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for index builder.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
@@ -2924,6 +6690,10 @@ ssize_t libgzipf_file_read_buffer_at_offset(
 	static char *function                   = "libgzipf_file_read_buffer_at_offset";
 	ssize_t read_count                      = 0;
 
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	off64_t last_offset                     = 0;
+#endif
+
 	if( file == NULL )
 	{
 		libcerror_error_set(
@@ -2949,6 +6719,38 @@ ssize_t libgzipf_file_read_buffer_at_offset(
 		return( -1 );
 	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* Wait for the index builder before grabbing the read/write lock
+	 * since the index builder thread uses the lock
+	 */
+	if( ( offset >= 0 )
+	 && ( buffer_size > 0 ) )
+	{
+		/* A read that ends beyond the maximum offset waits until the file has been fully indexed
+		 */
+		if( ( buffer_size > (size_t) SSIZE_MAX )
+		 || ( offset > ( INT64_MAX - (off64_t) buffer_size ) ) )
+		{
+			last_offset = -1;
+		}
+		else
+		{
+			last_offset = offset + (off64_t) buffer_size - 1;
+		}
+		if( libgzipf_internal_file_wait_for_index_builder(
+		     internal_file,
+		     last_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for index builder.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
@@ -3132,6 +6934,26 @@ off64_t libgzipf_file_seek_offset(
 		return( -1 );
 	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* Wait for the index builder before grabbing the read/write lock
+	 * since the index builder thread uses the lock
+	 */
+	if( whence == SEEK_END )
+	{
+		if( libgzipf_internal_file_wait_for_index_builder(
+		     internal_file,
+		     -1,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for index builder.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
@@ -3262,6 +7084,152 @@ int libgzipf_file_get_offset(
 	return( 1 );
 }
 
+/* Waits until the uncompressed data at a specific offset has been indexed
+ * An offset of -1 waits until the file has been fully indexed
+ * If the file is not indexed in the background the file is indexed up to the offset
+ * Returns 1 if the offset has been indexed, 0 if the offset is beyond the end of the data or -1 on error
+ */
+int libgzipf_file_wait_for_index(
+     libgzipf_file_t *file,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libgzipf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libgzipf_file_wait_for_index";
+	size64_t indexed_data_size              = 0;
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libgzipf_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( internal_file->index_builder != NULL )
+	{
+		result = libgzipf_internal_file_wait_for_index_builder(
+		          internal_file,
+		          offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for index builder.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->members_read == 0 )
+	{
+		if( libgzipf_internal_file_read_members(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read members.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfdata_list_get_size(
+		     internal_file->compressed_segments_list,
+		     &indexed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of compressed segments list.",
+			 function );
+
+			result = -1;
+		}
+		else if( offset < 0 )
+		{
+			result = (int) internal_file->members_read;
+		}
+		else if( (size64_t) offset >= indexed_data_size )
+		{
+			result = 0;
+		}
+	}
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Determine if the file corrupted
  * Returns 1 if corrupted, 0 if not or -1 on error
  */
@@ -3270,8 +7238,8 @@ int libgzipf_file_is_corrupted(
      libcerror_error_t **error )
 {
 	libgzipf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libgzipf_file_is_corrupted";
-	int result                             = 0;
+	static char *function                   = "libgzipf_file_is_corrupted";
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -3287,6 +7255,54 @@ int libgzipf_file_is_corrupted(
 	internal_file = (libgzipf_internal_file_t *) file;
 
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* Wait for the index builder to read all the members and the checksum verifier
+	 * to verify them before grabbing the read/write lock since their threads use the lock
+	 */
+	if( libgzipf_internal_file_wait_for_index_builder(
+	     internal_file,
+	     -1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->checksum_verifier != NULL )
+	{
+		if( libgzipf_checksum_verifier_wait(
+		     internal_file->checksum_verifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for checksum verifier.",
+			 function );
+
+			return( -1 );
+		}
+		result = libgzipf_checksum_verifier_is_corrupted(
+		          internal_file->checksum_verifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if checksum verifier found a mismatch.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
@@ -3371,6 +7387,23 @@ int libgzipf_file_get_uncompressed_data_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+	/* Wait for the index builder before grabbing the read/write lock
+	 * since the index builder thread uses the lock
+	 */
+	if( libgzipf_internal_file_wait_for_index_builder(
+	     internal_file,
+	     -1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for index builder.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
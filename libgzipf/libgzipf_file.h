@@ -25,14 +25,12 @@
 #include <common.h>
 #include <types.h>
 
-#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
-#include <zlib.h>
-#endif
-
-#include "libgzipf_bit_stream.h"
+#include "libgzipf_checksum_verifier.h"
 #include "libgzipf_compressed_segment.h"
+#include "libgzipf_decoder.h"
 #include "libgzipf_extern.h"
 #include "libgzipf_huffman_tree.h"
+#include "libgzipf_index_builder.h"
 #include "libgzipf_io_handle.h"
 #include "libgzipf_libbfio.h"
 #include "libgzipf_libcdata.h"
@@ -42,6 +40,7 @@
 #include "libgzipf_libfcache.h"
 #include "libgzipf_member_descriptor.h"
 #include "libgzipf_segment_descriptor.h"
+#include "libgzipf_sequential_reader.h"
 #include "libgzipf_types.h"
 
 #if defined( __cplusplus )
@@ -56,6 +55,11 @@ struct libgzipf_internal_file
 	 */
 	off64_t current_offset;
 
+	/* The (uncompressed data) offset at which the last read ended
+	 * which is used to detect sequential reads
+	 */
+	off64_t sequential_read_offset;
+
 	/* The IO handle
 	 */
 	libgzipf_io_handle_t *io_handle;
@@ -92,41 +96,84 @@ struct libgzipf_internal_file
 	 */
 	uint8_t *compressed_data;
 
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
-	/* The zlib stream
+	/* The decoder type
+	 */
+	int decoder_type;
+
+	/* The decoder
+	 */
+	libgzipf_decoder_t *decoder;
+
+	/* The checksum policy
+	 */
+	int checksum_policy;
+
+	/* Value to indicate the checksums are calculated while the file is indexed
 	 */
-        z_stream zlib_stream;
+	uint8_t calculate_checksums;
 
-	/* The last number of compressed stream bits
+	/* The index mode
 	 */
-	uint8_t last_number_of_compressed_stream_bits;
-#else
-	/* The compressed data bit stream
+	int index_mode;
+
+	/* The index progress callback
 	 */
-	libgzipf_bit_stream_t *bit_stream;
+	void (*index_progress_callback)(
+	        size64_t indexed_compressed_size,
+	        size64_t indexed_uncompressed_size,
+	        uint8_t is_complete,
+	        void *user_data );
 
-	/* The fixed distances Huffman tree
+	/* The index progress callback user data
 	 */
-        libgzipf_huffman_tree_t *fixed_huffman_distances_tree;
+	void *index_progress_callback_user_data;
 
-	/* The fixed literals Huffman tree
+	/* The maximum compressed data size of a segment
 	 */
-        libgzipf_huffman_tree_t *fixed_huffman_literals_tree;
+	size_t maximum_segment_compressed_data_size;
 
-	/* The preceeding 32 KiB of uncompressed data for distance codes
+	/* The maximum uncompressed data size of a segment
 	 */
-	uint8_t distance_data[ LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ];
+	size_t maximum_segment_uncompressed_data_size;
 
-	/* The distance data size
+	/* The compressed data size
 	 */
-	size_t distance_data_size;
+	size_t compressed_data_size;
 
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
+	/* The compressed data offset
+	 */
+	size_t compressed_data_offset;
+
+	/* The file offset of the compressed data
+	 */
+	off64_t compressed_data_file_offset;
 
 	/* The uncompressed data
 	 */
 	uint8_t *uncompressed_data;
 
+	/* The uncompressed data offset
+	 * The uncompressed data before the offset contains the history for distance codes
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The uncompressed data of the segment that is being indexed
+	 * which is used to seed the compressed segments cache
+	 */
+	uint8_t *segment_data;
+
+	/* The segment data size
+	 */
+	size_t segment_data_size;
+
+	/* The allocated segment data size
+	 */
+	size_t allocated_segment_data_size;
+
+	/* Value to indicate the uncompressed data of the segment is collected
+	 */
+	uint8_t collect_segment_data;
+
 	/* The file size
 	 */
 	size64_t file_size;
@@ -151,6 +198,10 @@ struct libgzipf_internal_file
 	 */
 	libfcache_cache_t *compressed_segments_cache;
 
+	/* The sequential reader
+	 */
+	libgzipf_sequential_reader_t *sequential_reader;
+
 	/* Various flags
 	 */
 	uint8_t flags;
@@ -159,6 +210,14 @@ struct libgzipf_internal_file
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The checksum verifier
+	 */
+	libgzipf_checksum_verifier_t *checksum_verifier;
+
+	/* The index builder
+	 */
+	libgzipf_index_builder_t *index_builder;
 #endif
 };
 
@@ -177,6 +236,42 @@ int libgzipf_file_signal_abort(
      libgzipf_file_t *file,
      libcerror_error_t **error );
 
+LIBGZIPF_EXTERN \
+int libgzipf_file_set_decoder(
+     libgzipf_file_t *file,
+     int decoder,
+     libcerror_error_t **error );
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_set_checksum_policy(
+     libgzipf_file_t *file,
+     int checksum_policy,
+     libcerror_error_t **error );
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_set_checkpoint_spacing(
+     libgzipf_file_t *file,
+     size_t maximum_compressed_size,
+     size_t maximum_uncompressed_size,
+     libcerror_error_t **error );
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_set_index_mode(
+     libgzipf_file_t *file,
+     int index_mode,
+     libcerror_error_t **error );
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_set_index_progress_callback(
+     libgzipf_file_t *file,
+     void (*progress_callback)(
+             size64_t indexed_compressed_size,
+             size64_t indexed_uncompressed_size,
+             uint8_t is_complete,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
 LIBGZIPF_EXTERN \
 int libgzipf_file_open(
      libgzipf_file_t *file,
@@ -202,27 +297,136 @@ int libgzipf_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBGZIPF_EXTERN \
+int libgzipf_file_open_with_index(
+     libgzipf_file_t *file,
+     const char *filename,
+     const char *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_open_with_index_wide(
+     libgzipf_file_t *file,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_open_file_io_handle_with_index(
+     libgzipf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBGZIPF_EXTERN \
 int libgzipf_file_close(
      libgzipf_file_t *file,
      libcerror_error_t **error );
 
+LIBGZIPF_EXTERN \
+int libgzipf_file_write_index(
+     libgzipf_file_t *file,
+     const char *index_filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_write_index_wide(
+     libgzipf_file_t *file,
+     const wchar_t *index_filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBGZIPF_EXTERN \
+int libgzipf_file_write_index_file_io_handle(
+     libgzipf_file_t *file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
 int libgzipf_internal_file_open_read(
      libgzipf_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libgzipf_internal_file_open_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libgzipf_internal_file_read_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libgzipf_internal_file_write_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libgzipf_internal_file_get_stored_block_data_range(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t number_of_bits,
+     off64_t *data_offset,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 int libgzipf_internal_file_read_deflate_block(
      libgzipf_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
-     libgzipf_member_descriptor_t *member_descriptor,
+     size_t maximum_uncompressed_data_size,
+     uint32_t *checksum,
      size_t *compressed_block_size,
      size_t *uncompressed_block_size,
+     size_t *referenced_history_size,
      uint8_t *is_last_block,
      uint8_t *decompression_error,
      libcerror_error_t **error );
 
+int libgzipf_internal_file_append_segment_data(
+     libgzipf_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libgzipf_internal_file_seed_compressed_segment(
+     libgzipf_internal_file_t *internal_file,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     int element_index,
+     libcerror_error_t **error );
+
+int libgzipf_internal_file_append_compressed_segment(
+     libgzipf_internal_file_t *internal_file,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     int *segment_descriptor_index,
+     libcerror_error_t **error );
+
+int libgzipf_internal_file_append_segment_descriptor(
+     libgzipf_internal_file_t *internal_file,
+     libgzipf_member_descriptor_t *member_descriptor,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     libcerror_error_t **error );
+
+int libgzipf_internal_file_set_segment_distance_data(
+     libgzipf_internal_file_t *internal_file,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *distance_data,
+     size_t distance_data_size,
+     size_t referenced_history_size,
+     uint8_t is_last_block,
+     libcerror_error_t **error );
+
 int libgzipf_internal_file_read_deflate_stream(
      libgzipf_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
@@ -250,6 +454,30 @@ int libgzipf_internal_file_read_members(
      off64_t offset,
      libcerror_error_t **error );
 
+int libgzipf_internal_file_build_index(
+     libgzipf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t *indexed_compressed_size,
+     size64_t *indexed_uncompressed_size,
+     uint8_t *is_complete,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+
+int libgzipf_internal_file_wait_for_index_builder(
+     libgzipf_internal_file_t *internal_file,
+     off64_t offset,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT ) */
+
+int libgzipf_internal_file_get_segment_descriptor_at_offset(
+     libgzipf_internal_file_t *internal_file,
+     off64_t offset,
+     off64_t *element_data_offset,
+     libgzipf_segment_descriptor_t **segment_descriptor,
+     libcerror_error_t **error );
+
 int libgzipf_internal_file_get_compressed_segment_at_offset(
      libgzipf_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
@@ -299,6 +527,12 @@ int libgzipf_file_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBGZIPF_EXTERN \
+int libgzipf_file_wait_for_index(
+     libgzipf_file_t *file,
+     off64_t offset,
+     libcerror_error_t **error );
+
 LIBGZIPF_EXTERN \
 int libgzipf_file_is_corrupted(
      libgzipf_file_t *file,
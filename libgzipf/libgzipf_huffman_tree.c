@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libgzipf_bit_stream.h"
+#include "libgzipf_definitions.h"
 #include "libgzipf_huffman_tree.h"
 #include "libgzipf_libcerror.h"
 #include "libgzipf_libcnotify.h"
@@ -179,6 +180,48 @@ int libgzipf_huffman_tree_initialize(
 
 		goto on_error;
 	}
+	if( maximum_code_size < LIBGZIPF_HUFFMAN_TREE_LOOKUP_TABLE_BITS )
+	{
+		( *huffman_tree )->lookup_table_bits = maximum_code_size;
+	}
+	else
+	{
+		( *huffman_tree )->lookup_table_bits = LIBGZIPF_HUFFMAN_TREE_LOOKUP_TABLE_BITS;
+	}
+	( *huffman_tree )->lookup_table_size = 1 << ( *huffman_tree )->lookup_table_bits;
+
+	array_size = sizeof( uint32_t ) * ( *huffman_tree )->lookup_table_size;
+
+	( *huffman_tree )->lookup_table_data = (uint32_t *) memory_allocate(
+	                                                     array_size );
+
+	if( ( *huffman_tree )->lookup_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lookup table.",
+		 function );
+
+		goto on_error;
+	}
+	( *huffman_tree )->lookup_table = ( *huffman_tree )->lookup_table_data;
+
+	if( memory_set(
+	     ( *huffman_tree )->lookup_table_data,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		goto on_error;
+	}
 	( *huffman_tree )->maximum_code_size = maximum_code_size;
 
 	return( 1 );
@@ -186,6 +229,11 @@ int libgzipf_huffman_tree_initialize(
 on_error:
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table_data != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table_data );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -226,6 +274,11 @@ int libgzipf_huffman_tree_free(
 	}
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table_data != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table_data );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -448,6 +501,21 @@ int libgzipf_huffman_tree_build(
 	memory_free(
 	 symbol_offsets );
 
+	symbol_offsets = NULL;
+
+	if( libgzipf_huffman_tree_build_lookup_table(
+	     huffman_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build lookup table.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -459,19 +527,245 @@ on_error:
 	return( -1 );
 }
 
+/* Builds the lookup table of the Huffman tree
+ * The symbols must be sorted by code size before calling this function
+ * Returns 1 on success or -1 on error
+ */
+int libgzipf_huffman_tree_build_lookup_table(
+     libgzipf_huffman_tree_t *huffman_tree,
+     libcerror_error_t **error )
+{
+	int remaining_code_size_counts[ 33 ];
+
+	uint32_t *lookup_table       = NULL;
+	static char *function        = "libgzipf_huffman_tree_build_lookup_table";
+	size_t array_size            = 0;
+	uint32_t huffman_code        = 0;
+	uint32_t lookup_value        = 0;
+	uint32_t reversed_code       = 0;
+	uint32_t subtable_prefix     = 0;
+	uint16_t symbol              = 0;
+	uint8_t bit_index            = 0;
+	uint8_t code_size            = 0;
+	uint8_t largest_code_size    = 0;
+	uint8_t subtable_bits        = 0;
+	int code_size_count          = 0;
+	int lookup_table_index       = 0;
+	int number_of_entries        = 0;
+	int number_of_unused_entries = 0;
+	int subtable_index           = 0;
+	int symbol_index             = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree->lookup_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Huffman tree - missing lookup table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree->maximum_code_size > 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Huffman tree - maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( bit_index = 1;
+	     bit_index <= huffman_tree->maximum_code_size;
+	     bit_index++ )
+	{
+		remaining_code_size_counts[ bit_index ] = huffman_tree->code_size_counts[ bit_index ];
+
+		if( remaining_code_size_counts[ bit_index ] > 0 )
+		{
+			largest_code_size = bit_index;
+		}
+	}
+	number_of_entries = 1 << huffman_tree->lookup_table_bits;
+
+	array_size = sizeof( uint32_t ) * number_of_entries;
+
+	if( memory_set(
+	     huffman_tree->lookup_table_data,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Walk the canonical Huffman codes in increasing order, since the bit stream
+	 * stores the codes most significant bit first the lookup table is indexed
+	 * with the bit reversed code
+	 */
+	subtable_prefix = (uint32_t) -1;
+
+	for( code_size = 1;
+	     code_size <= largest_code_size;
+	     code_size++ )
+	{
+		for( code_size_count = huffman_tree->code_size_counts[ code_size ];
+		     code_size_count > 0;
+		     code_size_count-- )
+		{
+			symbol = huffman_tree->symbols[ symbol_index++ ];
+
+			reversed_code = 0;
+
+			for( bit_index = 0;
+			     bit_index < code_size;
+			     bit_index++ )
+			{
+				reversed_code <<= 1;
+				reversed_code  |= ( huffman_code >> bit_index ) & 0x00000001UL;
+			}
+			lookup_value = ( (uint32_t) code_size << 16 ) | symbol;
+
+			if( code_size <= huffman_tree->lookup_table_bits )
+			{
+				for( lookup_table_index = (int) reversed_code;
+				     lookup_table_index < ( 1 << huffman_tree->lookup_table_bits );
+				     lookup_table_index += 1 << code_size )
+				{
+					huffman_tree->lookup_table_data[ lookup_table_index ] = lookup_value;
+				}
+			}
+			else
+			{
+				/* Codes with the same prefix are stored in a single subtable
+				 */
+				if( ( reversed_code & ( ( 1 << huffman_tree->lookup_table_bits ) - 1 ) ) != subtable_prefix )
+				{
+					subtable_prefix = reversed_code & ( ( 1 << huffman_tree->lookup_table_bits ) - 1 );
+
+					/* Determine the smallest subtable that can contain the remaining codes with this prefix
+					 */
+					subtable_bits            = code_size - huffman_tree->lookup_table_bits;
+					number_of_unused_entries = 1 << subtable_bits;
+
+					while( ( subtable_bits + huffman_tree->lookup_table_bits ) < largest_code_size )
+					{
+						number_of_unused_entries -= remaining_code_size_counts[ subtable_bits + huffman_tree->lookup_table_bits ];
+
+						if( number_of_unused_entries <= 0 )
+						{
+							break;
+						}
+						subtable_bits            += 1;
+						number_of_unused_entries <<= 1;
+					}
+					subtable_index     = number_of_entries;
+					number_of_entries += 1 << subtable_bits;
+
+					if( number_of_entries > (int) UINT16_MAX )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid number of lookup table entries value exceeds maximum.",
+						 function );
+
+						return( -1 );
+					}
+					if( number_of_entries > huffman_tree->lookup_table_size )
+					{
+						array_size = sizeof( uint32_t ) * number_of_entries;
+
+						lookup_table = (uint32_t *) memory_reallocate(
+						                             huffman_tree->lookup_table_data,
+						                             array_size );
+
+						if( lookup_table == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+							 "%s: unable to resize lookup table.",
+							 function );
+
+							return( -1 );
+						}
+						huffman_tree->lookup_table      = lookup_table;
+						huffman_tree->lookup_table_data = lookup_table;
+						huffman_tree->lookup_table_size = number_of_entries;
+					}
+					array_size = sizeof( uint32_t ) << subtable_bits;
+
+					if( memory_set(
+					     &( huffman_tree->lookup_table_data[ subtable_index ] ),
+					     0,
+					     array_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear lookup subtable.",
+						 function );
+
+						return( -1 );
+					}
+					huffman_tree->lookup_table_data[ subtable_prefix ] = 0x80000000UL
+					                                                   | ( (uint32_t) subtable_bits << 16 )
+					                                                   | (uint32_t) subtable_index;
+				}
+				for( lookup_table_index = (int) ( reversed_code >> huffman_tree->lookup_table_bits );
+				     lookup_table_index < ( 1 << subtable_bits );
+				     lookup_table_index += 1 << ( code_size - huffman_tree->lookup_table_bits ) )
+				{
+					huffman_tree->lookup_table_data[ subtable_index + lookup_table_index ] = lookup_value;
+				}
+			}
+			remaining_code_size_counts[ code_size ] -= 1;
+
+			huffman_code++;
+		}
+		huffman_code <<= 1;
+	}
+	return( 1 );
+}
+
 /* Retrieves a symbol based on the Huffman code read from the bit-stream
  * Returns 1 on success or -1 on error
  */
 int libgzipf_huffman_tree_get_symbol_from_bit_stream(
-     libgzipf_huffman_tree_t *huffman_tree,
+     const libgzipf_huffman_tree_t *huffman_tree,
      libgzipf_bit_stream_t *bit_stream,
      uint16_t *symbol,
      libcerror_error_t **error )
 {
 	static char *function  = "libgzipf_huffman_tree_get_symbol_from_bit_stream";
+	uint32_t lookup_value  = 0;
 	uint32_t value_32bit   = 0;
 	uint16_t safe_symbol   = 0;
 	uint8_t bit_index      = 0;
+	uint8_t code_size      = 0;
 	int code_size_count    = 0;
 	int first_huffman_code = 0;
 	int first_index        = 0;
@@ -511,8 +805,43 @@ int libgzipf_huffman_tree_get_symbol_from_bit_stream(
 
 		return( -1 );
 	}
-/* TODO get maximum_code_size of bits into local bit buffer */
+	if( bit_stream->storage_type == LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		/* Fill the bit buffer so that it contains at least the maximum code size
+		 * number of bits, unless the end of the byte stream was reached
+		 */
+		if( bit_stream->bit_buffer_size < huffman_tree->maximum_code_size )
+		{
+			libgzipf_bit_stream_refill(
+			 bit_stream );
+		}
+		lookup_value = libgzipf_huffman_tree_get_lookup_value(
+		                huffman_tree,
+		                bit_stream );
+
+		code_size = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		if( ( code_size == 0 )
+		 || ( code_size > bit_stream->bit_buffer_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+			 function,
+			 libgzipf_bit_stream_peek( bit_stream, 32 ) );
+
+			return( -1 );
+		}
+		libgzipf_bit_stream_consume(
+		 bit_stream,
+		 code_size );
 
+		*symbol = (uint16_t) ( lookup_value & 0x0000ffffUL );
+
+		return( 1 );
+	}
 	for( bit_index = 1;
 	     bit_index <= huffman_tree->maximum_code_size;
 	     bit_index++ )
@@ -47,6 +47,29 @@ struct libgzipf_huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The number of bits used to index the primary lookup table
+	 */
+	uint8_t lookup_table_bits;
+
+	/* The lookup table
+	 * The primary lookup table is followed by the subtables for codes
+	 * that are larger than the number of lookup table bits.
+	 * Every entry contains:
+	 *   bits 0 - 15  the symbol or the index of the subtable
+	 *   bits 16 - 23 the code size or the number of subtable bits
+	 *   bit 31       set if the entry refers to a subtable
+	 */
+	const uint32_t *lookup_table;
+
+	/* The lookup table data allocated by the Huffman tree
+	 * This value is NULL if the lookup table is not owned by the Huffman tree
+	 */
+	uint32_t *lookup_table_data;
+
+	/* The number of entries of the lookup table
+	 */
+	int lookup_table_size;
 };
 
 int libgzipf_huffman_tree_initialize(
@@ -65,8 +88,34 @@ int libgzipf_huffman_tree_build(
      int number_of_code_sizes,
      libcerror_error_t **error );
 
-int libgzipf_huffman_tree_get_symbol_from_bit_stream(
+int libgzipf_huffman_tree_build_lookup_table(
      libgzipf_huffman_tree_t *huffman_tree,
+     libcerror_error_t **error );
+
+/* Retrieves the lookup table value of the next Huffman code of a byte back-to-front bit stream
+ * The code size of the lookup table value is 0 if the Huffman code is invalid
+ * The caller is responsible for making sure the bit buffer holds sufficient bits
+ */
+static LIBGZIPF_INLINE uint32_t libgzipf_huffman_tree_get_lookup_value(
+     const libgzipf_huffman_tree_t *huffman_tree,
+     libgzipf_bit_stream_t *bit_stream )
+{
+	uint32_t lookup_value = 0;
+	uint8_t subtable_bits = 0;
+
+	lookup_value = huffman_tree->lookup_table[ libgzipf_bit_stream_peek( bit_stream, huffman_tree->lookup_table_bits ) ];
+
+	if( ( lookup_value & 0x80000000UL ) != 0 )
+	{
+		subtable_bits = (uint8_t) ( ( lookup_value >> 16 ) & 0x000000ffUL );
+
+		lookup_value = huffman_tree->lookup_table[ ( lookup_value & 0x0000ffffUL ) + ( (uint32_t) ( bit_stream->bit_buffer >> huffman_tree->lookup_table_bits ) & ( ( 1 << subtable_bits ) - 1 ) ) ];
+	}
+	return( lookup_value );
+}
+
+int libgzipf_huffman_tree_get_symbol_from_bit_stream(
+     const libgzipf_huffman_tree_t *huffman_tree,
      libgzipf_bit_stream_t *bit_stream,
      uint16_t *symbol,
      libcerror_error_t **error );
@@ -0,0 +1,1618 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_checksum.h"
+#include "libgzipf_definitions.h"
+#include "libgzipf_index.h"
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_libcnotify.h"
+#include "libgzipf_member_descriptor.h"
+#include "libgzipf_segment_descriptor.h"
+
+#include "gzipf_index.h"
+
+const uint8_t *gzipf_index_signature = (uint8_t *) "gzipfidx";
+
+/* Calculates the fingerprint of a GZIP file
+ * The fingerprint is the CRC-32 of the data at the start and at the end of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_calculate_fingerprint(
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t *fingerprint,
+     libcerror_error_t **error )
+{
+	uint8_t *data             = NULL;
+	static char *function     = "libgzipf_index_calculate_fingerprint";
+	size_t read_size          = LIBGZIPF_INDEX_FINGERPRINT_DATA_SIZE;
+	ssize_t read_count        = 0;
+	uint32_t safe_fingerprint = 0;
+	off64_t file_offset       = 0;
+
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size < (size64_t) read_size )
+	{
+		read_size = (size_t) file_size;
+	}
+	if( read_size > 0 )
+	{
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * read_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		/* The data at the start of the file contains the member header
+		 * and the data at the end of the file the member footer
+		 */
+		while( file_offset >= 0 )
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              data,
+			              read_size,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			if( libgzipf_checksum_calculate_crc32(
+			     &safe_fingerprint,
+			     data,
+			     read_size,
+			     safe_fingerprint,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to calculate checksum.",
+				 function );
+
+				goto on_error;
+			}
+			if( file_offset != 0 )
+			{
+				break;
+			}
+			file_offset = (off64_t) ( file_size - read_size );
+
+			if( file_offset == 0 )
+			{
+				break;
+			}
+		}
+		memory_free(
+		 data );
+	}
+	*fingerprint = safe_fingerprint;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Reads data from an index file
+ * The checksum is updated with the CRC-32 of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_read_data(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint8_t *data,
+     size_t data_size,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_read_data";
+	ssize_t read_count    = 0;
+
+	if( index_file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              data,
+	              data_size,
+	              *index_file_offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 *index_file_offset,
+		 *index_file_offset );
+
+		return( -1 );
+	}
+	if( libgzipf_checksum_calculate_crc32(
+	     checksum,
+	     data,
+	     data_size,
+	     *checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	*index_file_offset += (off64_t) data_size;
+
+	return( 1 );
+}
+
+/* Writes data to an index file
+ * The checksum is updated with the CRC-32 of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_write_data(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_write_data";
+	ssize_t write_count   = 0;
+
+	if( index_file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               index_file_io_handle,
+	               data,
+	               data_size,
+	               *index_file_offset,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 *index_file_offset,
+		 *index_file_offset );
+
+		return( -1 );
+	}
+	if( libgzipf_checksum_calculate_crc32(
+	     checksum,
+	     data,
+	     data_size,
+	     *checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	*index_file_offset += (off64_t) data_size;
+
+	return( 1 );
+}
+
+/* Reads the index file header
+ * Returns 1 if successful, 0 if not a supported index file or -1 on error
+ */
+int libgzipf_index_read_file_header(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t *flags,
+     size64_t *file_size,
+     uint32_t *fingerprint,
+     int *number_of_members,
+     int *number_of_segments,
+     off64_t *compressed_segments_offset,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( gzipf_index_file_header_t ) ];
+
+	static char *function   = "libgzipf_index_read_file_header";
+	uint64_t value_64bit    = 0;
+	uint32_t format_version = 0;
+	uint32_t value_32bit    = 0;
+
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_members == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of members.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_segments_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed segments offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_index_read_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     file_header_data,
+	     sizeof( gzipf_index_file_header_t ),
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: index file header data:\n",
+		 function );
+		libcnotify_print_data(
+		 file_header_data,
+		 sizeof( gzipf_index_file_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     ( (gzipf_index_file_header_t *) file_header_data )->signature,
+	     gzipf_index_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->format_version,
+	 format_version );
+
+	if( format_version != LIBGZIPF_INDEX_FORMAT_VERSION )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->flags,
+	 *flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->file_size,
+	 *file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->fingerprint,
+	 *fingerprint );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->number_of_members,
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of members value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_members = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->number_of_segments,
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_segments = (int) value_32bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->compressed_segments_offset,
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed segments offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_segments_offset = (off64_t) value_64bit;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 *flags );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 *file_size );
+
+		libcnotify_printf(
+		 "%s: fingerprint\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 *fingerprint );
+
+		libcnotify_printf(
+		 "%s: number of members\t\t: %d\n",
+		 function,
+		 *number_of_members );
+
+		libcnotify_printf(
+		 "%s: number of segments\t\t: %d\n",
+		 function,
+		 *number_of_segments );
+
+		libcnotify_printf(
+		 "%s: compressed segments offset\t: %" PRIi64 "\n",
+		 function,
+		 *compressed_segments_offset );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Writes the index file header
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_write_file_header(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t flags,
+     size64_t file_size,
+     uint32_t fingerprint,
+     int number_of_members,
+     int number_of_segments,
+     off64_t compressed_segments_offset,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( gzipf_index_file_header_t ) ];
+
+	static char *function = "libgzipf_index_write_file_header";
+
+	if( number_of_members < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of members value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of segments value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_segments_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid compressed segments offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_header_data,
+	     0,
+	     sizeof( gzipf_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (gzipf_index_file_header_t *) file_header_data )->signature,
+	     gzipf_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->format_version,
+	 LIBGZIPF_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->flags,
+	 flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->file_size,
+	 file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->fingerprint,
+	 fingerprint );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->number_of_members,
+	 (uint32_t) number_of_members );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->number_of_segments,
+	 (uint32_t) number_of_segments );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_file_header_t *) file_header_data )->compressed_segments_offset,
+	 (uint64_t) compressed_segments_offset );
+
+	if( libgzipf_index_write_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     file_header_data,
+	     sizeof( gzipf_index_file_header_t ),
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file header data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a member descriptor from the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_read_member_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_member_descriptor_t *member_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t member_data[ sizeof( gzipf_index_member_t ) ];
+
+	static char *function = "libgzipf_index_read_member_descriptor";
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+
+	if( member_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( member_descriptor->name != NULL )
+	 || ( member_descriptor->comments != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid member descriptor - name or comments value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_index_read_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     member_data,
+	     sizeof( gzipf_index_member_t ),
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index member data.",
+		 function );
+
+		goto on_error;
+	}
+	member_descriptor->flags               = ( (gzipf_index_member_t *) member_data )->flags;
+	member_descriptor->operating_system    = ( (gzipf_index_member_t *) member_data )->operating_system;
+	member_descriptor->decompression_error = ( (gzipf_index_member_t *) member_data )->decompression_error;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->modification_time,
+	 member_descriptor->modification_time );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->data_size,
+	 member_descriptor->data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->compressed_data_offset,
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	member_descriptor->compressed_data_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->compressed_data_size,
+	 member_descriptor->compressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->uncompressed_data_size,
+	 member_descriptor->uncompressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->calculated_checksum,
+	 member_descriptor->calculated_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->stored_checksum,
+	 member_descriptor->stored_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->first_segment_index,
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first segment index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	member_descriptor->first_segment_descriptor_index = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->number_of_segments,
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	member_descriptor->number_of_segment_descriptors = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->name_size,
+	 value_32bit );
+
+	if( (size_t) value_32bit > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	member_descriptor->name_size = (size_t) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->comments_size,
+	 value_32bit );
+
+	if( (size_t) value_32bit > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid comments size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	member_descriptor->comments_size = (size_t) value_32bit;
+
+	if( member_descriptor->name_size > 0 )
+	{
+		member_descriptor->name = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * member_descriptor->name_size );
+
+		if( member_descriptor->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_index_read_data(
+		     index_file_io_handle,
+		     index_file_offset,
+		     member_descriptor->name,
+		     member_descriptor->name_size,
+		     checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( member_descriptor->comments_size > 0 )
+	{
+		member_descriptor->comments = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * member_descriptor->comments_size );
+
+		if( member_descriptor->comments == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create comments.",
+			 function );
+
+			goto on_error;
+		}
+		if( libgzipf_index_read_data(
+		     index_file_io_handle,
+		     index_file_offset,
+		     member_descriptor->comments,
+		     member_descriptor->comments_size,
+		     checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read comments.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( member_descriptor->comments != NULL )
+	{
+		memory_free(
+		 member_descriptor->comments );
+
+		member_descriptor->comments = NULL;
+	}
+	member_descriptor->comments_size = 0;
+
+	if( member_descriptor->name != NULL )
+	{
+		memory_free(
+		 member_descriptor->name );
+
+		member_descriptor->name = NULL;
+	}
+	member_descriptor->name_size = 0;
+
+	return( -1 );
+}
+
+/* Writes a member descriptor to the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_write_member_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_member_descriptor_t *member_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t member_data[ sizeof( gzipf_index_member_t ) ];
+
+	static char *function = "libgzipf_index_write_member_descriptor";
+
+	if( member_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( member_descriptor->name_size > (size_t) UINT32_MAX )
+	 || ( member_descriptor->comments_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member descriptor - name or comments size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     member_data,
+	     0,
+	     sizeof( gzipf_index_member_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index member data.",
+		 function );
+
+		return( -1 );
+	}
+	( (gzipf_index_member_t *) member_data )->flags               = member_descriptor->flags;
+	( (gzipf_index_member_t *) member_data )->operating_system    = member_descriptor->operating_system;
+	( (gzipf_index_member_t *) member_data )->decompression_error = member_descriptor->decompression_error;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->modification_time,
+	 member_descriptor->modification_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->data_size,
+	 member_descriptor->data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->compressed_data_offset,
+	 (uint64_t) member_descriptor->compressed_data_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->compressed_data_size,
+	 member_descriptor->compressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->uncompressed_data_size,
+	 member_descriptor->uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->calculated_checksum,
+	 member_descriptor->calculated_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->stored_checksum,
+	 member_descriptor->stored_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->first_segment_index,
+	 (uint32_t) member_descriptor->first_segment_descriptor_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->number_of_segments,
+	 (uint32_t) member_descriptor->number_of_segment_descriptors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->name_size,
+	 (uint32_t) member_descriptor->name_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_member_t *) member_data )->comments_size,
+	 (uint32_t) member_descriptor->comments_size );
+
+	if( libgzipf_index_write_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     member_data,
+	     sizeof( gzipf_index_member_t ),
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index member data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_index_write_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     member_descriptor->name,
+	     member_descriptor->name_size,
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_index_write_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     member_descriptor->comments,
+	     member_descriptor->comments_size,
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write comments.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a segment descriptor from the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_read_segment_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t block_state_data[ LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE ];
+	uint8_t distance_data[ LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ];
+	uint8_t segment_data[ sizeof( gzipf_index_segment_t ) ];
+
+	static char *function          = "libgzipf_index_read_segment_descriptor";
+	uint64_t value_64bit           = 0;
+	uint32_t distance_data_size    = 0;
+	uint16_t block_state_data_size = 0;
+	uint8_t segment_flags          = 0;
+
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_index_read_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     segment_data,
+	     sizeof( gzipf_index_segment_t ),
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index segment data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->compressed_data_offset,
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_descriptor->compressed_data_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->compressed_data_size,
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_descriptor->compressed_data_size = (size_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->uncompressed_data_size,
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_descriptor->uncompressed_data_size = (size_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->stored_data_offset,
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stored data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_descriptor->stored_data_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->checksum,
+	 segment_descriptor->checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->distance_data_size,
+	 distance_data_size );
+
+	if( distance_data_size > LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid distance data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_descriptor->number_of_bits = ( (gzipf_index_segment_t *) segment_data )->number_of_bits;
+
+	if( segment_descriptor->number_of_bits > 7 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_flags = ( (gzipf_index_segment_t *) segment_data )->segment_flags;
+
+	if( ( segment_flags & LIBGZIPF_INDEX_SEGMENT_FLAG_IS_STORED ) != 0 )
+	{
+		segment_descriptor->is_stored = 1;
+	}
+	if( ( segment_flags & LIBGZIPF_INDEX_SEGMENT_FLAG_HAS_CHECKSUM ) != 0 )
+	{
+		segment_descriptor->has_checksum = 1;
+	}
+	if( ( segment_flags & LIBGZIPF_INDEX_SEGMENT_FLAG_HAS_BLOCK_STATE ) != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (gzipf_index_segment_t *) segment_data )->block_state_data_size,
+		 block_state_data_size );
+
+		if( ( block_state_data_size == 0 )
+		 || ( block_state_data_size > LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block state data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libgzipf_index_read_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     distance_data,
+	     (size_t) distance_data_size,
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distance data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_segment_descriptor_set_distance_data(
+	     segment_descriptor,
+	     distance_data,
+	     (size_t) distance_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set distance data in segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_state_data_size > 0 )
+	{
+		if( libgzipf_index_read_data(
+		     index_file_io_handle,
+		     index_file_offset,
+		     block_state_data,
+		     (size_t) block_state_data_size,
+		     checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block state data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libgzipf_segment_descriptor_set_block_state_data(
+		     segment_descriptor,
+		     block_state_data,
+		     (size_t) block_state_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block state data in segment descriptor.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a segment descriptor to the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_write_segment_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t distance_data[ LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ];
+	uint8_t segment_data[ sizeof( gzipf_index_segment_t ) ];
+
+	static char *function = "libgzipf_index_write_segment_descriptor";
+	uint8_t segment_flags = 0;
+
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->distance_data_size > LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment descriptor - distance data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->block_state_data_size > (size_t) LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment descriptor - block state data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     segment_data,
+	     0,
+	     sizeof( gzipf_index_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->is_stored != 0 )
+	{
+		segment_flags |= LIBGZIPF_INDEX_SEGMENT_FLAG_IS_STORED;
+	}
+	if( segment_descriptor->has_checksum != 0 )
+	{
+		segment_flags |= LIBGZIPF_INDEX_SEGMENT_FLAG_HAS_CHECKSUM;
+	}
+	if( segment_descriptor->block_state_data_size > 0 )
+	{
+		segment_flags |= LIBGZIPF_INDEX_SEGMENT_FLAG_HAS_BLOCK_STATE;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->compressed_data_offset,
+	 (uint64_t) segment_descriptor->compressed_data_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->compressed_data_size,
+	 (uint64_t) segment_descriptor->compressed_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->uncompressed_data_size,
+	 (uint64_t) segment_descriptor->uncompressed_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->stored_data_offset,
+	 (uint64_t) segment_descriptor->stored_data_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->checksum,
+	 segment_descriptor->checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->distance_data_size,
+	 (uint32_t) segment_descriptor->distance_data_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (gzipf_index_segment_t *) segment_data )->block_state_data_size,
+	 (uint16_t) segment_descriptor->block_state_data_size );
+
+	( (gzipf_index_segment_t *) segment_data )->number_of_bits = segment_descriptor->number_of_bits;
+	( (gzipf_index_segment_t *) segment_data )->segment_flags  = segment_flags;
+
+	if( libgzipf_index_write_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     segment_data,
+	     sizeof( gzipf_index_segment_t ),
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_segment_descriptor_get_distance_data(
+	     segment_descriptor,
+	     distance_data,
+	     LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve distance data from segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_index_write_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     distance_data,
+	     segment_descriptor->distance_data_size,
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write distance data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->block_state_data_size > 0 )
+	{
+		if( libgzipf_index_write_data(
+		     index_file_io_handle,
+		     index_file_offset,
+		     segment_descriptor->block_state_data,
+		     segment_descriptor->block_state_data_size,
+		     checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block state data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the index file footer
+ * Returns 1 if successful, 0 if the checksum does not match or -1 on error
+ */
+int libgzipf_index_read_file_footer(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t checksum,
+     libcerror_error_t **error )
+{
+	uint8_t file_footer_data[ sizeof( gzipf_index_file_footer_t ) ];
+
+	static char *function    = "libgzipf_index_read_file_footer";
+	uint32_t footer_checksum = 0;
+	uint32_t stored_checksum = 0;
+
+	if( libgzipf_index_read_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     file_footer_data,
+	     sizeof( gzipf_index_file_footer_t ),
+	     &footer_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file footer data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (gzipf_index_file_footer_t *) file_footer_data )->checksum,
+	 stored_checksum );
+
+	if( stored_checksum != checksum )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in index checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 checksum );
+		}
+#endif
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Writes the index file footer
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_write_file_footer(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t checksum,
+     libcerror_error_t **error )
+{
+	uint8_t file_footer_data[ sizeof( gzipf_index_file_footer_t ) ];
+
+	static char *function    = "libgzipf_index_write_file_footer";
+	uint32_t footer_checksum = 0;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (gzipf_index_file_footer_t *) file_footer_data )->checksum,
+	 checksum );
+
+	if( libgzipf_index_write_data(
+	     index_file_io_handle,
+	     index_file_offset,
+	     file_footer_data,
+	     sizeof( gzipf_index_file_footer_t ),
+	     &footer_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file footer data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,128 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_INDEX_H )
+#define _LIBGZIPF_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_member_descriptor.h"
+#include "libgzipf_segment_descriptor.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libgzipf_index_calculate_fingerprint(
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t *fingerprint,
+     libcerror_error_t **error );
+
+int libgzipf_index_read_data(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint8_t *data,
+     size_t data_size,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_write_data(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_read_file_header(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t *flags,
+     size64_t *file_size,
+     uint32_t *fingerprint,
+     int *number_of_members,
+     int *number_of_segments,
+     off64_t *compressed_segments_offset,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_write_file_header(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t flags,
+     size64_t file_size,
+     uint32_t fingerprint,
+     int number_of_members,
+     int number_of_segments,
+     off64_t compressed_segments_offset,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_read_member_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_member_descriptor_t *member_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_write_member_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_member_descriptor_t *member_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_read_segment_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_write_segment_descriptor(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_read_file_footer(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t checksum,
+     libcerror_error_t **error );
+
+int libgzipf_index_write_file_footer(
+     libbfio_handle_t *index_file_io_handle,
+     off64_t *index_file_offset,
+     uint32_t checksum,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_INDEX_H ) */
+
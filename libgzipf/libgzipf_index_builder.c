@@ -0,0 +1,770 @@
+/*
+ * Index builder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_index_builder.h"
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_libcnotify.h"
+#include "libgzipf_libcthreads.h"
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+
+/* Creates an index builder
+ * Make sure the value index_builder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_builder_initialize(
+     libgzipf_index_builder_t **index_builder,
+     intptr_t *file,
+     int (*index_function)(
+            intptr_t *file,
+            libbfio_handle_t *file_io_handle,
+            size64_t *indexed_compressed_size,
+            size64_t *indexed_uncompressed_size,
+            uint8_t *is_complete,
+            libcerror_error_t **error ),
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_builder_initialize";
+	int result            = 0;
+
+	if( index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_builder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index builder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index function.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*index_builder = memory_allocate_structure(
+	                  libgzipf_index_builder_t );
+
+	if( *index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_builder,
+	     0,
+	     sizeof( libgzipf_index_builder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index builder.",
+		 function );
+
+		memory_free(
+		 *index_builder );
+
+		*index_builder = NULL;
+
+		return( -1 );
+	}
+	( *index_builder )->file           = file;
+	( *index_builder )->index_function = index_function;
+
+	/* The index builder thread reads the file independently of the readers of the file
+	 */
+	if( libbfio_handle_clone(
+	     &( ( *index_builder )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *index_builder )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *index_builder )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *index_builder )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *index_builder )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index_builder != NULL )
+	{
+		if( ( *index_builder )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *index_builder )->mutex ),
+			 NULL );
+		}
+		if( ( *index_builder )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *index_builder )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *index_builder );
+
+		*index_builder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a index builder
+ * The index builder thread is stopped if it is running
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_builder_free(
+     libgzipf_index_builder_t **index_builder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_builder_free";
+	int result            = 1;
+
+	if( index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_builder != NULL )
+	{
+		if( ( *index_builder )->thread != NULL )
+		{
+			if( libgzipf_index_builder_stop(
+			     *index_builder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop index builder thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *index_builder )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *index_builder )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_close(
+		     ( *index_builder )->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *index_builder )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *index_builder );
+
+		*index_builder = NULL;
+	}
+	return( result );
+}
+
+/* Starts the index builder thread
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_builder_start(
+     libgzipf_index_builder_t *index_builder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_builder_start";
+
+	if( index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_builder->thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index builder - thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_create(
+	     &( index_builder->thread ),
+	     NULL,
+	     (int (*)(void *)) &libgzipf_index_builder_thread_function,
+	     (void *) index_builder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the index builder thread
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_builder_stop(
+     libgzipf_index_builder_t *index_builder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_builder_stop";
+
+	if( index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_builder->thread == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     index_builder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	index_builder->abort = 1;
+
+	if( libcthreads_condition_broadcast(
+	     index_builder->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 index_builder->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     index_builder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_join(
+	     &( index_builder->thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the progress callback
+ * The callback is called by the index builder thread without any lock held
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_builder_set_progress_callback(
+     libgzipf_index_builder_t *index_builder,
+     void (*progress_callback)(
+             size64_t indexed_compressed_size,
+             size64_t indexed_uncompressed_size,
+             uint8_t is_complete,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_builder_set_progress_callback";
+
+	if( index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_builder->thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index builder - thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	index_builder->progress_callback           = progress_callback;
+	index_builder->progress_callback_user_data = user_data;
+
+	return( 1 );
+}
+
+/* Waits until the uncompressed data at a specific offset has been indexed
+ * An offset of -1 waits until the file has been fully indexed
+ * Returns 1 if the offset has been indexed, 0 if not or -1 on error
+ */
+int libgzipf_index_builder_wait(
+     libgzipf_index_builder_t *index_builder,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_index_builder_wait";
+	int result            = 0;
+
+	if( index_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     index_builder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( index_builder->thread != NULL )
+	    && ( index_builder->abort == 0 )
+	    && ( index_builder->is_complete == 0 )
+	    && ( ( offset < 0 )
+	      || ( (size64_t) offset >= index_builder->indexed_uncompressed_size ) ) )
+	{
+		if( libcthreads_condition_wait(
+		     index_builder->condition,
+		     index_builder->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result != -1 )
+	{
+		if( index_builder->has_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to index file.",
+			 function );
+
+			result = -1;
+		}
+		else if( offset < 0 )
+		{
+			result = (int) index_builder->is_complete;
+		}
+		else if( (size64_t) offset < index_builder->indexed_uncompressed_size )
+		{
+			result = 1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     index_builder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* The index builder thread function
+ * The file is indexed a part at a time so that the readers of the file
+ * can use the part that has been indexed while the rest is being indexed
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_index_builder_thread_function(
+     libgzipf_index_builder_t *index_builder )
+{
+	libcerror_error_t *error           = NULL;
+	static char *function              = "libgzipf_index_builder_thread_function";
+	size64_t indexed_compressed_size   = 0;
+	size64_t indexed_uncompressed_size = 0;
+	uint8_t abort                      = 0;
+	uint8_t is_complete                = 0;
+	int result                         = 0;
+
+	if( index_builder == NULL )
+	{
+		return( -1 );
+	}
+	while( ( abort == 0 )
+	    && ( is_complete == 0 ) )
+	{
+		result = index_builder->index_function(
+		          index_builder->file,
+		          index_builder->file_io_handle,
+		          &indexed_compressed_size,
+		          &indexed_uncompressed_size,
+		          &is_complete,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to index file.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+		/* The progress is reported before it is made available to the waiting
+		 * readers, so that the callback has reported completion when a wait
+		 * for the complete index returns
+		 */
+		if( ( result == 1 )
+		 && ( index_builder->progress_callback != NULL ) )
+		{
+			index_builder->progress_callback(
+			 indexed_compressed_size,
+			 indexed_uncompressed_size,
+			 is_complete,
+			 index_builder->progress_callback_user_data );
+		}
+		if( libcthreads_mutex_grab(
+		     index_builder->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* Stop indexing after an error
+		 */
+		if( result != 1 )
+		{
+			index_builder->has_failed = 1;
+
+			is_complete = 1;
+		}
+		else
+		{
+			index_builder->indexed_compressed_size   = indexed_compressed_size;
+			index_builder->indexed_uncompressed_size = indexed_uncompressed_size;
+		}
+		index_builder->is_complete = is_complete;
+
+		abort = index_builder->abort;
+
+		libcthreads_condition_broadcast(
+		 index_builder->condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 index_builder->mutex,
+		 NULL );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	/* Mark the index builder as failed and wake up the waiting readers,
+	 * otherwise they wait for an index that is never completed. The state
+	 * is still changed if the mutex cannot be grabbed a second time.
+	 */
+	result = libcthreads_mutex_grab(
+	          index_builder->mutex,
+	          NULL );
+
+	index_builder->has_failed  = 1;
+	index_builder->is_complete = 1;
+
+	libcthreads_condition_broadcast(
+	 index_builder->condition,
+	 NULL );
+
+	if( result == 1 )
+	{
+		libcthreads_mutex_release(
+		 index_builder->mutex,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,155 @@
+/*
+ * Index builder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_INDEX_BUILDER_H )
+#define _LIBGZIPF_INDEX_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT )
+
+typedef struct libgzipf_index_builder libgzipf_index_builder_t;
+
+struct libgzipf_index_builder
+{
+	/* The file, which is owned by the caller
+	 */
+	intptr_t *file;
+
+	/* The index function, which indexes the next part of the file
+	 */
+	int (*index_function)(
+	       intptr_t *file,
+	       libbfio_handle_t *file_io_handle,
+	       size64_t *indexed_compressed_size,
+	       size64_t *indexed_uncompressed_size,
+	       uint8_t *is_complete,
+	       libcerror_error_t **error );
+
+	/* The progress callback
+	 */
+	void (*progress_callback)(
+	        size64_t indexed_compressed_size,
+	        size64_t indexed_uncompressed_size,
+	        uint8_t is_complete,
+	        void *user_data );
+
+	/* The progress callback user data
+	 */
+	void *progress_callback_user_data;
+
+	/* The file IO handle used by the index builder thread
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The index builder thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The mutex, which protects the values below
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, which is broadcasted when the values below change
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The compressed size that has been indexed
+	 */
+	size64_t indexed_compressed_size;
+
+	/* The uncompressed size that has been indexed
+	 */
+	size64_t indexed_uncompressed_size;
+
+	/* Value to indicate the file has been fully indexed
+	 */
+	uint8_t is_complete;
+
+	/* Value to indicate the index function failed
+	 */
+	uint8_t has_failed;
+
+	/* Value to indicate the index builder thread should stop
+	 */
+	uint8_t abort;
+};
+
+int libgzipf_index_builder_initialize(
+     libgzipf_index_builder_t **index_builder,
+     intptr_t *file,
+     int (*index_function)(
+            intptr_t *file,
+            libbfio_handle_t *file_io_handle,
+            size64_t *indexed_compressed_size,
+            size64_t *indexed_uncompressed_size,
+            uint8_t *is_complete,
+            libcerror_error_t **error ),
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libgzipf_index_builder_free(
+     libgzipf_index_builder_t **index_builder,
+     libcerror_error_t **error );
+
+int libgzipf_index_builder_set_progress_callback(
+     libgzipf_index_builder_t *index_builder,
+     void (*progress_callback)(
+             size64_t indexed_compressed_size,
+             size64_t indexed_uncompressed_size,
+             uint8_t is_complete,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libgzipf_index_builder_start(
+     libgzipf_index_builder_t *index_builder,
+     libcerror_error_t **error );
+
+int libgzipf_index_builder_stop(
+     libgzipf_index_builder_t *index_builder,
+     libcerror_error_t **error );
+
+int libgzipf_index_builder_wait(
+     libgzipf_index_builder_t *index_builder,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libgzipf_index_builder_thread_function(
+     libgzipf_index_builder_t *index_builder );
+
+#endif /* defined( HAVE_LIBGZIPF_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_INDEX_BUILDER_H ) */
+
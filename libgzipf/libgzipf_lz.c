@@ -0,0 +1,633 @@
+/*
+ * LZ compression functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_libcerror.h"
+#include "libgzipf_lz.h"
+
+/* The LZ compressed data consists of sequences of:
+ * a token byte, with the number of literals in the upper 4 bits and the match size - 4 in the lower 4 bits,
+ * additional bytes of the number of literals if the upper 4 bits are 15,
+ * the literals,
+ * a 16-bit little-endian match distance,
+ * additional bytes of the match size if the lower 4 bits are 15.
+ *
+ * The last sequence only contains literals. An additional size byte of 255 indicates another size byte follows.
+ */
+
+#define LIBGZIPF_LZ_HASH_TABLE_SIZE		4096
+#define LIBGZIPF_LZ_MINIMUM_MATCH_SIZE		4
+#define LIBGZIPF_LZ_MAXIMUM_MATCH_DISTANCE	65535
+
+#define libgzipf_lz_calculate_hash( data ) \
+	( ( ( (uint32_t) ( data )[ 0 ] | ( (uint32_t) ( data )[ 1 ] << 8 ) | ( (uint32_t) ( data )[ 2 ] << 16 ) | ( (uint32_t) ( data )[ 3 ] << 24 ) ) * 2654435761UL ) >> 20 ) & ( LIBGZIPF_LZ_HASH_TABLE_SIZE - 1 )
+
+/* Writes a LZ sequence
+ * Returns 1 on success, 0 if the compressed data is too small or -1 on error
+ */
+int libgzipf_lz_write_sequence(
+     const uint8_t *literals,
+     size_t number_of_literals,
+     uint16_t match_distance,
+     size_t match_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_lz_write_sequence";
+	size_t data_offset    = 0;
+	size_t remaining_size = 0;
+	uint8_t token         = 0;
+
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = *compressed_data_offset;
+
+	if( match_size > 0 )
+	{
+		match_size -= LIBGZIPF_LZ_MINIMUM_MATCH_SIZE;
+	}
+	if( number_of_literals >= 15 )
+	{
+		token = 0xf0;
+	}
+	else
+	{
+		token = (uint8_t) ( number_of_literals << 4 );
+	}
+	if( match_size >= 15 )
+	{
+		token |= 0x0f;
+	}
+	else
+	{
+		token |= (uint8_t) match_size;
+	}
+	if( data_offset >= compressed_data_size )
+	{
+		return( 0 );
+	}
+	compressed_data[ data_offset++ ] = token;
+
+	if( number_of_literals >= 15 )
+	{
+		for( remaining_size = number_of_literals - 15;
+		     remaining_size >= 255;
+		     remaining_size -= 255 )
+		{
+			if( data_offset >= compressed_data_size )
+			{
+				return( 0 );
+			}
+			compressed_data[ data_offset++ ] = 255;
+		}
+		if( data_offset >= compressed_data_size )
+		{
+			return( 0 );
+		}
+		compressed_data[ data_offset++ ] = (uint8_t) remaining_size;
+	}
+	if( number_of_literals > ( compressed_data_size - data_offset ) )
+	{
+		return( 0 );
+	}
+	if( number_of_literals > 0 )
+	{
+		if( memory_copy(
+		     &( compressed_data[ data_offset ] ),
+		     literals,
+		     number_of_literals ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy literals.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += number_of_literals;
+	}
+	if( match_distance > 0 )
+	{
+		if( ( compressed_data_size - data_offset ) < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( compressed_data[ data_offset ] ),
+		 match_distance );
+
+		data_offset += 2;
+
+		if( match_size >= 15 )
+		{
+			for( remaining_size = match_size - 15;
+			     remaining_size >= 255;
+			     remaining_size -= 255 )
+			{
+				if( data_offset >= compressed_data_size )
+				{
+					return( 0 );
+				}
+				compressed_data[ data_offset++ ] = 255;
+			}
+			if( data_offset >= compressed_data_size )
+			{
+				return( 0 );
+			}
+			compressed_data[ data_offset++ ] = (uint8_t) remaining_size;
+		}
+	}
+	*compressed_data_offset = data_offset;
+
+	return( 1 );
+}
+
+/* Compresses data using LZ compression
+ * Returns 1 on success, 0 if the compressed data does not fit in the compressed data buffer or -1 on error
+ */
+int libgzipf_lz_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	uint32_t hash_table[ LIBGZIPF_LZ_HASH_TABLE_SIZE ];
+
+	static char *function           = "libgzipf_lz_compress";
+	size_t compressed_data_offset   = 0;
+	size_t literals_offset          = 0;
+	size_t match_offset             = 0;
+	size_t match_size               = 0;
+	size_t safe_compressed_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t hash_value             = 0;
+	int result                      = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_size = *compressed_data_size;
+
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * LIBGZIPF_LZ_HASH_TABLE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( uncompressed_data_offset + LIBGZIPF_LZ_MINIMUM_MATCH_SIZE ) <= uncompressed_data_size )
+	{
+		hash_value = libgzipf_lz_calculate_hash(
+		              &( uncompressed_data[ uncompressed_data_offset ] ) );
+
+		/* The hash table stores the offset + 1 so that 0 represents an unused entry
+		 */
+		match_offset = (size_t) hash_table[ hash_value ];
+
+		hash_table[ hash_value ] = (uint32_t) ( uncompressed_data_offset + 1 );
+
+		if( ( match_offset == 0 )
+		 || ( ( uncompressed_data_offset + 1 - match_offset ) > LIBGZIPF_LZ_MAXIMUM_MATCH_DISTANCE ) )
+		{
+			uncompressed_data_offset++;
+
+			continue;
+		}
+		match_offset -= 1;
+
+		if( memory_compare(
+		     &( uncompressed_data[ match_offset ] ),
+		     &( uncompressed_data[ uncompressed_data_offset ] ),
+		     LIBGZIPF_LZ_MINIMUM_MATCH_SIZE ) != 0 )
+		{
+			uncompressed_data_offset++;
+
+			continue;
+		}
+		match_size = LIBGZIPF_LZ_MINIMUM_MATCH_SIZE;
+
+		while( ( ( uncompressed_data_offset + match_size ) < uncompressed_data_size )
+		    && ( uncompressed_data[ match_offset + match_size ] == uncompressed_data[ uncompressed_data_offset + match_size ] ) )
+		{
+			match_size++;
+		}
+		result = libgzipf_lz_write_sequence(
+		          &( uncompressed_data[ literals_offset ] ),
+		          uncompressed_data_offset - literals_offset,
+		          (uint16_t) ( uncompressed_data_offset - match_offset ),
+		          match_size,
+		          compressed_data,
+		          safe_compressed_size,
+		          &compressed_data_offset,
+		          error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		uncompressed_data_offset += match_size;
+		literals_offset           = uncompressed_data_offset;
+	}
+	if( result != -1 )
+	{
+		result = libgzipf_lz_write_sequence(
+		          &( uncompressed_data[ literals_offset ] ),
+		          uncompressed_data_size - literals_offset,
+		          0,
+		          0,
+		          compressed_data,
+		          safe_compressed_size,
+		          &compressed_data_offset,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to write sequence.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*compressed_data_size = compressed_data_offset;
+	}
+	return( result );
+}
+
+/* Reads the additional bytes of a LZ sequence size
+ * Returns 1 on success or -1 on error
+ */
+int libgzipf_lz_read_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_lz_read_size";
+	size_t data_offset    = 0;
+	uint8_t byte_value    = 0;
+
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = *compressed_data_offset;
+
+	do
+	{
+		if( data_offset >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_value = compressed_data[ data_offset++ ];
+
+		*size += byte_value;
+	}
+	while( byte_value == 255 );
+
+	*compressed_data_offset = data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZ compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libgzipf_lz_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libgzipf_lz_decompress";
+	size_t compressed_data_offset   = 0;
+	size_t match_size               = 0;
+	size_t number_of_literals       = 0;
+	size_t safe_uncompressed_size   = 0;
+	size_t uncompressed_data_offset = 0;
+	uint16_t match_distance         = 0;
+	uint8_t token                   = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_size = *uncompressed_data_size;
+
+	while( compressed_data_offset < compressed_data_size )
+	{
+		token = compressed_data[ compressed_data_offset++ ];
+
+		number_of_literals = (size_t) ( token >> 4 );
+
+		if( number_of_literals == 15 )
+		{
+			if( libgzipf_lz_read_size(
+			     compressed_data,
+			     compressed_data_size,
+			     &compressed_data_offset,
+			     &number_of_literals,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to read number of literals.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( number_of_literals > ( compressed_data_size - compressed_data_offset ) )
+		 || ( number_of_literals > ( safe_uncompressed_size - uncompressed_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of literals value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_literals > 0 )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( compressed_data[ compressed_data_offset ] ),
+			     number_of_literals ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy literals.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_data_offset   += number_of_literals;
+			uncompressed_data_offset += number_of_literals;
+		}
+		/* The last sequence only contains literals
+		 */
+		if( compressed_data_offset >= compressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_size - compressed_data_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 match_distance );
+
+		compressed_data_offset += 2;
+
+		if( ( match_distance == 0 )
+		 || ( (size_t) match_distance > uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid match distance value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		match_size = (size_t) ( token & 0x0f );
+
+		if( match_size == 15 )
+		{
+			if( libgzipf_lz_read_size(
+			     compressed_data,
+			     compressed_data_size,
+			     &compressed_data_offset,
+			     &match_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to read match size.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		match_size += LIBGZIPF_LZ_MINIMUM_MATCH_SIZE;
+
+		if( match_size > ( safe_uncompressed_size - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid match size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The match can overlap with the data it produces
+		 */
+		while( match_size > 0 )
+		{
+			uncompressed_data[ uncompressed_data_offset ] = uncompressed_data[ uncompressed_data_offset - match_distance ];
+
+			uncompressed_data_offset++;
+			match_size--;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
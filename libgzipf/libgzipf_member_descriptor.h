@@ -84,6 +84,18 @@ struct libgzipf_member_descriptor
 	 */
 	uint32_t calculated_checksum;
 
+	/* The stored (uncompressed data) checksum
+	 */
+	uint32_t stored_checksum;
+
+	/* The index of the first segment descriptor of the member
+	 */
+	int first_segment_descriptor_index;
+
+	/* The number of segment descriptors of the member
+	 */
+	int number_of_segment_descriptors;
+
 	/* Value to indicate if there was a decompression error
 	 */
 	uint8_t decompression_error;
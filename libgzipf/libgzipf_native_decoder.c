@@ -0,0 +1,918 @@
+/*
+ * Native (built-in deflate) decoder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_decoder.h"
+#include "libgzipf_definitions.h"
+#include "libgzipf_deflate_stream.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_native_decoder.h"
+
+/* Creates a native decoder
+ * Make sure the value native_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_initialize(
+     libgzipf_native_decoder_t **native_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_initialize";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *native_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid native decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*native_decoder = memory_allocate_structure(
+	                   libgzipf_native_decoder_t );
+
+	if( *native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create native decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *native_decoder,
+	     0,
+	     sizeof( libgzipf_native_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear native decoder.",
+		 function );
+
+		memory_free(
+		 *native_decoder );
+
+		*native_decoder = NULL;
+
+		return( -1 );
+	}
+	if( libgzipf_deflate_stream_initialize(
+	     &( ( *native_decoder )->deflate_stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *native_decoder != NULL )
+	{
+		memory_free(
+		 *native_decoder );
+
+		*native_decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a native decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_free(
+     libgzipf_native_decoder_t **native_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_free";
+	int result            = 1;
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *native_decoder != NULL )
+	{
+		if( libgzipf_deflate_stream_free(
+		     &( ( *native_decoder )->deflate_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free deflate stream.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *native_decoder )->window != NULL )
+		{
+			memory_free(
+			 ( *native_decoder )->window );
+		}
+		memory_free(
+		 *native_decoder );
+
+		*native_decoder = NULL;
+	}
+	return( result );
+}
+
+/* Resets a native decoder to the start of a new stream
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_reset(
+     libgzipf_native_decoder_t *native_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_reset";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_deflate_stream_reset(
+	     native_decoder->deflate_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	native_decoder->uncompressed_data        = NULL;
+	native_decoder->uncompressed_data_offset = 0;
+	native_decoder->referenced_history_size  = 0;
+	native_decoder->dictionary_size          = 0;
+
+	return( 1 );
+}
+
+/* Sets the bits of a partially consumed byte to continue decoding from
+ * The bits are inserted into the bit buffer after the bits it already contains
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_prime_bits(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t number_of_bits,
+     uint8_t value,
+     libcerror_error_t **error )
+{
+	libgzipf_bit_stream_t *bit_stream = NULL;
+	static char *function             = "libgzipf_native_decoder_prime_bits";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 7 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( native_decoder->deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid native decoder - missing deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = &( native_decoder->deflate_stream->bit_stream );
+
+	if( ( bit_stream->bit_buffer_size + number_of_bits ) > 64 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bit stream - bit buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 0 )
+	{
+		bit_stream->bit_buffer      |= (uint64_t) ( value & ( ( 1 << number_of_bits ) - 1 ) ) << bit_stream->bit_buffer_size;
+		bit_stream->bit_buffer_size += number_of_bits;
+	}
+	return( 1 );
+}
+
+/* Sets the preceding uncompressed data used for distance codes
+ * The dictionary is used for distance codes that refer to before the start of the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_set_dictionary(
+     libgzipf_native_decoder_t *native_decoder,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_set_dictionary";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data_size > (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid dictionary data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( dictionary_data_size > 0 )
+	 && ( native_decoder->window == NULL ) )
+	{
+		native_decoder->window = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * 2 * LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE );
+
+		if( native_decoder->window == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create window.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( dictionary_data_size > 0 )
+	{
+		if( memory_copy(
+		     native_decoder->window,
+		     dictionary_data,
+		     dictionary_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy dictionary data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	native_decoder->dictionary_size = dictionary_data_size;
+
+	return( 1 );
+}
+
+/* Decodes compressed data
+ * The uncompressed data before the uncompressed data offset is used as history for distance codes
+ * While the uncompressed data does not contain a full history, the start of the uncompressed data
+ * is decoded in the window after the dictionary
+ * Whole bytes that were read ahead into the bit buffer are returned to the compressed data,
+ * so that the compressed data offset only covers the bytes that were consumed
+ * Returns 1 if the end of the stream, or the end of a block when requested, was reached,
+ * 0 if more compressed data or uncompressed data space is needed or -1 on error
+ */
+int libgzipf_native_decoder_decode(
+     libgzipf_native_decoder_t *native_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libgzipf_bit_stream_t *bit_stream = NULL;
+	static char *function             = "libgzipf_native_decoder_decode";
+	size_t data_offset                = 0;
+	size_t decompress_offset          = 0;
+	size_t referenced_history_size    = 0;
+	size_t window_data_offset         = 0;
+	size_t window_data_size           = 0;
+	uint8_t deflate_stream_flags      = 0;
+	int result                        = 0;
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( native_decoder->deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid native decoder - missing deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & LIBGZIPF_DECODER_FLAG_FINAL_INPUT ) != 0 )
+	{
+		deflate_stream_flags |= LIBGZIPF_DEFLATE_STREAM_FLAG_FINAL_INPUT;
+	}
+	if( ( flags & LIBGZIPF_DECODER_FLAG_STOP_AT_END_OF_BLOCK ) != 0 )
+	{
+		deflate_stream_flags |= LIBGZIPF_DEFLATE_STREAM_FLAG_STOP_AT_END_OF_BLOCK;
+	}
+	if( ( flags & LIBGZIPF_DECODER_FLAG_STOP_BEFORE_PARTIAL_MATCH ) != 0 )
+	{
+		deflate_stream_flags |= LIBGZIPF_DEFLATE_STREAM_FLAG_STOP_BEFORE_PARTIAL_MATCH;
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = *uncompressed_data_offset;
+
+	if( ( native_decoder->dictionary_size > 0 )
+	 && ( data_offset < (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ) )
+	{
+		/* Decode the start of the uncompressed data in the window, after the dictionary,
+		 * so that distance codes can refer to the dictionary
+		 */
+		window_data_size = uncompressed_data_size;
+
+		if( window_data_size > (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+		{
+			window_data_size = (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
+		}
+		if( data_offset > 0 )
+		{
+			if( memory_copy(
+			     &( ( native_decoder->window )[ native_decoder->dictionary_size ] ),
+			     uncompressed_data,
+			     data_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data to window.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		window_data_offset = native_decoder->dictionary_size + data_offset;
+		decompress_offset  = window_data_offset;
+
+		result = libgzipf_deflate_stream_decompress(
+		          native_decoder->deflate_stream,
+		          compressed_data,
+		          compressed_data_size,
+		          compressed_data_offset,
+		          native_decoder->window,
+		          native_decoder->dictionary_size + window_data_size,
+		          &window_data_offset,
+		          deflate_stream_flags,
+		          error );
+
+		/* Distance codes that refer to the dictionary refer to the history before the uncompressed data
+		 */
+		referenced_history_size = decompress_offset - native_decoder->deflate_stream->minimum_match_offset;
+
+		if( window_data_offset > ( native_decoder->dictionary_size + data_offset ) )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ data_offset ] ),
+			     &( ( native_decoder->window )[ native_decoder->dictionary_size + data_offset ] ),
+			     window_data_offset - ( native_decoder->dictionary_size + data_offset ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data from window.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset = window_data_offset - native_decoder->dictionary_size;
+		}
+	}
+	/* Once the uncompressed data contains a full history the window is no longer needed
+	 */
+	if( ( result == 0 )
+	 && ( ( native_decoder->dictionary_size == 0 )
+	  ||  ( data_offset >= (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ) ) )
+	{
+		result = libgzipf_deflate_stream_decompress(
+		          native_decoder->deflate_stream,
+		          compressed_data,
+		          compressed_data_size,
+		          compressed_data_offset,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &data_offset,
+		          deflate_stream_flags,
+		          error );
+
+		if( ( native_decoder->deflate_stream->minimum_match_offset + referenced_history_size ) < *uncompressed_data_offset )
+		{
+			referenced_history_size = *uncompressed_data_offset - native_decoder->deflate_stream->minimum_match_offset;
+		}
+	}
+	*uncompressed_data_offset = data_offset;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Return the bytes that were read ahead into the bit buffer
+	 */
+	bit_stream = &( native_decoder->deflate_stream->bit_stream );
+
+	while( bit_stream->bit_buffer_size >= 8 )
+	{
+		bit_stream->byte_stream_offset -= 1;
+		bit_stream->bit_buffer_size    -= 8;
+	}
+	bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+
+	*compressed_data_offset = bit_stream->byte_stream_offset;
+
+	native_decoder->uncompressed_data        = uncompressed_data;
+	native_decoder->uncompressed_data_offset = *uncompressed_data_offset;
+	native_decoder->referenced_history_size  = referenced_history_size;
+
+	return( result );
+}
+
+/* Retrieves the preceding uncompressed data used for distance codes
+ * This is the uncompressed data of the last decode before its uncompressed data offset,
+ * preceded by the dictionary if the uncompressed data does not contain a full history
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_get_dictionary(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_get_dictionary";
+	size_t copy_size      = 0;
+	size_t history_size   = 0;
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid dictionary data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	history_size = native_decoder->uncompressed_data_offset;
+
+	if( history_size > (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		history_size = (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
+	}
+	if( history_size > dictionary_data_size )
+	{
+		history_size = dictionary_data_size;
+	}
+	/* The part of the dictionary that precedes the uncompressed data
+	 */
+	if( history_size < (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		copy_size = (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE - history_size;
+
+		if( copy_size > native_decoder->dictionary_size )
+		{
+			copy_size = native_decoder->dictionary_size;
+		}
+		if( copy_size > ( dictionary_data_size - history_size ) )
+		{
+			copy_size = dictionary_data_size - history_size;
+		}
+	}
+	if( copy_size > 0 )
+	{
+		if( memory_copy(
+		     dictionary_data,
+		     &( ( native_decoder->window )[ native_decoder->dictionary_size - copy_size ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy dictionary data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( history_size > 0 )
+	{
+		if( memory_copy(
+		     &( dictionary_data[ copy_size ] ),
+		     &( ( native_decoder->uncompressed_data )[ native_decoder->uncompressed_data_offset - history_size ] ),
+		     history_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy dictionary data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*data_size = copy_size + history_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of unused bits of the last consumed byte
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_get_number_of_bits(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t *number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_get_number_of_bits";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( native_decoder->deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid native decoder - missing deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bits = native_decoder->deflate_stream->bit_stream.bit_buffer_size & 0x07;
+
+	return( 1 );
+}
+
+/* Determines if the end of the stream was reached
+ * Returns 1 if the end of the stream was reached, 0 if not or -1 on error
+ */
+int libgzipf_native_decoder_is_end_of_stream(
+     libgzipf_native_decoder_t *native_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_is_end_of_stream";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( native_decoder->deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid native decoder - missing deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( native_decoder->deflate_stream->state == LIBGZIPF_DEFLATE_STREAM_STATE_END_OF_STREAM )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the state of the current Huffman compressed block
+ * Returns 1 if successful, 0 if not in the middle of a Huffman compressed block or -1 on error
+ */
+int libgzipf_native_decoder_get_block_state(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t *block_state_data,
+     size_t block_state_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_get_block_state";
+	int result            = 0;
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	result = libgzipf_deflate_stream_get_block_state(
+	          native_decoder->deflate_stream,
+	          block_state_data,
+	          block_state_data_size,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve deflate stream block state.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the state of a Huffman compressed block to resume decoding from
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_set_block_state(
+     libgzipf_native_decoder_t *native_decoder,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_set_block_state";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( libgzipf_deflate_stream_set_block_state(
+	     native_decoder->deflate_stream,
+	     block_state_data,
+	     block_state_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set deflate stream block state.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the history referred to by distance codes during the last decode
+ * This is the number of bytes before the uncompressed data offset at the start
+ * of the last decode that were referred to, including the dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_native_decoder_get_referenced_history_size(
+     libgzipf_native_decoder_t *native_decoder,
+     size_t *history_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_native_decoder_get_referenced_history_size";
+
+	if( native_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid native decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( history_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid history size.",
+		 function );
+
+		return( -1 );
+	}
+	*history_size = native_decoder->referenced_history_size;
+
+	return( 1 );
+}
+
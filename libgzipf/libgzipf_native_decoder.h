@@ -0,0 +1,140 @@
+/*
+ * Native (built-in deflate) decoder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_NATIVE_DECODER_H )
+#define _LIBGZIPF_NATIVE_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_deflate_stream.h"
+#include "libgzipf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libgzipf_native_decoder libgzipf_native_decoder_t;
+
+struct libgzipf_native_decoder
+{
+	/* The deflate stream
+	 */
+	libgzipf_deflate_stream_t *deflate_stream;
+
+	/* The uncompressed data of the last decode
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The uncompressed data offset of the last decode
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The size of the history before the uncompressed data
+	 * referred to by distance codes during the last decode
+	 */
+	size_t referenced_history_size;
+
+	/* The window, which contains the dictionary followed by
+	 * the start of the uncompressed data
+	 */
+	uint8_t *window;
+
+	/* The dictionary size
+	 */
+	size_t dictionary_size;
+};
+
+int libgzipf_native_decoder_initialize(
+     libgzipf_native_decoder_t **native_decoder,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_free(
+     libgzipf_native_decoder_t **native_decoder,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_reset(
+     libgzipf_native_decoder_t *native_decoder,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_prime_bits(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t number_of_bits,
+     uint8_t value,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_set_dictionary(
+     libgzipf_native_decoder_t *native_decoder,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_decode(
+     libgzipf_native_decoder_t *native_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_get_dictionary(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_get_number_of_bits(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t *number_of_bits,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_is_end_of_stream(
+     libgzipf_native_decoder_t *native_decoder,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_get_block_state(
+     libgzipf_native_decoder_t *native_decoder,
+     uint8_t *block_state_data,
+     size_t block_state_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_set_block_state(
+     libgzipf_native_decoder_t *native_decoder,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_native_decoder_get_referenced_history_size(
+     libgzipf_native_decoder_t *native_decoder,
+     size_t *history_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_NATIVE_DECODER_H ) */
+
@@ -25,6 +25,7 @@
 
 #include "libgzipf_definitions.h"
 #include "libgzipf_libcerror.h"
+#include "libgzipf_lz.h"
 #include "libgzipf_segment_descriptor.h"
 
 /* Creates segment descriptor
@@ -123,25 +124,395 @@ int libgzipf_segment_descriptor_free(
 	}
 	if( *segment_descriptor != NULL )
 	{
-		if( memory_set(
-		     ( *segment_descriptor )->distance_data,
-		     0,
-		     LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ) == NULL )
+		if( ( *segment_descriptor )->distance_data != NULL )
+		{
+			if( memory_set(
+			     ( *segment_descriptor )->distance_data,
+			     0,
+			     ( *segment_descriptor )->stored_distance_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear distance data.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 ( *segment_descriptor )->distance_data );
+		}
+		if( ( *segment_descriptor )->block_state_data != NULL )
+		{
+			memory_free(
+			 ( *segment_descriptor )->block_state_data );
+		}
+		memory_free(
+		 *segment_descriptor );
+
+		*segment_descriptor = NULL;
+	}
+	return( result );
+}
+
+/* Sets the distance data
+ * The distance data is LZ compressed if this reduces its size
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_segment_descriptor_set_distance_data(
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *distance_data,
+     size_t distance_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation         = NULL;
+	uint8_t *stored_distance_data = NULL;
+	static char *function         = "libgzipf_segment_descriptor_set_distance_data";
+	size_t stored_data_size       = 0;
+	int result                    = 0;
+
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->distance_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment descriptor - distance data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( distance_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distance data.",
+		 function );
+
+		return( -1 );
+	}
+	if( distance_data_size > (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid distance data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( distance_data_size == 0 )
+	{
+		return( 1 );
+	}
+	stored_distance_data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * distance_data_size );
+
+	if( stored_distance_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create distance data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only keep the compressed distance data if it is smaller than the uncompressed distance data
+	 */
+	stored_data_size = distance_data_size - 1;
+
+	result = libgzipf_lz_compress(
+	          distance_data,
+	          distance_data_size,
+	          stored_distance_data,
+	          &stored_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress distance data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            stored_distance_data,
+		                            sizeof( uint8_t ) * stored_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize distance data.",
+			 function );
+
+			goto on_error;
+		}
+		stored_distance_data = reallocation;
+	}
+	else
+	{
+		if( memory_copy(
+		     stored_distance_data,
+		     distance_data,
+		     distance_data_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear distance data.",
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy distance data.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
+		stored_data_size = distance_data_size;
+	}
+	segment_descriptor->distance_data             = stored_distance_data;
+	segment_descriptor->distance_data_size        = distance_data_size;
+	segment_descriptor->stored_distance_data_size = stored_data_size;
+
+	return( 1 );
+
+on_error:
+	if( stored_distance_data != NULL )
+	{
 		memory_free(
-		 *segment_descriptor );
+		 stored_distance_data );
+	}
+	return( -1 );
+}
 
-		*segment_descriptor = NULL;
+/* Retrieves the distance data
+ * The distance data buffer must be large enough to contain the (uncompressed) distance data
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_segment_descriptor_get_distance_data(
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     uint8_t *distance_data,
+     size_t distance_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libgzipf_segment_descriptor_get_distance_data";
+	size_t uncompressed_data_size = 0;
+
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	if( distance_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distance data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( distance_data_size < segment_descriptor->distance_data_size )
+	 || ( distance_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid distance data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->distance_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( segment_descriptor->distance_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment descriptor - missing distance data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->stored_distance_data_size < segment_descriptor->distance_data_size )
+	{
+		uncompressed_data_size = segment_descriptor->distance_data_size;
+
+		if( libgzipf_lz_decompress(
+		     segment_descriptor->distance_data,
+		     segment_descriptor->stored_distance_data_size,
+		     distance_data,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress distance data.",
+			 function );
+
+			return( -1 );
+		}
+		if( uncompressed_data_size != segment_descriptor->distance_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: mismatch in distance data size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( memory_copy(
+		     distance_data,
+		     segment_descriptor->distance_data,
+		     segment_descriptor->distance_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy distance data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the block state data
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_segment_descriptor_set_block_state_data(
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_segment_descriptor_set_block_state_data";
+
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->block_state_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment descriptor - block state data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_state_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block state data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_state_data_size == 0 )
+	 || ( block_state_data_size > (size_t) LIBGZIPF_DEFLATE_MAXIMUM_BLOCK_STATE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block state data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_descriptor->block_state_data = (uint8_t *) memory_allocate(
+	                                                    sizeof( uint8_t ) * block_state_data_size );
+
+	if( segment_descriptor->block_state_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block state data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     segment_descriptor->block_state_data,
+	     block_state_data,
+	     block_state_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block state data.",
+		 function );
+
+		memory_free(
+		 segment_descriptor->block_state_data );
+
+		segment_descriptor->block_state_data = NULL;
+
+		return( -1 );
+	}
+	segment_descriptor->block_state_data_size = block_state_data_size;
+
+	return( 1 );
 }
 
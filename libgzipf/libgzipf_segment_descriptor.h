@@ -49,17 +49,51 @@ struct libgzipf_segment_descriptor
 	 */
 	size_t uncompressed_data_size;
 
+	/* The CRC-32 of the uncompressed data
+	 */
+	uint32_t checksum;
+
+	/* Value to indicate the CRC-32 of the uncompressed data was calculated
+	 */
+	uint8_t has_checksum;
+
 	/* The intial number of bits of the compressed block
 	 */
 	uint8_t number_of_bits;
 
 	/* The preceeding 32 KiB of uncompressed data for distance codes
+	 * The distance data is stored LZ compressed if this reduces its size
 	 */
-	uint8_t distance_data[ LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ];
+	uint8_t *distance_data;
 
 	/* The distance data size
 	 */
 	size_t distance_data_size;
+
+	/* The stored distance data size
+	 */
+	size_t stored_distance_data_size;
+
+	/* The state of the Huffman compressed block the segment starts in
+	 * or NULL if the segment starts at the start of a block
+	 */
+	uint8_t *block_state_data;
+
+	/* The block state data size
+	 */
+	size_t block_state_data_size;
+
+	/* The decoder used to read the segment
+	 */
+	int decoder_type;
+
+	/* Value to indicate the segment contains the data of a stored (uncompressed) block
+	 */
+	uint8_t is_stored;
+
+	/* The offset of the data of the stored block
+	 */
+	off64_t stored_data_offset;
 };
 
 int libgzipf_segment_descriptor_initialize(
@@ -70,6 +104,24 @@ int libgzipf_segment_descriptor_free(
      libgzipf_segment_descriptor_t **segment_descriptor,
      libcerror_error_t **error );
 
+int libgzipf_segment_descriptor_set_distance_data(
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *distance_data,
+     size_t distance_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_segment_descriptor_get_distance_data(
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     uint8_t *distance_data,
+     size_t distance_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_segment_descriptor_set_block_state_data(
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     const uint8_t *block_state_data,
+     size_t block_state_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,732 @@
+/*
+ * Sequential reader functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libgzipf_decoder.h"
+#include "libgzipf_definitions.h"
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_libcnotify.h"
+#include "libgzipf_segment_descriptor.h"
+#include "libgzipf_sequential_reader.h"
+
+/* Creates a sequential reader
+ * Make sure the value sequential_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_sequential_reader_initialize(
+     libgzipf_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_sequential_reader_initialize";
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sequential_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sequential reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sequential_reader = memory_allocate_structure(
+	                      libgzipf_sequential_reader_t );
+
+	if( *sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sequential reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sequential_reader,
+	     0,
+	     sizeof( libgzipf_sequential_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sequential reader.",
+		 function );
+
+		memory_free(
+		 *sequential_reader );
+
+		*sequential_reader = NULL;
+
+		return( -1 );
+	}
+	( *sequential_reader )->compressed_data = (uint8_t *) memory_allocate(
+	                                                       sizeof( uint8_t ) * LIBGZIPF_MAXIMUM_DEFLATE_BLOCK_SIZE );
+
+	if( ( *sequential_reader )->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *sequential_reader != NULL )
+	{
+		memory_free(
+		 *sequential_reader );
+
+		*sequential_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sequential reader
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_sequential_reader_free(
+     libgzipf_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_sequential_reader_free";
+	int result            = 1;
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sequential_reader != NULL )
+	{
+		if( ( *sequential_reader )->decoder != NULL )
+		{
+			if( libgzipf_decoder_free(
+			     &( ( *sequential_reader )->decoder ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoder.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *sequential_reader )->uncompressed_data != NULL )
+		{
+			memory_free(
+			 ( *sequential_reader )->uncompressed_data );
+		}
+		memory_free(
+		 ( *sequential_reader )->compressed_data );
+
+		memory_free(
+		 *sequential_reader );
+
+		*sequential_reader = NULL;
+	}
+	return( result );
+}
+
+/* Starts the sequential reader at the beginning of a DEFLATE compressed segment
+ * The offset is the uncompressed offset of the start of the segment
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_sequential_reader_start(
+     libgzipf_sequential_reader_t *sequential_reader,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	uint8_t distance_data[ LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ];
+
+	static char *function = "libgzipf_sequential_reader_start";
+	uint8_t bit_shift     = 0;
+	int result            = 0;
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_descriptor->is_stored != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid segment descriptor - unsupported stored segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	sequential_reader->is_active = 0;
+
+	if( ( sequential_reader->decoder != NULL )
+	 && ( sequential_reader->decoder->decoder_type != segment_descriptor->decoder_type ) )
+	{
+		if( libgzipf_decoder_free(
+		     &( sequential_reader->decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoder.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( sequential_reader->decoder == NULL )
+	{
+		if( libgzipf_decoder_initialize(
+		     &( sequential_reader->decoder ),
+		     segment_descriptor->decoder_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decoder.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libgzipf_decoder_reset(
+	          sequential_reader->decoder,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
+		 function );
+
+		return( -1 );
+	}
+	/* A decoder that uses the preceding uncompressed data as history
+	 * decodes into the uncompressed data of the reader
+	 */
+	if( ( sequential_reader->decoder->uses_history != 0 )
+	 && ( sequential_reader->uncompressed_data == NULL ) )
+	{
+		sequential_reader->uncompressed_data = (uint8_t *) memory_allocate(
+		                                                    sizeof( uint8_t ) * ( LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE + LIBGZIPF_SEQUENTIAL_READ_DATA_SIZE ) );
+
+		if( sequential_reader->uncompressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	sequential_reader->compressed_data_size          = 0;
+	sequential_reader->compressed_data_offset        = 0;
+	sequential_reader->compressed_data_file_offset   = segment_descriptor->compressed_data_offset;
+	sequential_reader->uncompressed_data_size        = 0;
+	sequential_reader->uncompressed_data_read_offset = 0;
+	sequential_reader->end_of_input                  = 0;
+	sequential_reader->end_of_stream                 = 0;
+
+	/* A segment that starts in the middle of a byte includes that byte
+	 */
+	if( segment_descriptor->number_of_bits > 0 )
+	{
+		if( libgzipf_sequential_reader_read_compressed_data(
+		     sequential_reader,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		if( sequential_reader->compressed_data_size < 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		bit_shift = 8 - segment_descriptor->number_of_bits;
+
+		result = libgzipf_decoder_prime_bits(
+		          sequential_reader->decoder,
+		          segment_descriptor->number_of_bits,
+		          sequential_reader->compressed_data[ 0 ] >> bit_shift,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set compressed stream bits in decoder.",
+			 function );
+
+			return( -1 );
+		}
+		sequential_reader->compressed_data_offset = 1;
+	}
+	if( segment_descriptor->distance_data_size > 0 )
+	{
+		if( libgzipf_segment_descriptor_get_distance_data(
+		     segment_descriptor,
+		     distance_data,
+		     LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve distance data from segment descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		if( sequential_reader->decoder->uses_history != 0 )
+		{
+			if( memory_copy(
+			     sequential_reader->uncompressed_data,
+			     distance_data,
+			     segment_descriptor->distance_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy distance data to uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			sequential_reader->uncompressed_data_size        = segment_descriptor->distance_data_size;
+			sequential_reader->uncompressed_data_read_offset = segment_descriptor->distance_data_size;
+		}
+		else
+		{
+			result = libgzipf_decoder_set_dictionary(
+			          sequential_reader->decoder,
+			          distance_data,
+			          segment_descriptor->distance_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set dictionary of decoder.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( segment_descriptor->block_state_data_size > 0 )
+	{
+		result = libgzipf_decoder_set_block_state(
+		          sequential_reader->decoder,
+		          segment_descriptor->block_state_data,
+		          segment_descriptor->block_state_data_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block state of decoder.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	sequential_reader->current_offset = offset;
+	sequential_reader->is_active      = 1;
+
+	return( 1 );
+}
+
+/* Reads compressed data after the compressed data that has not been consumed
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_sequential_reader_read_compressed_data(
+     libgzipf_sequential_reader_t *sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libgzipf_sequential_reader_read_compressed_data";
+	off64_t compressed_data_end_offset    = 0;
+	size_t data_index                     = 0;
+	size_t read_size                      = 0;
+	size_t remaining_compressed_data_size = 0;
+	ssize_t read_count                    = 0;
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_compressed_data_size = sequential_reader->compressed_data_size - sequential_reader->compressed_data_offset;
+
+	/* Slide the remaining compressed data to the start of the buffer and fill the rest
+	 */
+	for( data_index = 0;
+	     data_index < remaining_compressed_data_size;
+	     data_index++ )
+	{
+		sequential_reader->compressed_data[ data_index ] = sequential_reader->compressed_data[ sequential_reader->compressed_data_offset + data_index ];
+	}
+	sequential_reader->compressed_data_file_offset += (off64_t) sequential_reader->compressed_data_offset;
+	sequential_reader->compressed_data_size         = remaining_compressed_data_size;
+	sequential_reader->compressed_data_offset       = 0;
+
+	compressed_data_end_offset = sequential_reader->compressed_data_file_offset + (off64_t) remaining_compressed_data_size;
+	read_size                  = LIBGZIPF_MAXIMUM_DEFLATE_BLOCK_SIZE - remaining_compressed_data_size;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              &( sequential_reader->compressed_data[ remaining_compressed_data_size ] ),
+	              read_size,
+	              compressed_data_end_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 compressed_data_end_offset,
+		 compressed_data_end_offset );
+
+		return( -1 );
+	}
+	sequential_reader->compressed_data_size += (size_t) read_count;
+
+	if( (size_t) read_count < read_size )
+	{
+		sequential_reader->end_of_input = 1;
+	}
+	return( 1 );
+}
+
+/* Reads uncompressed data by continuing the DEFLATE compressed stream
+ * A decoder that keeps its own history decodes directly into the buffer
+ * Returns the number of bytes read, 0 at the end of the stream or -1 on error
+ */
+ssize_t libgzipf_sequential_reader_read_buffer(
+         libgzipf_sequential_reader_t *sequential_reader,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	uint8_t *uncompressed_data       = NULL;
+	static char *function            = "libgzipf_sequential_reader_read_buffer";
+	size_t buffer_offset             = 0;
+	size_t read_size                 = 0;
+	size_t uncompressed_data_size    = 0;
+	size_t *uncompressed_data_offset = NULL;
+	uint8_t flags                    = 0;
+	uint8_t need_input               = 0;
+	int result                       = 0;
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( sequential_reader->is_active == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sequential reader - not started.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( sequential_reader->decoder->uses_history != 0 )
+		{
+			if( sequential_reader->uncompressed_data_read_offset < sequential_reader->uncompressed_data_size )
+			{
+				read_size = sequential_reader->uncompressed_data_size - sequential_reader->uncompressed_data_read_offset;
+
+				if( read_size > ( buffer_size - buffer_offset ) )
+				{
+					read_size = buffer_size - buffer_offset;
+				}
+				if( memory_copy(
+				     &( buffer[ buffer_offset ] ),
+				     &( ( sequential_reader->uncompressed_data )[ sequential_reader->uncompressed_data_read_offset ] ),
+				     read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy uncompressed data to buffer.",
+					 function );
+
+					return( -1 );
+				}
+				sequential_reader->uncompressed_data_read_offset += read_size;
+				buffer_offset                                    += read_size;
+
+				continue;
+			}
+			if( sequential_reader->end_of_stream != 0 )
+			{
+				break;
+			}
+			/* The buffer is full, move the history to the start of the buffer
+			 */
+			if( sequential_reader->uncompressed_data_size >= (size_t) ( LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE + LIBGZIPF_SEQUENTIAL_READ_DATA_SIZE ) )
+			{
+				if( memory_copy(
+				     sequential_reader->uncompressed_data,
+				     &( ( sequential_reader->uncompressed_data )[ sequential_reader->uncompressed_data_size - LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ] ),
+				     LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy uncompressed data to beginning of buffer.",
+					 function );
+
+					return( -1 );
+				}
+				sequential_reader->uncompressed_data_size        = LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
+				sequential_reader->uncompressed_data_read_offset = LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE;
+			}
+			uncompressed_data        = sequential_reader->uncompressed_data;
+			uncompressed_data_size   = LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE + LIBGZIPF_SEQUENTIAL_READ_DATA_SIZE;
+			uncompressed_data_offset = &( sequential_reader->uncompressed_data_size );
+		}
+		else
+		{
+			if( sequential_reader->end_of_stream != 0 )
+			{
+				break;
+			}
+			uncompressed_data        = buffer;
+			uncompressed_data_size   = buffer_size;
+			uncompressed_data_offset = &buffer_offset;
+		}
+		if( ( sequential_reader->end_of_input == 0 )
+		 && ( ( need_input != 0 )
+		  ||  ( ( sequential_reader->compressed_data_size - sequential_reader->compressed_data_offset ) < LIBGZIPF_DEFLATE_MAXIMUM_DYNAMIC_HEADER_SIZE ) ) )
+		{
+			if( libgzipf_sequential_reader_read_compressed_data(
+			     sequential_reader,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data.",
+				 function );
+
+				return( -1 );
+			}
+			need_input = 0;
+		}
+		else if( need_input != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: invalid compressed data - truncated stream.",
+			 function );
+
+			return( -1 );
+		}
+		flags = 0;
+
+		if( sequential_reader->end_of_input != 0 )
+		{
+			flags |= LIBGZIPF_DECODER_FLAG_FINAL_INPUT;
+		}
+		result = libgzipf_decoder_decode(
+		          sequential_reader->decoder,
+		          sequential_reader->compressed_data,
+		          sequential_reader->compressed_data_size,
+		          &( sequential_reader->compressed_data_offset ),
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          uncompressed_data_offset,
+		          flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			sequential_reader->end_of_stream = 1;
+		}
+		else if( *uncompressed_data_offset < uncompressed_data_size )
+		{
+			need_input = 1;
+		}
+	}
+	sequential_reader->current_offset += (off64_t) buffer_offset;
+
+	return( (ssize_t) buffer_offset );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Sequential reader functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_SEQUENTIAL_READER_H )
+#define _LIBGZIPF_SEQUENTIAL_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libgzipf_decoder.h"
+#include "libgzipf_libbfio.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_segment_descriptor.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libgzipf_sequential_reader libgzipf_sequential_reader_t;
+
+struct libgzipf_sequential_reader
+{
+	/* The decoder
+	 */
+	libgzipf_decoder_t *decoder;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The compressed data offset
+	 */
+	size_t compressed_data_offset;
+
+	/* The file offset of the compressed data
+	 */
+	off64_t compressed_data_file_offset;
+
+	/* The uncompressed data, which is only used by a decoder
+	 * that uses the preceding uncompressed data as history
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The offset of the uncompressed data that has not been read
+	 */
+	size_t uncompressed_data_read_offset;
+
+	/* The uncompressed offset of the data that is read next
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the reader was started
+	 */
+	uint8_t is_active;
+
+	/* Value to indicate the end of the compressed data was read
+	 */
+	uint8_t end_of_input;
+
+	/* Value to indicate the end of the DEFLATE compressed stream was reached
+	 */
+	uint8_t end_of_stream;
+};
+
+int libgzipf_sequential_reader_initialize(
+     libgzipf_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error );
+
+int libgzipf_sequential_reader_free(
+     libgzipf_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error );
+
+int libgzipf_sequential_reader_start(
+     libgzipf_sequential_reader_t *sequential_reader,
+     libgzipf_segment_descriptor_t *segment_descriptor,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libgzipf_sequential_reader_read_compressed_data(
+     libgzipf_sequential_reader_t *sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libgzipf_sequential_reader_read_buffer(
+         libgzipf_sequential_reader_t *sequential_reader,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_SEQUENTIAL_READER_H ) */
+
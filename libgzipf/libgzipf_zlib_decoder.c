@@ -0,0 +1,697 @@
+/*
+ * zlib decoder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#include "libgzipf_decoder.h"
+#include "libgzipf_definitions.h"
+#include "libgzipf_libcerror.h"
+#include "libgzipf_zlib_decoder.h"
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+
+/* Creates a zlib decoder
+ * Make sure the value zlib_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_zlib_decoder_initialize(
+     libgzipf_zlib_decoder_t **zlib_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_initialize";
+	int result            = 0;
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *zlib_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid zlib decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*zlib_decoder = memory_allocate_structure(
+	                 libgzipf_zlib_decoder_t );
+
+	if( *zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create zlib decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *zlib_decoder,
+	     0,
+	     sizeof( libgzipf_zlib_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear zlib decoder.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_ZLIB_INFLATE_INIT2 ) || defined( ZLIB_DLL )
+	result = inflateInit2(
+	          &( ( *zlib_decoder )->zlib_stream ),
+	          -15 );
+#else
+	result = _inflateInit2(
+	          &( ( *zlib_decoder )->zlib_stream ),
+	          -15 );
+#endif
+	if( result != Z_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize zlib stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *zlib_decoder != NULL )
+	{
+		memory_free(
+		 *zlib_decoder );
+
+		*zlib_decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a zlib decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_zlib_decoder_free(
+     libgzipf_zlib_decoder_t **zlib_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_free";
+	int result            = 1;
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *zlib_decoder != NULL )
+	{
+		if( inflateEnd(
+		     &( ( *zlib_decoder )->zlib_stream ) ) != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize zlib stream.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *zlib_decoder );
+
+		*zlib_decoder = NULL;
+	}
+	return( result );
+}
+
+/* Resets a zlib decoder to the start of a new stream
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_zlib_decoder_reset(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_reset";
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( inflateReset(
+	     &( zlib_decoder->zlib_stream ) ) != Z_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset zlib stream.",
+		 function );
+
+		return( -1 );
+	}
+	zlib_decoder->is_end_of_stream = 0;
+
+	return( 1 );
+}
+
+/* Sets the bits of a partially consumed byte to continue decoding from
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libgzipf_zlib_decoder_prime_bits(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     uint8_t number_of_bits,
+     uint8_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_prime_bits";
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 7 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 0 )
+	{
+		if( inflatePrime(
+		     &( zlib_decoder->zlib_stream ),
+		     (int) number_of_bits,
+		     (int) value ) != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set compressed stream bits in zlib stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the preceding uncompressed data used for distance codes
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libgzipf_zlib_decoder_set_dictionary(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_set_dictionary";
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data_size > (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid dictionary data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inflateSetDictionary(
+	     &( zlib_decoder->zlib_stream ),
+	     (Bytef *) dictionary_data,
+	     (uInt) dictionary_data_size ) != Z_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set dictionary of zlib stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes compressed data
+ * Returns 1 if the end of the stream, or the end of a block when requested, was reached,
+ * 0 if more compressed data or uncompressed data space is needed or -1 on error
+ */
+int libgzipf_zlib_decoder_decode(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_decode";
+	size_t input_size     = 0;
+	size_t output_size    = 0;
+	int flush             = Z_NO_FLUSH;
+	int result            = 0;
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( zlib_decoder->is_end_of_stream != 0 )
+	{
+		return( 1 );
+	}
+	if( ( flags & LIBGZIPF_DECODER_FLAG_STOP_AT_END_OF_BLOCK ) != 0 )
+	{
+		flush = Z_BLOCK;
+	}
+	do
+	{
+		input_size  = compressed_data_size - *compressed_data_offset;
+		output_size = uncompressed_data_size - *uncompressed_data_offset;
+
+		if( input_size > (size_t) UINT_MAX )
+		{
+			input_size = (size_t) UINT_MAX;
+		}
+		if( output_size > (size_t) UINT_MAX )
+		{
+			output_size = (size_t) UINT_MAX;
+		}
+		zlib_decoder->zlib_stream.next_in   = (Bytef *) &( compressed_data[ *compressed_data_offset ] );
+		zlib_decoder->zlib_stream.avail_in  = (uInt) input_size;
+		zlib_decoder->zlib_stream.next_out  = (Bytef *) &( uncompressed_data[ *uncompressed_data_offset ] );
+		zlib_decoder->zlib_stream.avail_out = (uInt) output_size;
+
+		result = inflate(
+		          &( zlib_decoder->zlib_stream ),
+		          flush );
+
+		*compressed_data_offset   += input_size - (size_t) zlib_decoder->zlib_stream.avail_in;
+		*uncompressed_data_offset += output_size - (size_t) zlib_decoder->zlib_stream.avail_out;
+
+		if( result == Z_STREAM_END )
+		{
+			zlib_decoder->is_end_of_stream = 1;
+
+			return( 1 );
+		}
+		else if( result == Z_OK )
+		{
+			/* Bit 7 of the data type is set when inflate stopped at the end of a block
+			 * and bit 6 when that block was the last block of the stream
+			 */
+			if( ( flush == Z_BLOCK )
+			 && ( ( zlib_decoder->zlib_stream.data_type & 0x80 ) != 0 ) )
+			{
+				if( ( zlib_decoder->zlib_stream.data_type & 0x40 ) != 0 )
+				{
+					zlib_decoder->is_end_of_stream = 1;
+				}
+				return( 1 );
+			}
+		}
+		else if( result == Z_BUF_ERROR )
+		{
+			/* No progress was possible
+			 */
+			break;
+		}
+		else if( result == Z_DATA_ERROR )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data: data error.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == Z_MEM_ERROR )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to decompress data: insufficient memory.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: zlib returned undefined error: %d.",
+			 function,
+			 result );
+
+			return( -1 );
+		}
+	}
+	while( ( *compressed_data_offset < compressed_data_size )
+	    && ( *uncompressed_data_offset < uncompressed_data_size ) );
+
+	if( ( ( flags & LIBGZIPF_DECODER_FLAG_FINAL_INPUT ) != 0 )
+	 && ( *uncompressed_data_offset < uncompressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the preceding uncompressed data used for distance codes
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_zlib_decoder_get_dictionary(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libgzipf_zlib_decoder_get_dictionary";
+	uInt safe_dictionary_size = 0;
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary data.",
+		 function );
+
+		return( -1 );
+	}
+	/* zlib can return up to 32 KiB of dictionary data
+	 */
+	if( dictionary_data_size < (size_t) LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid dictionary data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( inflateGetDictionary(
+	     &( zlib_decoder->zlib_stream ),
+	     (Bytef *) dictionary_data,
+	     &safe_dictionary_size ) != Z_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve dictionary from zlib stream.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) safe_dictionary_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of unused bits of the last consumed byte
+ * Returns 1 if successful or -1 on error
+ */
+int libgzipf_zlib_decoder_get_number_of_bits(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     uint8_t *number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_get_number_of_bits";
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bits = (uint8_t) ( zlib_decoder->zlib_stream.data_type & 0x07 );
+
+	return( 1 );
+}
+
+/* Determines if the end of the stream was reached
+ * Returns 1 if the end of the stream was reached, 0 if not or -1 on error
+ */
+int libgzipf_zlib_decoder_is_end_of_stream(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libgzipf_zlib_decoder_is_end_of_stream";
+
+	if( zlib_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zlib decoder.",
+		 function );
+
+		return( -1 );
+	}
+	return( (int) zlib_decoder->is_end_of_stream );
+}
+
+#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
+
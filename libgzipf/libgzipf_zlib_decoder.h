@@ -0,0 +1,111 @@
+/*
+ * zlib decoder functions
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBGZIPF_ZLIB_DECODER_H )
+#define _LIBGZIPF_ZLIB_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#include "libgzipf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+
+typedef struct libgzipf_zlib_decoder libgzipf_zlib_decoder_t;
+
+struct libgzipf_zlib_decoder
+{
+	/* The zlib stream
+	 */
+	z_stream zlib_stream;
+
+	/* Value to indicate the end of the stream was reached
+	 */
+	uint8_t is_end_of_stream;
+};
+
+int libgzipf_zlib_decoder_initialize(
+     libgzipf_zlib_decoder_t **zlib_decoder,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_free(
+     libgzipf_zlib_decoder_t **zlib_decoder,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_reset(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_prime_bits(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     uint8_t number_of_bits,
+     uint8_t value,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_set_dictionary(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_decode(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_get_dictionary(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_get_number_of_bits(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     uint8_t *number_of_bits,
+     libcerror_error_t **error );
+
+int libgzipf_zlib_decoder_is_end_of_stream(
+     libgzipf_zlib_decoder_t *zlib_decoder,
+     libcerror_error_t **error );
+
+#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBGZIPF_ZLIB_DECODER_H ) */
+
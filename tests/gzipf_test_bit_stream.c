@@ -435,10 +435,10 @@ int gzipf_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 0 );
 
-	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	GZIPF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -470,10 +470,10 @@ int gzipf_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 1 );
 
-	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000007UL );
+	 (uint64_t) 0x0000000000000007ULL );
 
 	GZIPF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -505,10 +505,10 @@ int gzipf_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	GZIPF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -540,10 +540,10 @@ int gzipf_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 6 );
 
-	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	GZIPF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -656,6 +656,173 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libgzipf_bit_stream_refill, libgzipf_bit_stream_peek and libgzipf_bit_stream_consume functions
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_bit_stream_refill(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libgzipf_bit_stream_t *bit_stream = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libgzipf_bit_stream_initialize(
+	          &bit_stream,
+	          gzipf_test_bit_stream_data,
+	          16,
+	          0,
+	          LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	libgzipf_bit_stream_refill(
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00db8f6d59bdda78ULL );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 56 );
+
+	value_32bit = libgzipf_bit_stream_peek(
+	               bit_stream,
+	               4 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000008UL );
+
+	libgzipf_bit_stream_consume(
+	 bit_stream,
+	 4 );
+
+	value_32bit = libgzipf_bit_stream_peek(
+	               bit_stream,
+	               12 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000da7UL );
+
+	libgzipf_bit_stream_consume(
+	 bit_stream,
+	 12 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 40 );
+
+	libgzipf_bit_stream_refill(
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 9 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 56 );
+
+	value_32bit = libgzipf_bit_stream_peek(
+	               bit_stream,
+	               32 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x8f6d59bdUL );
+
+	/* Test refill near the end of the byte stream
+	 */
+	bit_stream->byte_stream_offset = 12;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	libgzipf_bit_stream_refill(
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 16 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 32 );
+
+	value_32bit = libgzipf_bit_stream_peek(
+	               bit_stream,
+	               32 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xb97ec415UL );
+
+	/* Clean up
+	 */
+	result = libgzipf_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libgzipf_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
 
 /* The main program
@@ -695,6 +862,10 @@ int main(
 	 "libgzipf_bit_stream_get_value",
 	 gzipf_test_bit_stream_get_value );
 
+	GZIPF_TEST_RUN(
+	 "libgzipf_bit_stream_refill",
+	 gzipf_test_bit_stream_refill );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
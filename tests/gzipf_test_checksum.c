@@ -36,18 +36,243 @@
 
 #if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
 
-/* Tests the libgzipf_checksum_initialize_crc32_table function
+/* Tests the libgzipf_checksum_determine_crc32_kernel function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_checksum_initialize_crc32_table(
+int gzipf_test_checksum_determine_crc32_kernel(
      void )
 {
-	/* Test invocation of function only
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t value_32bit       = 0x12345678UL;
+	int crc32_kernel           = 0;
+	int result                 = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		value_32bit = ( value_32bit * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( value_32bit >> 16 );
+	}
+	crc32_kernel = libgzipf_checksum_determine_crc32_kernel();
+
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "crc32_kernel",
+	 crc32_kernel,
+	 LIBGZIPF_CHECKSUM_CRC32_KERNEL_UNDETERMINED );
+
+	/* Test if the kernel returns the same checksum as the lookup tables
+	 * for various alignments and sizes
 	 */
-	libgzipf_checksum_initialize_crc32_table(
-	 0xedb88320UL );
+	libgzipf_checksum_crc32_kernel = crc32_kernel;
+
+	for( data_offset = 0;
+	     data_offset < 16;
+	     data_offset++ )
+	{
+		for( data_size = 0;
+		     data_size <= ( 1024 - data_offset );
+		     data_size += 7 )
+		{
+			expected_checksum = libgzipf_checksum_update_crc32_table(
+			                     0xffffffffUL,
+			                     &( data[ data_offset ] ),
+			                     data_size );
+
+			result = libgzipf_checksum_calculate_weak_crc32(
+			          &checksum,
+			          &( data[ data_offset ] ),
+			          data_size,
+			          0xffffffffUL,
+			          &error );
+
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			GZIPF_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum",
+			 checksum,
+			 expected_checksum );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	libgzipf_checksum_crc32_kernel = LIBGZIPF_CHECKSUM_CRC32_KERNEL_UNDETERMINED;
 
 	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libgzipf_checksum_crc32_kernel = LIBGZIPF_CHECKSUM_CRC32_KERNEL_UNDETERMINED;
+
+	return( 0 );
+}
+
+/* Tests the libgzipf_checksum_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_checksum_calculate_crc32(
+     void )
+{
+	uint8_t data[ 16 ] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libgzipf_checksum_calculate_crc32(
+	          &checksum,
+	          data,
+	          16,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xcecee288UL );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a buffer that is not a multiple of 8 bytes
+	 */
+	result = libgzipf_checksum_calculate_crc32(
+	          &checksum,
+	          &( data[ 3 ] ),
+	          13,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x7594f01aUL );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an initial value
+	 */
+	result = libgzipf_checksum_calculate_crc32(
+	          &checksum,
+	          &( data[ 1 ] ),
+	          15,
+	          0x12345678UL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xc459c8e0UL );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_checksum_calculate_crc32(
+	          NULL,
+	          data,
+	          16,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_checksum_calculate_crc32(
+	          &checksum,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_checksum_calculate_crc32(
+	          &checksum,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
 }
 
 /* Tests the libgzipf_checksum_calculate_weak_crc32 function
@@ -63,8 +288,6 @@ int gzipf_test_checksum_calculate_weak_crc32(
 	uint32_t checksum        = 0;
 	int result               = 0;
 
-	libgzipf_checksum_crc32_table_computed = 0;
-
 	/* Test regular cases
 	 */
 	result = libgzipf_checksum_calculate_weak_crc32(
@@ -158,6 +381,128 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libgzipf_checksum_combine_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_checksum_combine_crc32(
+     void )
+{
+	uint8_t data[ 16 ] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	uint32_t first_checksum  = 0;
+	uint32_t second_checksum = 0;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( data_size = 0;
+	     data_size <= 16;
+	     data_size++ )
+	{
+		result = libgzipf_checksum_calculate_crc32(
+		          &first_checksum,
+		          data,
+		          data_size,
+		          0,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libgzipf_checksum_calculate_crc32(
+		          &second_checksum,
+		          &( data[ data_size ] ),
+		          16 - data_size,
+		          0,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libgzipf_checksum_combine_crc32(
+		          &checksum,
+		          first_checksum,
+		          second_checksum,
+		          (size64_t) ( 16 - data_size ),
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum",
+		 checksum,
+		 (uint32_t) 0xcecee288UL );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a second size that exceeds 32-bit
+	 */
+	result = libgzipf_checksum_combine_crc32(
+	          &checksum,
+	          0x12345678UL,
+	          0x9abcdef0UL,
+	          (size64_t) 0x123456789aULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x1f20287dUL );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_checksum_combine_crc32(
+	          NULL,
+	          first_checksum,
+	          second_checksum,
+	          16,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
 
 /* The main program
@@ -178,13 +523,21 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
 
 	GZIPF_TEST_RUN(
-	 "libgzipf_checksum_initialize_crc32_table",
-	 gzipf_test_checksum_initialize_crc32_table );
+	 "libgzipf_checksum_determine_crc32_kernel",
+	 gzipf_test_checksum_determine_crc32_kernel );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_checksum_calculate_crc32",
+	 gzipf_test_checksum_calculate_crc32 );
 
 	GZIPF_TEST_RUN(
 	 "libgzipf_checksum_calculate_weak_crc32",
 	 gzipf_test_checksum_calculate_weak_crc32 );
 
+	GZIPF_TEST_RUN(
+	 "libgzipf_checksum_combine_crc32",
+	 gzipf_test_checksum_combine_crc32 );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -36,9 +37,294 @@
 #include "gzipf_test_unused.h"
 
 #include "../libgzipf/libgzipf_compressed_segment.h"
+#include "../libgzipf/libgzipf_segment_descriptor.h"
+
+uint8_t gzipf_test_compressed_segment_fixed_huffman_compressed_data[ 52 ] = {
+	0x0b, 0xc9, 0x48, 0x55, 0x48, 0xcb, 0xac, 0x48, 0x4d, 0x51, 0xf0, 0x28, 0x4d, 0x4b, 0xcb, 0x4d,
+	0xcc, 0x53, 0x48, 0xca, 0xc9, 0x4f, 0xce, 0xb6, 0x52, 0x48, 0x44, 0x03, 0x0a, 0x89, 0x49, 0xc9,
+	0x68, 0x48, 0x21, 0x04, 0x97, 0x66, 0x03, 0x43, 0x23, 0x63, 0x13, 0x53, 0x33, 0x73, 0x0b, 0x4b,
+	0x24, 0x26, 0x17, 0x00 };
+
+uint8_t gzipf_test_compressed_segment_fixed_huffman_uncompressed_data[ 108 ] = {
+	0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x48, 0x75, 0x66, 0x66, 0x6d, 0x61,
+	0x6e, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x20, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+	0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x20, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+	0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x48, 0x75, 0x66, 0x66, 0x6d, 0x61, 0x6e, 0x20, 0x62,
+	0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+	0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x0a };
 
 #if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
 
+/* Tests the libgzipf_compressed_segment_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_compressed_segment_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libgzipf_compressed_segment_t *compressed_segment = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_GZIPF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 3;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libgzipf_compressed_segment_initialize(
+	          &compressed_segment,
+	          1024,
+	          4096,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_segment",
+	 compressed_segment );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_compressed_segment_free(
+	          &compressed_segment,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "compressed_segment",
+	 compressed_segment );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test initialize without compressed data
+	 */
+	result = libgzipf_compressed_segment_initialize(
+	          &compressed_segment,
+	          0,
+	          4096,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_segment",
+	 compressed_segment );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "compressed_segment->compressed_data",
+	 compressed_segment->compressed_data );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_segment->uncompressed_data",
+	 compressed_segment->uncompressed_data );
+
+	result = libgzipf_compressed_segment_free(
+	          &compressed_segment,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_compressed_segment_initialize(
+	          NULL,
+	          1024,
+	          4096,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_segment = (libgzipf_compressed_segment_t *) 0x12345678UL;
+
+	result = libgzipf_compressed_segment_initialize(
+	          &compressed_segment,
+	          1024,
+	          4096,
+	          &error );
+
+	compressed_segment = NULL;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_compressed_segment_initialize(
+	          &compressed_segment,
+	          1024,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "compressed_segment",
+	 compressed_segment );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GZIPF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libgzipf_compressed_segment_initialize with malloc failing
+		 */
+		gzipf_test_malloc_attempts_before_fail = test_number;
+
+		result = libgzipf_compressed_segment_initialize(
+		          &compressed_segment,
+		          1024,
+		          4096,
+		          &error );
+
+		if( gzipf_test_malloc_attempts_before_fail != -1 )
+		{
+			gzipf_test_malloc_attempts_before_fail = -1;
+
+			if( compressed_segment != NULL )
+			{
+				libgzipf_compressed_segment_free(
+				 &compressed_segment,
+				 NULL );
+			}
+		}
+		else
+		{
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "compressed_segment",
+			 compressed_segment );
+
+			GZIPF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libgzipf_compressed_segment_initialize with memset failing
+		 */
+		gzipf_test_memset_attempts_before_fail = test_number;
+
+		result = libgzipf_compressed_segment_initialize(
+		          &compressed_segment,
+		          1024,
+		          4096,
+		          &error );
+
+		if( gzipf_test_memset_attempts_before_fail != -1 )
+		{
+			gzipf_test_memset_attempts_before_fail = -1;
+
+			if( compressed_segment != NULL )
+			{
+				libgzipf_compressed_segment_free(
+				 &compressed_segment,
+				 NULL );
+			}
+		}
+		else
+		{
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "compressed_segment",
+			 compressed_segment );
+
+			GZIPF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_GZIPF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_segment != NULL )
+	{
+		libgzipf_compressed_segment_free(
+		 &compressed_segment,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libgzipf_compressed_segment_free function
  * Returns 1 if successful or 0 if not
  */
@@ -77,6 +363,307 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libgzipf_compressed_segment_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_compressed_segment_decode(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libgzipf_compressed_segment_t *compressed_segment = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libgzipf_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->decoder_type = LIBGZIPF_DECODER_NATIVE;
+
+	result = libgzipf_compressed_segment_initialize(
+	          &compressed_segment,
+	          0,
+	          108,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_segment",
+	 compressed_segment );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_compressed_segment_start_decoding(
+	          compressed_segment,
+	          segment_descriptor,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          52,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_segment->decoded_data_size",
+	 compressed_segment->decoded_data_size,
+	 (size_t) 0 );
+
+	/* Test regular cases
+	 */
+	result = libgzipf_compressed_segment_decode(
+	          compressed_segment,
+	          segment_descriptor,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          52,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_segment->decoded_data_size",
+	 compressed_segment->decoded_data_size,
+	 (size_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_segment->decoder",
+	 compressed_segment->decoder );
+
+	result = libgzipf_compressed_segment_decode(
+	          compressed_segment,
+	          segment_descriptor,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          52,
+	          16,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The segment is smaller than LIBGZIPF_SEGMENT_DECODE_SIZE
+	 */
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_segment->decoded_data_size",
+	 compressed_segment->decoded_data_size,
+	 (size_t) 108 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "compressed_segment->decoder",
+	 compressed_segment->decoder );
+
+	result = memory_compare(
+	          compressed_segment->uncompressed_data,
+	          gzipf_test_compressed_segment_fixed_huffman_uncompressed_data,
+	          108 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libgzipf_compressed_segment_decode(
+	          NULL,
+	          segment_descriptor,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          52,
+	          108,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_compressed_segment_decode(
+	          compressed_segment,
+	          NULL,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          52,
+	          108,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_compressed_segment_decode(
+	          compressed_segment,
+	          segment_descriptor,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          52,
+	          109,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decode with truncated compressed data
+	 */
+	result = libgzipf_compressed_segment_start_decoding(
+	          compressed_segment,
+	          segment_descriptor,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          26,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_compressed_segment_decode(
+	          compressed_segment,
+	          segment_descriptor,
+	          gzipf_test_compressed_segment_fixed_huffman_compressed_data,
+	          26,
+	          108,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "compressed_segment->decoder",
+	 compressed_segment->decoder );
+
+	/* Clean up
+	 */
+	result = libgzipf_compressed_segment_free(
+	          &compressed_segment,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "compressed_segment",
+	 compressed_segment );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_segment_descriptor_free(
+	          &segment_descriptor,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_segment != NULL )
+	{
+		libgzipf_compressed_segment_free(
+		 &compressed_segment,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libgzipf_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
 
 /* The main program
@@ -96,12 +683,24 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
 
-	/* TODO: add tests for libgzipf_compressed_segment_initialize */
+	GZIPF_TEST_RUN(
+	 "libgzipf_compressed_segment_initialize",
+	 gzipf_test_compressed_segment_initialize );
 
 	GZIPF_TEST_RUN(
 	 "libgzipf_compressed_segment_free",
 	 gzipf_test_compressed_segment_free );
 
+	/* TODO: add tests for libgzipf_compressed_segment_start_decoding */
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_compressed_segment_decode",
+	 gzipf_test_compressed_segment_decode );
+
+	/* TODO: add tests for libgzipf_compressed_segment_read_data */
+
+	/* TODO: add tests for libgzipf_compressed_segment_start_file_io_handle */
+
 	/* TODO: add tests for libgzipf_compressed_segment_read_file_io_handle */
 
 	/* TODO: add tests for libgzipf_compressed_segment_read_element_data */
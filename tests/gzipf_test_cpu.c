@@ -0,0 +1,148 @@
+/*
+ * Library CPU feature functions test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "gzipf_test_libgzipf.h"
+#include "gzipf_test_macros.h"
+#include "gzipf_test_unused.h"
+
+#include "../libgzipf/libgzipf_cpu.h"
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+/* Tests the libgzipf_cpu_determine_features function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_cpu_determine_features(
+     void )
+{
+	uint32_t features = 0;
+
+	features = libgzipf_cpu_determine_features();
+
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "features & LIBGZIPF_CPU_FEATURE_DETERMINED",
+	 (int) ( features & LIBGZIPF_CPU_FEATURE_DETERMINED ),
+	 0 );
+
+#if !defined( LIBGZIPF_CPU_HAVE_X86_64 )
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "features & x86-64 features",
+	 ( features & ( LIBGZIPF_CPU_FEATURE_SSSE3 | LIBGZIPF_CPU_FEATURE_PCLMULQDQ | LIBGZIPF_CPU_FEATURE_AVX2 ) ),
+	 (uint32_t) 0 );
+#endif
+#if defined( LIBGZIPF_CPU_HAVE_NEON )
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "features & LIBGZIPF_CPU_FEATURE_NEON",
+	 (int) ( features & LIBGZIPF_CPU_FEATURE_NEON ),
+	 0 );
+#else
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "features & LIBGZIPF_CPU_FEATURE_NEON",
+	 ( features & LIBGZIPF_CPU_FEATURE_NEON ),
+	 (uint32_t) 0 );
+#endif
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libgzipf_cpu_get_features function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_cpu_get_features(
+     void )
+{
+	uint32_t expected_features = 0;
+	uint32_t features          = 0;
+
+	expected_features = libgzipf_cpu_determine_features();
+
+	features = libgzipf_cpu_get_features();
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "features",
+	 features,
+	 expected_features );
+
+	/* Test if the cached features are returned
+	 */
+	features = libgzipf_cpu_get_features();
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "features",
+	 features,
+	 expected_features );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "libgzipf_cpu_features",
+	 libgzipf_cpu_features,
+	 expected_features );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argc )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_cpu_determine_features",
+	 gzipf_test_cpu_determine_features );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_cpu_get_features",
+	 gzipf_test_cpu_get_features );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1191 @@
+/*
+ * Library decoder testing program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "gzipf_test_libcerror.h"
+#include "gzipf_test_libgzipf.h"
+#include "gzipf_test_macros.h"
+#include "gzipf_test_memory.h"
+#include "gzipf_test_unused.h"
+
+#include "../libgzipf/libgzipf_decoder.h"
+
+uint8_t gzipf_test_decoder_fixed_huffman_compressed_data[ 52 ] = {
+	0x0b, 0xc9, 0x48, 0x55, 0x48, 0xcb, 0xac, 0x48, 0x4d, 0x51, 0xf0, 0x28, 0x4d, 0x4b, 0xcb, 0x4d,
+	0xcc, 0x53, 0x48, 0xca, 0xc9, 0x4f, 0xce, 0xb6, 0x52, 0x48, 0x44, 0x03, 0x0a, 0x89, 0x49, 0xc9,
+	0x68, 0x48, 0x21, 0x04, 0x97, 0x66, 0x03, 0x43, 0x23, 0x63, 0x13, 0x53, 0x33, 0x73, 0x0b, 0x4b,
+	0x24, 0x26, 0x17, 0x00 };
+
+uint8_t gzipf_test_decoder_fixed_huffman_uncompressed_data[ 108 ] = {
+	0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x48, 0x75, 0x66, 0x66, 0x6d, 0x61,
+	0x6e, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x20, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+	0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x20, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+	0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x48, 0x75, 0x66, 0x66, 0x6d, 0x61, 0x6e, 0x20, 0x62,
+	0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+	0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x0a };
+
+uint8_t gzipf_test_decoder_uncompressed_block_compressed_data[ 17 ] = {
+	0x00, 0x04, 0x00, 0xfb, 0xff, 0x54, 0x68, 0x65, 0x20, 0x01, 0x03, 0x00, 0xfc, 0xff, 0x65, 0x6e,
+	0x64 };
+
+uint8_t gzipf_test_decoder_fixed_huffman_blocks_compressed_data[ 56 ] = {
+	0x0a, 0xc9, 0x48, 0x55, 0x28, 0x2c, 0xcd, 0x4c, 0xce, 0x56, 0x48, 0x2a, 0xca, 0x2f, 0xcf, 0x53,
+	0x48, 0xcb, 0xaf, 0x50, 0xc8, 0x2a, 0xcd, 0x2d, 0x28, 0x56, 0xc8, 0x2f, 0x4b, 0x2d, 0x52, 0x28,
+	0x01, 0x4a, 0xe7, 0x24, 0x56, 0x55, 0x2a, 0xa4, 0xe4, 0xa7, 0xeb, 0x29, 0x00, 0x16, 0x82, 0x53,
+	0x71, 0x62, 0x7a, 0x62, 0x66, 0x9e, 0x1e, 0x00 };
+
+uint8_t gzipf_test_decoder_fixed_huffman_blocks_uncompressed_data[ 77 ] = {
+	0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20,
+	0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78,
+	0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x2e };
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+/* Tests the libgzipf_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libgzipf_decoder_t *decoder     = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_GZIPF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int number_of_memset_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libgzipf_decoder_initialize(
+	          &decoder,
+	          LIBGZIPF_DECODER_DEFAULT,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "decoder->decoder_type",
+	 decoder->decoder_type,
+	 LIBGZIPF_DECODER_DEFAULT );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_decoder_free(
+	          &decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_decoder_initialize(
+	          NULL,
+	          LIBGZIPF_DECODER_NATIVE,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decoder = (libgzipf_decoder_t *) 0x12345678UL;
+
+	result = libgzipf_decoder_initialize(
+	          &decoder,
+	          LIBGZIPF_DECODER_NATIVE,
+	          &error );
+
+	decoder = NULL;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_decoder_initialize(
+	          &decoder,
+	          -1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GZIPF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libgzipf_decoder_initialize with malloc failing
+		 */
+		gzipf_test_malloc_attempts_before_fail = test_number;
+
+		result = libgzipf_decoder_initialize(
+		          &decoder,
+		          LIBGZIPF_DECODER_NATIVE,
+		          &error );
+
+		if( gzipf_test_malloc_attempts_before_fail != -1 )
+		{
+			gzipf_test_malloc_attempts_before_fail = -1;
+
+			if( decoder != NULL )
+			{
+				libgzipf_decoder_free(
+				 &decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "decoder",
+			 decoder );
+
+			GZIPF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libgzipf_decoder_initialize with memset failing
+		 */
+		gzipf_test_memset_attempts_before_fail = test_number;
+
+		result = libgzipf_decoder_initialize(
+		          &decoder,
+		          LIBGZIPF_DECODER_NATIVE,
+		          &error );
+
+		if( gzipf_test_memset_attempts_before_fail != -1 )
+		{
+			gzipf_test_memset_attempts_before_fail = -1;
+
+			if( decoder != NULL )
+			{
+				libgzipf_decoder_free(
+				 &decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "decoder",
+			 decoder );
+
+			GZIPF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_GZIPF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libgzipf_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libgzipf_decoder_free(
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_decoder_is_supported function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_decoder_is_supported(
+     void )
+{
+	int result = 0;
+
+	result = libgzipf_decoder_is_supported(
+	          LIBGZIPF_DECODER_DEFAULT );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libgzipf_decoder_is_supported(
+	          LIBGZIPF_DECODER_NATIVE );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libgzipf_decoder_is_supported(
+	          LIBGZIPF_DECODER_ZLIB );
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+#else
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+
+	result = libgzipf_decoder_is_supported(
+	          -1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libgzipf_decoder_decode function with a specific decoder type
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_decoder_decode_with_type(
+     int decoder_type )
+{
+	uint8_t dictionary_data[ 32768 ];
+	uint8_t uncompressed_data[ 256 ];
+
+	libcerror_error_t *error        = NULL;
+	libgzipf_decoder_t *decoder     = NULL;
+	size_t compressed_data_offset   = 0;
+	size_t dictionary_data_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	uint8_t number_of_bits          = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libgzipf_decoder_initialize(
+	          &decoder,
+	          decoder_type,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decoding fixed Huffman compressed data at once
+	 */
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_compressed_data,
+	          52,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          LIBGZIPF_DECODER_FLAG_FINAL_INPUT,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 52 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 108 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          gzipf_test_decoder_fixed_huffman_uncompressed_data,
+	          108 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libgzipf_decoder_is_end_of_stream(
+	          decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decoding block by block
+	 */
+	result = libgzipf_decoder_reset(
+	          decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_uncompressed_block_compressed_data,
+	          17,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          LIBGZIPF_DECODER_FLAG_FINAL_INPUT | LIBGZIPF_DECODER_FLAG_STOP_AT_END_OF_BLOCK,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 9 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 4 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_decoder_is_end_of_stream(
+	          decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_decoder_get_number_of_bits(
+	          decoder,
+	          &number_of_bits,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_decoder_get_dictionary(
+	          decoder,
+	          dictionary_data,
+	          32768,
+	          &dictionary_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "dictionary_data_size",
+	 dictionary_data_size,
+	 (size_t) 4 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          dictionary_data,
+	          "The ",
+	          4 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_uncompressed_block_compressed_data,
+	          17,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          LIBGZIPF_DECODER_FLAG_FINAL_INPUT | LIBGZIPF_DECODER_FLAG_STOP_AT_END_OF_BLOCK,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 17 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 7 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "The end",
+	          7 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libgzipf_decoder_is_end_of_stream(
+	          decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decoding truncated compressed data
+	 */
+	result = libgzipf_decoder_reset(
+	          decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_compressed_data,
+	          32,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_compressed_data,
+	          32,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          LIBGZIPF_DECODER_FLAG_FINAL_INPUT,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_decoder_decode(
+	          NULL,
+	          gzipf_test_decoder_fixed_huffman_compressed_data,
+	          52,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          NULL,
+	          52,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_compressed_data,
+	          52,
+	          NULL,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_compressed_data,
+	          52,
+	          &compressed_data_offset,
+	          NULL,
+	          256,
+	          &uncompressed_data_offset,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_compressed_data,
+	          52,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          NULL,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_decoder_free(
+	          &decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libgzipf_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_decoder_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_decoder_decode(
+     void )
+{
+	int result = 0;
+
+	result = gzipf_test_decoder_decode_with_type(
+	          LIBGZIPF_DECODER_NATIVE );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+	result = gzipf_test_decoder_decode_with_type(
+	          LIBGZIPF_DECODER_ZLIB );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+#endif
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libgzipf_decoder_prime_bits and libgzipf_decoder_set_dictionary functions
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_decoder_resume_with_type(
+     int decoder_type )
+{
+	uint8_t dictionary_data[ 32768 ];
+	uint8_t uncompressed_data[ 256 ];
+
+	libcerror_error_t *error        = NULL;
+	libgzipf_decoder_t *decoder     = NULL;
+	size_t compressed_data_offset   = 0;
+	size_t dictionary_data_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libgzipf_decoder_initialize(
+	          &decoder,
+	          decoder_type,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test resuming at the start of the second block, which starts at bit 1 of byte 45
+	 * and contains distance codes that refer to the first block
+	 */
+	result = libgzipf_decoder_prime_bits(
+	          decoder,
+	          7,
+	          gzipf_test_decoder_fixed_huffman_blocks_compressed_data[ 45 ] >> 1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_decoder_set_dictionary(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_blocks_uncompressed_data,
+	          45,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset   = 46;
+	uncompressed_data_offset = 0;
+
+	result = libgzipf_decoder_decode(
+	          decoder,
+	          gzipf_test_decoder_fixed_huffman_blocks_compressed_data,
+	          56,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          LIBGZIPF_DECODER_FLAG_FINAL_INPUT,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 32 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          &( gzipf_test_decoder_fixed_huffman_blocks_uncompressed_data[ 45 ] ),
+	          32 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the dictionary contains the preset dictionary followed by the uncompressed data
+	 */
+	result = libgzipf_decoder_get_dictionary(
+	          decoder,
+	          dictionary_data,
+	          32768,
+	          &dictionary_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "dictionary_data_size",
+	 dictionary_data_size,
+	 (size_t) 77 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          dictionary_data,
+	          gzipf_test_decoder_fixed_huffman_blocks_uncompressed_data,
+	          77 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libgzipf_decoder_prime_bits(
+	          decoder,
+	          8,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_decoder_set_dictionary(
+	          decoder,
+	          NULL,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_decoder_free(
+	          &decoder,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libgzipf_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests resuming decoding with the supported decoders
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_decoder_resume(
+     void )
+{
+	int result = 0;
+
+	result = gzipf_test_decoder_resume_with_type(
+	          LIBGZIPF_DECODER_NATIVE );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+	result = gzipf_test_decoder_resume_with_type(
+	          LIBGZIPF_DECODER_ZLIB );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL ) */
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argc )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_decoder_initialize",
+	 gzipf_test_decoder_initialize );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_decoder_free",
+	 gzipf_test_decoder_free );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_decoder_is_supported",
+	 gzipf_test_decoder_is_supported );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_decoder_decode",
+	 gzipf_test_decoder_decode );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_decoder_resume",
+	 gzipf_test_decoder_resume );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+}
+
@@ -689,6 +689,41 @@ uint8_t gzipf_test_deflate_uncompressed_data[ 7640 ] = {
 	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c, 0x69,
 	0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a, 0x0a };
 
+uint8_t gzipf_test_deflate_fixed_huffman_compressed_data[ 52 ] = {
+	0x0b, 0xc9, 0x48, 0x55, 0x48, 0xcb, 0xac, 0x48, 0x4d, 0x51, 0xf0, 0x28, 0x4d, 0x4b, 0xcb, 0x4d,
+	0xcc, 0x53, 0x48, 0xca, 0xc9, 0x4f, 0xce, 0xb6, 0x52, 0x48, 0x44, 0x03, 0x0a, 0x89, 0x49, 0xc9,
+	0x68, 0x48, 0x21, 0x04, 0x97, 0x66, 0x03, 0x43, 0x23, 0x63, 0x13, 0x53, 0x33, 0x73, 0x0b, 0x4b,
+	0x24, 0x26, 0x17, 0x00 };
+
+uint8_t gzipf_test_deflate_fixed_huffman_uncompressed_data[ 108 ] = {
+	0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x48, 0x75, 0x66, 0x66, 0x6d, 0x61,
+	0x6e, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x20, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+	0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x20, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+	0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x48, 0x75, 0x66, 0x66, 0x6d, 0x61, 0x6e, 0x20, 0x62,
+	0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+	0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x0a };
+
+/* Data of a DEFLATE block flushed at a block boundary followed by the final block
+ */
+uint8_t gzipf_test_deflate_multiple_blocks_compressed_data[ 26 ] = {
+	0x78, 0x9c, 0xca, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0xc8, 0x40, 0x22, 0xcb, 0xf3, 0x8b, 0x72, 0x52,
+	0x00, 0x4b, 0x4c, 0x4a, 0x06, 0x00, 0x85, 0x16, 0x09, 0xeb };
+
+uint8_t gzipf_test_deflate_multiple_blocks_uncompressed_data[ 26 ] = {
+	0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x68, 0x65, 0x6c, 0x6c,
+	0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x61, 0x62, 0x63 };
+
+/* Data of a DEFLATE block flushed with an empty block followed by the final block
+ * where the final block is read into the bit buffer together with the previous block
+ */
+uint8_t gzipf_test_deflate_partial_flush_compressed_data[ 17 ] = {
+	0x78, 0x9c, 0x4a, 0x4c, 0x49, 0x52, 0x48, 0x29, 0x52, 0x00, 0x08, 0x30, 0x00, 0x09, 0xa0, 0x02,
+	0x3e };
+
+uint8_t gzipf_test_deflate_partial_flush_uncompressed_data[ 7 ] = {
+	0x61, 0x64, 0x62, 0x20, 0x64, 0x72, 0x20 };
+
 #if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
 
 /* Tests the libgzipf_deflate_build_dynamic_huffman_trees function
@@ -1054,6 +1089,7 @@ int gzipf_test_deflate_build_fixed_huffman_trees(
 	libgzipf_huffman_tree_t *literals_tree  = NULL;
 	libcerror_error_t *error               = NULL;
 	int result                             = 0;
+	int table_index                        = 0;
 
 #if defined( HAVE_GZIPF_TEST_MEMORY )
 	int number_of_memset_fail_tests        = 4;
@@ -1116,6 +1152,31 @@ int gzipf_test_deflate_build_fixed_huffman_trees(
 	 "error",
 	 error );
 
+	/* Test if the precomputed fixed Huffman lookup tables match the built trees
+	 */
+	for( table_index = 0;
+	     table_index < ( 1 << literals_tree->lookup_table_bits );
+	     table_index++ )
+	{
+		GZIPF_TEST_ASSERT_EQUAL_UINT32(
+		 "literals_tree->lookup_table[ table_index ]",
+		 literals_tree->lookup_table[ table_index ],
+		 libgzipf_deflate_fixed_huffman_literals_lookup_table[ table_index % 512 ] );
+	}
+	for( table_index = 0;
+	     table_index < ( 1 << distances_tree->lookup_table_bits );
+	     table_index++ )
+	{
+		/* The distances tree has no codes for the unused symbols 30 and 31
+		 */
+		if( distances_tree->lookup_table[ table_index ] != 0 )
+		{
+			GZIPF_TEST_ASSERT_EQUAL_UINT32(
+			 "distances_tree->lookup_table[ table_index ]",
+			 distances_tree->lookup_table[ table_index ],
+			 libgzipf_deflate_fixed_huffman_distances_lookup_table[ table_index % 32 ] );
+		}
+	}
 	/* Test error cases
 	 */
 	result = libgzipf_deflate_build_fixed_huffman_trees(
@@ -1247,10 +1308,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libgzipf_deflate_decode_huffman function
+/* Tests the libgzipf_deflate_decode_huffman_fast function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_deflate_decode_huffman(
+int gzipf_test_deflate_decode_huffman_fast(
      void )
 {
 	uint8_t uncompressed_data[ 8192 ];
@@ -1259,6 +1320,7 @@ int gzipf_test_deflate_decode_huffman(
 	libgzipf_huffman_tree_t *distances_tree = NULL;
 	libgzipf_huffman_tree_t *literals_tree  = NULL;
 	libcerror_error_t *error               = NULL;
+	size_t minimum_match_offset            = 0;
 	size_t uncompressed_data_offset        = 0;
 	uint32_t value_32bit                   = 0;
 	int result                             = 0;
@@ -1324,8 +1386,6 @@ int gzipf_test_deflate_decode_huffman(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
 	result = libgzipf_bit_stream_get_value(
 	          bit_stream,
 	          3,
@@ -1361,110 +1421,59 @@ int gzipf_test_deflate_decode_huffman(
 	 "error",
 	 error );
 
-	result = libgzipf_deflate_decode_huffman(
+	/* Test regular cases
+	 */
+	minimum_match_offset = 8192;
+
+	result = libgzipf_deflate_decode_huffman_fast(
 	          bit_stream,
 	          literals_tree,
 	          distances_tree,
 	          uncompressed_data,
 	          8192,
 	          &uncompressed_data_offset,
+	          &minimum_match_offset,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT(
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libgzipf_bit_stream_free(
-	          &bit_stream,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	GZIPF_TEST_ASSERT_GREATER_THAN_INT(
+	 "uncompressed_data_offset",
+	 (int) uncompressed_data_offset,
+	 0 );
 
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	GZIPF_TEST_ASSERT_LESS_THAN_INT(
+	 "minimum_match_offset",
+	 (int) minimum_match_offset,
+	 (int) uncompressed_data_offset );
 
-	/* Initialize test
-	 */
-	result = libgzipf_bit_stream_initialize(
-	          &bit_stream,
-	          gzipf_test_deflate_compressed_data,
-	          2627,
-	          2,
-	          LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
-	          &error );
+	result = memory_compare(
+	          uncompressed_data,
+	          gzipf_test_deflate_uncompressed_data,
+	          uncompressed_data_offset );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "bit_stream",
-	 bit_stream );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libgzipf_bit_stream_get_value(
-	          bit_stream,
-	          3,
-	          &value_32bit,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_EQUAL_UINT32(
-	 "value_32bit",
-	 value_32bit,
-	 (uint32_t) 0x00000005UL );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libgzipf_deflate_build_dynamic_huffman_trees(
-	          bit_stream,
-	          literals_tree,
-	          distances_tree,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libgzipf_deflate_decode_huffman(
+	result = libgzipf_deflate_decode_huffman_fast(
 	          NULL,
 	          literals_tree,
 	          distances_tree,
 	          uncompressed_data,
 	          8192,
 	          &uncompressed_data_offset,
+	          &minimum_match_offset,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1479,13 +1488,14 @@ int gzipf_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_decode_huffman(
+	result = libgzipf_deflate_decode_huffman_fast(
 	          bit_stream,
 	          NULL,
 	          distances_tree,
 	          uncompressed_data,
 	          8192,
 	          &uncompressed_data_offset,
+	          &minimum_match_offset,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1500,13 +1510,14 @@ int gzipf_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_decode_huffman(
+	result = libgzipf_deflate_decode_huffman_fast(
 	          bit_stream,
 	          literals_tree,
 	          NULL,
 	          uncompressed_data,
 	          8192,
 	          &uncompressed_data_offset,
+	          &minimum_match_offset,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1521,13 +1532,14 @@ int gzipf_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_decode_huffman(
+	result = libgzipf_deflate_decode_huffman_fast(
 	          bit_stream,
 	          literals_tree,
 	          distances_tree,
 	          NULL,
 	          8192,
 	          &uncompressed_data_offset,
+	          &minimum_match_offset,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1542,13 +1554,14 @@ int gzipf_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_decode_huffman(
+	result = libgzipf_deflate_decode_huffman_fast(
 	          bit_stream,
 	          literals_tree,
 	          distances_tree,
 	          uncompressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_offset,
+	          8192,
+	          NULL,
+	          &minimum_match_offset,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1563,12 +1576,13 @@ int gzipf_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_decode_huffman(
+	result = libgzipf_deflate_decode_huffman_fast(
 	          bit_stream,
 	          literals_tree,
 	          distances_tree,
 	          uncompressed_data,
 	          8192,
+	          &uncompressed_data_offset,
 	          NULL,
 	          &error );
 
@@ -1666,23 +1680,29 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libgzipf_deflate_calculate_adler32 function
+/* Tests the libgzipf_deflate_decode_fixed_huffman function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_deflate_calculate_adler32(
+int gzipf_test_deflate_decode_fixed_huffman(
      void )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t checksum        = 0;
-	int result               = 0;
+	uint8_t uncompressed_data[ 512 ];
 
-	/* Test regular cases
+	libgzipf_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t uncompressed_data_offset   = 0;
+	uint8_t block_type                = 0;
+	uint8_t last_block_flag           = 0;
+	int result                        = 0;
+
+	/* Initialize test
 	 */
-	result = libgzipf_deflate_calculate_adler32(
-	          &checksum,
-	          gzipf_test_deflate_uncompressed_data,
-	          7640,
-	          1,
+	result = libgzipf_bit_stream_initialize(
+	          &bit_stream,
+	          gzipf_test_deflate_fixed_huffman_compressed_data,
+	          52,
+	          0,
+	          LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1690,102 +1710,40 @@ int gzipf_test_deflate_calculate_adler32(
 	 result,
 	 1 );
 
-	GZIPF_TEST_ASSERT_EQUAL_UINT32(
-	 "checksum",
-	 checksum,
-	 (uint32_t) 0x304a56a4UL );
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libgzipf_deflate_calculate_adler32(
-	          NULL,
-	          gzipf_test_deflate_uncompressed_data,
-	          7640,
-	          1,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libgzipf_deflate_calculate_adler32(
-	          &checksum,
-	          NULL,
-	          7640,
-	          1,
+	result = libgzipf_deflate_read_block_header(
+	          bit_stream,
+	          &block_type,
+	          &last_block_flag,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libgzipf_deflate_calculate_adler32(
-	          &checksum,
-	          gzipf_test_deflate_uncompressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          1,
-	          &error );
+	 1 );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "block_type",
+	 block_type,
+	 (uint8_t) LIBGZIPF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libgzipf_deflate_read_data_header function
- * Returns 1 if successful or 0 if not
- */
-int gzipf_test_deflate_read_data_header(
-     void )
-{
-	libcerror_error_t *error        = NULL;
-	size_t uncompressed_data_offset = 0;
-	int result                      = 0;
-
 	/* Test regular cases
 	 */
-	uncompressed_data_offset = 0;
-
-	result = libgzipf_deflate_read_data_header(
-	          gzipf_test_deflate_compressed_data,
-	          2627,
+	result = libgzipf_deflate_decode_fixed_huffman(
+	          bit_stream,
+	          uncompressed_data,
+	          512,
 	          &uncompressed_data_offset,
 	          &error );
 
@@ -1797,19 +1755,30 @@ int gzipf_test_deflate_read_data_header(
 	GZIPF_TEST_ASSERT_EQUAL_SIZE(
 	 "uncompressed_data_offset",
 	 uncompressed_data_offset,
-	 (size_t) 2 );
+	 (size_t) 108 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          uncompressed_data,
+	          gzipf_test_deflate_fixed_huffman_uncompressed_data,
+	          108 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	uncompressed_data_offset = 0;
 
-	result = libgzipf_deflate_read_data_header(
+	result = libgzipf_deflate_decode_fixed_huffman(
 	          NULL,
-	          2627,
+	          uncompressed_data,
+	          512,
 	          &uncompressed_data_offset,
 	          &error );
 
@@ -1825,9 +1794,10 @@ int gzipf_test_deflate_read_data_header(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_read_data_header(
-	          gzipf_test_deflate_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
+	result = libgzipf_deflate_decode_fixed_huffman(
+	          bit_stream,
+	          NULL,
+	          512,
 	          &uncompressed_data_offset,
 	          &error );
 
@@ -1843,10 +1813,11 @@ int gzipf_test_deflate_read_data_header(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_read_data_header(
-	          gzipf_test_deflate_compressed_data,
-	          2627,
-	          NULL,
+	result = libgzipf_deflate_decode_fixed_huffman(
+	          bit_stream,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1861,10 +1832,11 @@ int gzipf_test_deflate_read_data_header(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_read_data_header(
-	          gzipf_test_deflate_compressed_data,
-	          1,
-	          &uncompressed_data_offset,
+	result = libgzipf_deflate_decode_fixed_huffman(
+	          bit_stream,
+	          uncompressed_data,
+	          512,
+	          NULL,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1879,12 +1851,816 @@ int gzipf_test_deflate_read_data_header(
 	libcerror_error_free(
 	 &error );
 
-/* TODO test compression_method != 8 */
-/* TODO test compression_window_size > 32768 */
+	/* Test decoding with uncompressed data too small
+	 */
+	bit_stream->byte_stream_offset = 0;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
 
-	return( 1 );
+	result = libgzipf_deflate_read_block_header(
+	          bit_stream,
+	          &block_type,
+	          &last_block_flag,
+	          &error );
 
-on_error:
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_deflate_decode_fixed_huffman(
+	          bit_stream,
+	          uncompressed_data,
+	          64,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		libgzipf_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_deflate_decode_huffman function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_deflate_decode_huffman(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libgzipf_bit_stream_t *bit_stream       = NULL;
+	libgzipf_huffman_tree_t *distances_tree = NULL;
+	libgzipf_huffman_tree_t *literals_tree  = NULL;
+	libcerror_error_t *error               = NULL;
+	size_t uncompressed_data_offset        = 0;
+	uint32_t value_32bit                   = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libgzipf_bit_stream_initialize(
+	          &bit_stream,
+	          gzipf_test_deflate_compressed_data,
+	          2627,
+	          2,
+	          LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_huffman_tree_initialize(
+	          &literals_tree,
+	          288,
+	          15,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "literals_tree",
+	 literals_tree );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_huffman_tree_initialize(
+	          &distances_tree,
+	          30,
+	          15,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "distances_tree",
+	 distances_tree );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libgzipf_bit_stream_get_value(
+	          bit_stream,
+	          3,
+	          &value_32bit,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000005UL );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_deflate_build_dynamic_huffman_trees(
+	          bit_stream,
+	          literals_tree,
+	          distances_tree,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_deflate_decode_huffman(
+	          bit_stream,
+	          literals_tree,
+	          distances_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libgzipf_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libgzipf_bit_stream_initialize(
+	          &bit_stream,
+	          gzipf_test_deflate_compressed_data,
+	          2627,
+	          2,
+	          LIBGZIPF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_bit_stream_get_value(
+	          bit_stream,
+	          3,
+	          &value_32bit,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000005UL );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_deflate_build_dynamic_huffman_trees(
+	          bit_stream,
+	          literals_tree,
+	          distances_tree,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_deflate_decode_huffman(
+	          NULL,
+	          literals_tree,
+	          distances_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_decode_huffman(
+	          bit_stream,
+	          NULL,
+	          distances_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_decode_huffman(
+	          bit_stream,
+	          literals_tree,
+	          NULL,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_decode_huffman(
+	          bit_stream,
+	          literals_tree,
+	          distances_tree,
+	          NULL,
+	          8192,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_decode_huffman(
+	          bit_stream,
+	          literals_tree,
+	          distances_tree,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_decode_huffman(
+	          bit_stream,
+	          literals_tree,
+	          distances_tree,
+	          uncompressed_data,
+	          8192,
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_huffman_tree_free(
+	          &distances_tree,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "distances_tree",
+	 distances_tree );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_huffman_tree_free(
+	          &literals_tree,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "literals_tree",
+	 literals_tree );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( distances_tree != NULL )
+	{
+		libgzipf_huffman_tree_free(
+		 &distances_tree,
+		 NULL );
+	}
+	if( literals_tree != NULL )
+	{
+		libgzipf_huffman_tree_free(
+		 &literals_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		libgzipf_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_deflate_determine_adler32_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_deflate_determine_adler32_kernel(
+     void )
+{
+	uint8_t data[ 12288 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t value_32bit       = 0x12345678UL;
+	int adler32_kernel         = 0;
+	int result                 = 0;
+
+	/* The second half of the data consists of 0xff bytes, which results in
+	 * the largest intermediate sums
+	 */
+	for( data_offset = 0;
+	     data_offset < 6144;
+	     data_offset++ )
+	{
+		value_32bit = ( value_32bit * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( value_32bit >> 16 );
+	}
+	for( data_offset = 6144;
+	     data_offset < 12288;
+	     data_offset++ )
+	{
+		data[ data_offset ] = 0xff;
+	}
+	adler32_kernel = libgzipf_deflate_determine_adler32_kernel();
+
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "adler32_kernel",
+	 adler32_kernel,
+	 LIBGZIPF_DEFLATE_ADLER32_KERNEL_UNDETERMINED );
+
+	/* Test if the kernel returns the same checksum as the scalar kernel
+	 * for various alignments and sizes
+	 */
+	libgzipf_deflate_adler32_kernel = adler32_kernel;
+
+	for( data_offset = 0;
+	     data_offset < 6144;
+	     data_offset += 1021 )
+	{
+		for( data_size = 0;
+		     data_size <= ( 12288 - data_offset );
+		     data_size += 97 )
+		{
+			expected_checksum = libgzipf_deflate_update_adler32_scalar(
+			                     0xfff0fff0UL,
+			                     &( data[ data_offset ] ),
+			                     data_size );
+
+			result = libgzipf_deflate_calculate_adler32(
+			          &checksum,
+			          &( data[ data_offset ] ),
+			          data_size,
+			          0xfff0fff0UL,
+			          &error );
+
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			GZIPF_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum",
+			 checksum,
+			 expected_checksum );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	libgzipf_deflate_adler32_kernel = LIBGZIPF_DEFLATE_ADLER32_KERNEL_UNDETERMINED;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libgzipf_deflate_adler32_kernel = LIBGZIPF_DEFLATE_ADLER32_KERNEL_UNDETERMINED;
+
+	return( 0 );
+}
+
+/* Tests the libgzipf_deflate_calculate_adler32 function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_deflate_calculate_adler32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libgzipf_deflate_calculate_adler32(
+	          &checksum,
+	          gzipf_test_deflate_uncompressed_data,
+	          7640,
+	          1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x304a56a4UL );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_deflate_calculate_adler32(
+	          NULL,
+	          gzipf_test_deflate_uncompressed_data,
+	          7640,
+	          1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_calculate_adler32(
+	          &checksum,
+	          NULL,
+	          7640,
+	          1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_calculate_adler32(
+	          &checksum,
+	          gzipf_test_deflate_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_deflate_read_data_header function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_deflate_read_data_header(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	size_t uncompressed_data_offset = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_offset = 0;
+
+	result = libgzipf_deflate_read_data_header(
+	          gzipf_test_deflate_compressed_data,
+	          2627,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 2 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_offset = 0;
+
+	result = libgzipf_deflate_read_data_header(
+	          NULL,
+	          2627,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_read_data_header(
+	          gzipf_test_deflate_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_read_data_header(
+	          gzipf_test_deflate_compressed_data,
+	          2627,
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_read_data_header(
+	          gzipf_test_deflate_compressed_data,
+	          1,
+	          &uncompressed_data_offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+/* TODO test compression_method != 8 */
+/* TODO test compression_window_size > 32768 */
+
+	return( 1 );
+
+on_error:
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -2025,10 +2801,346 @@ int gzipf_test_deflate_read_block_header(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_deflate_read_block_header(
-	          bit_stream,
-	          &block_type,
+	result = libgzipf_deflate_read_block_header(
+	          bit_stream,
+	          &block_type,
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		libgzipf_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_deflate_get_stored_block_data_range function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_deflate_get_stored_block_data_range(
+     void )
+{
+	uint8_t stored_block_data1[ 10 ] = {
+		0x01, 0x05, 0x00, 0xfa, 0xff, 'h', 'e', 'l', 'l', 'o' };
+	uint8_t stored_block_data2[ 5 ] = {
+		0x20, 0x05, 0x00, 0xfa, 0xff };
+	uint8_t stored_block_data3[ 6 ] = {
+		0x40, 0x00, 0x05, 0x00, 0xfa, 0xff };
+	uint8_t empty_stored_block_data[ 5 ] = {
+		0x00, 0x00, 0x00, 0xff, 0xff };
+	uint8_t fixed_huffman_block_data[ 5 ] = {
+		0x03, 0x05, 0x00, 0xfa, 0xff };
+	uint8_t invalid_block_size_data[ 5 ] = {
+		0x01, 0x05, 0x00, 0xfb, 0xff };
+	uint8_t invalid_block_size_upper_byte_data[ 5 ] = {
+		0x01, 0x05, 0x00, 0xfa, 0xfe };
+
+	libcerror_error_t *error = NULL;
+	size_t block_data_offset = 0;
+	size_t block_data_size   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data1,
+	          10,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_offset",
+	 block_data_offset,
+	 (size_t) 5 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 5 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a block header that starts in the middle of the first byte
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data2,
+	          5,
+	          3,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_offset",
+	 block_data_offset,
+	 (size_t) 5 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 5 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a block header that spans the first and second byte
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data3,
+	          6,
+	          2,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_offset",
+	 block_data_offset,
+	 (size_t) 6 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 5 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty stored block as written by a zlib flush
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          empty_stored_block_data,
+	          5,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_offset",
+	 block_data_offset,
+	 (size_t) 5 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a block that is not a stored block
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          fixed_huffman_block_data,
+	          5,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stored block with a mismatching block size
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          invalid_block_size_data,
+	          5,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stored block with a block size that only mismatches in the upper byte
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          invalid_block_size_upper_byte_data,
+	          5,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data too small to contain the block header
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data1,
+	          4,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          NULL,
+	          10,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data1,
+	          10,
+	          8,
+	          &block_data_offset,
+	          &block_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data1,
+	          10,
+	          0,
 	          NULL,
+	          &block_data_size,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -2043,34 +3155,29 @@ int gzipf_test_deflate_read_block_header(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libgzipf_bit_stream_free(
-	          &bit_stream,
+	result = libgzipf_deflate_get_stored_block_data_range(
+	          stored_block_data1,
+	          10,
+	          0,
+	          &block_data_offset,
+	          NULL,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 -1 );
 
-	GZIPF_TEST_ASSERT_IS_NULL(
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
-	if( bit_stream != NULL )
-	{
-		libgzipf_bit_stream_free(
-		 &bit_stream,
-		 NULL );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -2087,15 +3194,13 @@ int gzipf_test_deflate_read_block(
 {
 	uint8_t uncompressed_data[ 8192 ];
 
-	libgzipf_bit_stream_t *bit_stream             = NULL;
-	libgzipf_huffman_tree_t *fixed_distances_tree = NULL;
-	libgzipf_huffman_tree_t *fixed_literals_tree  = NULL;
-	libcerror_error_t *error                     = NULL;
-	size_t uncompressed_data_offset              = 0;
-	size_t uncompressed_data_size                = 7640;
-	uint8_t block_type                           = 0;
-	uint8_t last_block_flag                      = 0;
-	int result                                   = 0;
+	libgzipf_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t uncompressed_data_offset   = 0;
+	size_t uncompressed_data_size     = 7640;
+	uint8_t block_type                = 0;
+	uint8_t last_block_flag           = 0;
+	int result                        = 0;
 
 	/* Initialize test
 	 */
@@ -2120,58 +3225,6 @@ int gzipf_test_deflate_read_block(
 	 "error",
 	 error );
 
-	result = libgzipf_huffman_tree_initialize(
-	          &fixed_literals_tree,
-	          288,
-	          15,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "fixed_literals_tree",
-	 fixed_literals_tree );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libgzipf_huffman_tree_initialize(
-	          &fixed_distances_tree,
-	          30,
-	          15,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "fixed_distances_tree",
-	 fixed_distances_tree );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libgzipf_deflate_build_fixed_huffman_trees(
-	          fixed_literals_tree,
-	          fixed_distances_tree,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libgzipf_deflate_read_block_header(
 	          bit_stream,
 	          &block_type,
@@ -2192,8 +3245,6 @@ int gzipf_test_deflate_read_block(
 	result = libgzipf_deflate_read_block(
 	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2262,8 +3313,6 @@ int gzipf_test_deflate_read_block(
 	result = libgzipf_deflate_read_block(
 	          NULL,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2284,8 +3333,6 @@ int gzipf_test_deflate_read_block(
 	result = libgzipf_deflate_read_block(
 	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          NULL,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2306,8 +3353,6 @@ int gzipf_test_deflate_read_block(
 	result = libgzipf_deflate_read_block(
 	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          uncompressed_data,
 	          (size_t) SSIZE_MAX + 1,
 	          &uncompressed_data_offset,
@@ -2328,8 +3373,6 @@ int gzipf_test_deflate_read_block(
 	result = libgzipf_deflate_read_block(
 	          bit_stream,
 	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          NULL,
@@ -2349,40 +3392,6 @@ int gzipf_test_deflate_read_block(
 
 	/* Clean up
 	 */
-	result = libgzipf_huffman_tree_free(
-	          &fixed_distances_tree,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "fixed_distances_tree",
-	 fixed_distances_tree );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libgzipf_huffman_tree_free(
-	          &fixed_literals_tree,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "fixed_literals_tree",
-	 fixed_literals_tree );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libgzipf_bit_stream_free(
 	          &bit_stream,
 	          &error );
@@ -2403,18 +3412,6 @@ int gzipf_test_deflate_read_block(
 	return( 1 );
 
 on_error:
-	if( fixed_distances_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &fixed_distances_tree,
-		 NULL );
-	}
-	if( fixed_literals_tree != NULL )
-	{
-		libgzipf_huffman_tree_free(
-		 &fixed_literals_tree,
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
 		libgzipf_bit_stream_free(
@@ -2464,6 +3461,41 @@ int gzipf_test_deflate_decompress(
 	 "error",
 	 error );
 
+	/* Test the final block being in the bit buffer after all compressed data was read
+	 */
+	uncompressed_data_size = 8192;
+
+	result = libgzipf_deflate_decompress(
+	          &( gzipf_test_deflate_multiple_blocks_compressed_data[ 2 ] ),
+	          26 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          gzipf_test_deflate_multiple_blocks_uncompressed_data,
+	          26 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 /* TODO: test uncompressed data too small */
 
 	/* Test error cases
@@ -2544,6 +3576,29 @@ int gzipf_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
+	/* Test compressed data that ends before the final block
+	 */
+	uncompressed_data_size = 8192;
+
+	result = libgzipf_deflate_decompress(
+	          &( gzipf_test_deflate_multiple_blocks_compressed_data[ 2 ] ),
+	          12,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -2561,6 +3616,7 @@ on_error:
 int gzipf_test_deflate_decompress_zlib(
      void )
 {
+	uint8_t compressed_data[ 26 ];
 	uint8_t uncompressed_data[ 8192 ];
 
 	libcerror_error_t *error      = NULL;
@@ -2590,6 +3646,75 @@ int gzipf_test_deflate_decompress_zlib(
 	 "error",
 	 error );
 
+	/* Test the final block being in the bit buffer after all compressed data was read
+	 * and the Adler-32 checksum directly following the compressed data
+	 */
+	uncompressed_data_size = 8192;
+
+	result = libgzipf_deflate_decompress_zlib(
+	          gzipf_test_deflate_multiple_blocks_compressed_data,
+	          26,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          gzipf_test_deflate_multiple_blocks_uncompressed_data,
+	          26 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 8192;
+
+	result = libgzipf_deflate_decompress_zlib(
+	          gzipf_test_deflate_partial_flush_compressed_data,
+	          17,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          gzipf_test_deflate_partial_flush_uncompressed_data,
+	          7 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 /* TODO: test uncompressed data too small */
 
 	/* Test error cases
@@ -2670,6 +3795,64 @@ int gzipf_test_deflate_decompress_zlib(
 	libcerror_error_free(
 	 &error );
 
+	/* Test a mismatch of the Adler-32 checksum
+	 */
+	result = memory_copy(
+	          compressed_data,
+	          gzipf_test_deflate_multiple_blocks_compressed_data,
+	          26 ) == NULL ? -1 : 1;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	compressed_data[ 25 ] ^= 0xff;
+
+	uncompressed_data_size = 8192;
+
+	result = libgzipf_deflate_decompress_zlib(
+	          compressed_data,
+	          26,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data that ends before the final block
+	 */
+	uncompressed_data_size = 8192;
+
+	result = libgzipf_deflate_decompress_zlib(
+	          gzipf_test_deflate_multiple_blocks_compressed_data,
+	          14,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -2716,10 +3899,22 @@ int main(
 	 "libgzipf_deflate_build_fixed_huffman_trees",
 	 gzipf_test_deflate_build_fixed_huffman_trees );
 
+	GZIPF_TEST_RUN(
+	 "libgzipf_deflate_decode_huffman_fast",
+	 gzipf_test_deflate_decode_huffman_fast );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_deflate_decode_fixed_huffman",
+	 gzipf_test_deflate_decode_fixed_huffman );
+
 	GZIPF_TEST_RUN(
 	 "libgzipf_deflate_decode_huffman",
 	 gzipf_test_deflate_decode_huffman );
 
+	GZIPF_TEST_RUN(
+	 "libgzipf_deflate_determine_adler32_kernel",
+	 gzipf_test_deflate_determine_adler32_kernel );
+
 	GZIPF_TEST_RUN(
 	 "libgzipf_deflate_calculate_adler32",
 	 gzipf_test_deflate_calculate_adler32 );
@@ -2728,6 +3923,10 @@ int main(
 	 "libgzipf_deflate_read_data_header",
 	 gzipf_test_deflate_read_data_header );
 
+	GZIPF_TEST_RUN(
+	 "libgzipf_deflate_get_stored_block_data_range",
+	 gzipf_test_deflate_get_stored_block_data_range );
+
 	GZIPF_TEST_RUN(
 	 "libgzipf_deflate_read_block",
 	 gzipf_test_deflate_read_block );
@@ -0,0 +1,586 @@
+/*
+ * Library DEFLATE decompression benchmark program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#include "gzipf_test_libcerror.h"
+#include "gzipf_test_libgzipf.h"
+#include "gzipf_test_unused.h"
+
+#include "../libgzipf/libgzipf_deflate.h"
+
+/* The benchmark is not run by make check, build and run it with:
+ * make -C tests gzipf_test_deflate_benchmark
+ * ./tests/gzipf_test_deflate_benchmark [FILE]
+ *
+ * Without a file the benchmark decompresses generated data, with a file
+ * it decompresses the contents of the file
+ */
+
+#define GZIPF_TEST_DEFLATE_BENCHMARK_NUMBER_OF_RUNS	5
+
+const char *gzipf_test_deflate_benchmark_words[ 16 ] = {
+	"the", "compressed", "data", "of", "a", "member", "is", "stored",
+	"in", "one", "or", "more", "DEFLATE", "blocks", "and", "checksum" };
+
+/* Returns the next pseudo-random value
+ */
+uint32_t gzipf_test_deflate_benchmark_random(
+          uint32_t *random_state )
+{
+	*random_state = ( *random_state * 1103515245UL ) + 12345UL;
+
+	return( ( *random_state >> 8 ) & 0x00ffffffUL );
+}
+
+/* Fills the data with text of words, spaces and line breaks
+ */
+void gzipf_test_deflate_benchmark_fill_text(
+      uint8_t *data,
+      size_t data_size,
+      uint32_t *random_state )
+{
+	const char *word   = NULL;
+	size_t data_offset = 0;
+	uint32_t value     = 0;
+
+	while( data_offset < data_size )
+	{
+		value = gzipf_test_deflate_benchmark_random(
+		         random_state );
+
+		word = gzipf_test_deflate_benchmark_words[ value % 16 ];
+
+		while( ( *word != 0 )
+		    && ( data_offset < data_size ) )
+		{
+			data[ data_offset++ ] = (uint8_t) *word++;
+		}
+		if( data_offset < data_size )
+		{
+			data[ data_offset++ ] = ( ( value >> 4 ) % 12 ) == 0 ? (uint8_t) '\n' : (uint8_t) ' ';
+		}
+	}
+}
+
+/* Fills the data with 4 KiB chunks of text, pseudo-random bytes and runs of a single byte
+ */
+void gzipf_test_deflate_benchmark_fill_mixed(
+      uint8_t *data,
+      size_t data_size,
+      uint32_t *random_state )
+{
+	size_t chunk_size  = 0;
+	size_t data_index  = 0;
+	size_t data_offset = 0;
+	uint32_t value     = 0;
+
+	while( data_offset < data_size )
+	{
+		chunk_size = data_size - data_offset;
+
+		if( chunk_size > 4096 )
+		{
+			chunk_size = 4096;
+		}
+		value = gzipf_test_deflate_benchmark_random(
+		         random_state );
+
+		switch( value % 3 )
+		{
+			case 0:
+				gzipf_test_deflate_benchmark_fill_text(
+				 &( data[ data_offset ] ),
+				 chunk_size,
+				 random_state );
+				break;
+
+			case 1:
+				for( data_index = 0;
+				     data_index < chunk_size;
+				     data_index++ )
+				{
+					data[ data_offset + data_index ] = (uint8_t) gzipf_test_deflate_benchmark_random(
+					                                              random_state );
+				}
+				break;
+
+			default:
+				for( data_index = 0;
+				     data_index < chunk_size;
+				     data_index++ )
+				{
+					data[ data_offset + data_index ] = (uint8_t) ( value >> 8 );
+				}
+				break;
+		}
+		data_offset += chunk_size;
+	}
+}
+
+/* Fills the data with log lines
+ */
+void gzipf_test_deflate_benchmark_fill_log_lines(
+      uint8_t *data,
+      size_t data_size,
+      uint32_t *random_state )
+{
+	char line[ 128 ];
+
+	size_t data_offset = 0;
+	size_t line_index  = 0;
+	uint32_t value     = 0;
+	int line_size      = 0;
+
+	while( data_offset < data_size )
+	{
+		value = gzipf_test_deflate_benchmark_random(
+		         random_state );
+
+		line_size = narrow_string_snprintf(
+		             line,
+		             128,
+		             "2026-01-%02d %02d:%02d:%02d.%03d host-%02d service[%d]: %s request %d completed in %d ms\n",
+		             (int) ( 1 + ( data_offset / 1048576 ) % 28 ),
+		             (int) ( ( data_offset / 65536 ) % 24 ),
+		             (int) ( ( data_offset / 4096 ) % 60 ),
+		             (int) ( ( data_offset / 64 ) % 60 ),
+		             (int) ( value % 1000 ),
+		             (int) ( value % 16 ),
+		             (int) ( 1000 + ( value % 8 ) ),
+		             ( value % 10 ) == 0 ? "WARN" : "INFO",
+		             (int) ( value % 100000 ),
+		             (int) ( ( value >> 12 ) % 500 ) );
+
+		if( line_size < 0 )
+		{
+			line_size = 0;
+		}
+		for( line_index = 0;
+		     ( line_index < (size_t) line_size ) && ( data_offset < data_size );
+		     line_index++ )
+		{
+			data[ data_offset++ ] = (uint8_t) line[ line_index ];
+		}
+	}
+}
+
+/* Reads the contents of a file
+ * Returns 1 if successful or -1 on error
+ */
+int gzipf_test_deflate_benchmark_read_file(
+     const char *filename,
+     uint8_t **data,
+     size_t *data_size )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *safe_data    = NULL;
+	void *reallocation    = NULL;
+	size_t allocated_size = 0;
+	size_t read_count     = 0;
+	size_t safe_data_size = 0;
+
+	file_stream = file_stream_open(
+	               filename,
+	               "rb" );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		if( safe_data_size == allocated_size )
+		{
+			allocated_size += 16 * 1024 * 1024;
+
+			reallocation = memory_reallocate(
+			                safe_data,
+			                allocated_size );
+
+			if( reallocation == NULL )
+			{
+				goto on_error;
+			}
+			safe_data = (uint8_t *) reallocation;
+		}
+		read_count = file_stream_read(
+		              file_stream,
+		              &( safe_data[ safe_data_size ] ),
+		              allocated_size - safe_data_size );
+
+		safe_data_size += read_count;
+	}
+	while( read_count > 0 );
+
+	file_stream_close(
+	 file_stream );
+
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	file_stream_close(
+	 file_stream );
+
+	return( -1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) )
+
+/* Returns the throughput in MB/s of decompressing the data a number of times
+ * or -1.0 on error
+ */
+double gzipf_test_deflate_benchmark_run(
+        const uint8_t *compressed_data,
+        size_t compressed_data_size,
+        const uint8_t *expected_data,
+        uint8_t *uncompressed_data,
+        size_t uncompressed_data_size,
+        int use_zlib )
+{
+	libcerror_error_t *error   = NULL;
+	uLongf zlib_data_size      = 0;
+	clock_t end_time           = 0;
+	clock_t start_time         = 0;
+	double best_time           = -1.0;
+	double run_time            = 0.0;
+	size_t data_size           = 0;
+	int run_index              = 0;
+	int result                 = 0;
+
+	for( run_index = 0;
+	     run_index < GZIPF_TEST_DEFLATE_BENCHMARK_NUMBER_OF_RUNS;
+	     run_index++ )
+	{
+		start_time = clock();
+
+		if( use_zlib == 0 )
+		{
+			data_size = uncompressed_data_size;
+
+			result = libgzipf_deflate_decompress_zlib(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          &data_size,
+			          &error );
+		}
+		else
+		{
+			zlib_data_size = (uLongf) uncompressed_data_size;
+
+			result = uncompress(
+			          (Bytef *) uncompressed_data,
+			          &zlib_data_size,
+			          (const Bytef *) compressed_data,
+			          (uLong) compressed_data_size ) == Z_OK ? 1 : -1;
+
+			data_size = (size_t) zlib_data_size;
+		}
+		end_time = clock();
+
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1.0 );
+		}
+		if( ( data_size != uncompressed_data_size )
+		 || ( memory_compare(
+		       uncompressed_data,
+		       expected_data,
+		       uncompressed_data_size ) != 0 ) )
+		{
+			return( -1.0 );
+		}
+		run_time = (double) ( end_time - start_time ) / (double) CLOCKS_PER_SEC;
+
+		if( ( best_time < 0.0 )
+		 || ( run_time < best_time ) )
+		{
+			best_time = run_time;
+		}
+	}
+	if( best_time <= 0.0 )
+	{
+		best_time = 1.0 / (double) CLOCKS_PER_SEC;
+	}
+	return( (double) uncompressed_data_size / best_time / 1000000.0 );
+}
+
+/* Compresses the data with zlib at level 6 and prints the decompression throughput
+ * Returns 1 if successful or -1 on error
+ */
+int gzipf_test_deflate_benchmark_data(
+     const char *description,
+     const uint8_t *data,
+     size_t data_size )
+{
+	uint8_t *compressed_data    = NULL;
+	uint8_t *uncompressed_data  = NULL;
+	uLongf compressed_data_size = 0;
+	double libgzipf_throughput  = 0.0;
+	double zlib_throughput      = 0.0;
+
+	compressed_data_size = compressBound(
+	                        (uLong) data_size );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * compressed_data_size );
+
+	if( compressed_data == NULL )
+	{
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		goto on_error;
+	}
+	if( compress2(
+	     (Bytef *) compressed_data,
+	     &compressed_data_size,
+	     (const Bytef *) data,
+	     (uLong) data_size,
+	     6 ) != Z_OK )
+	{
+		goto on_error;
+	}
+	libgzipf_throughput = gzipf_test_deflate_benchmark_run(
+	                       compressed_data,
+	                       (size_t) compressed_data_size,
+	                       data,
+	                       uncompressed_data,
+	                       data_size,
+	                       0 );
+
+	zlib_throughput = gzipf_test_deflate_benchmark_run(
+	                   compressed_data,
+	                   (size_t) compressed_data_size,
+	                   data,
+	                   uncompressed_data,
+	                   data_size,
+	                   1 );
+
+	if( ( libgzipf_throughput < 0.0 )
+	 || ( zlib_throughput < 0.0 ) )
+	{
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "  %-20s %10" PRIzd " %10" PRIzd " %10.0f %10.0f\n",
+	 description,
+	 data_size,
+	 (size_t) compressed_data_size,
+	 libgzipf_throughput,
+	 zlib_throughput );
+
+	memory_free(
+	 uncompressed_data );
+
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	fprintf(
+	 stderr,
+	 "Unable to benchmark: %s\n",
+	 description );
+
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) )
+	uint8_t *data         = NULL;
+	size_t data_size      = 0;
+	uint32_t random_state = 1;
+	int result            = 1;
+#endif
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argc )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argv )
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) )
+	fprintf(
+	 stdout,
+	 "libgzipf_deflate_decompress_zlib on a zlib level 6 stream, best of %d runs:\n\n",
+	 GZIPF_TEST_DEFLATE_BENCHMARK_NUMBER_OF_RUNS );
+
+	fprintf(
+	 stdout,
+	 "  %-20s %10s %10s %10s %10s\n",
+	 "data",
+	 "size",
+	 "compressed",
+	 "MB/s",
+	 "zlib MB/s" );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( argc > 1 )
+	{
+		if( gzipf_test_deflate_benchmark_read_file(
+		     argv[ 1 ],
+		     &data,
+		     &data_size ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read file: %s\n",
+			 argv[ 1 ] );
+
+			return( EXIT_FAILURE );
+		}
+		result = gzipf_test_deflate_benchmark_data(
+		          "file",
+		          data,
+		          data_size );
+
+		memory_free(
+		 data );
+
+		return( result == 1 ? EXIT_SUCCESS : EXIT_FAILURE );
+	}
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 22 * 1000 * 1000 );
+
+	if( data == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+	data_size = 16 * 1024 * 1024;
+
+	gzipf_test_deflate_benchmark_fill_text(
+	 data,
+	 data_size,
+	 &random_state );
+
+	if( gzipf_test_deflate_benchmark_data(
+	     "16 MiB text",
+	     data,
+	     data_size ) != 1 )
+	{
+		result = -1;
+	}
+	data_size = 4 * 1000 * 1000;
+
+	gzipf_test_deflate_benchmark_fill_mixed(
+	 data,
+	 data_size,
+	 &random_state );
+
+	if( gzipf_test_deflate_benchmark_data(
+	     "4 MB mixed data",
+	     data,
+	     data_size ) != 1 )
+	{
+		result = -1;
+	}
+	data_size = 22 * 1000 * 1000;
+
+	gzipf_test_deflate_benchmark_fill_log_lines(
+	 data,
+	 data_size,
+	 &random_state );
+
+	if( gzipf_test_deflate_benchmark_data(
+	     "22 MB log lines",
+	     data,
+	     data_size ) != 1 )
+	{
+		result = -1;
+	}
+	memory_free(
+	 data );
+
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+#else
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argc )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argv )
+#endif
+	fprintf(
+	 stdout,
+	 "Benchmark requires zlib and the internal library functions.\n" );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) ) */
+
+	return( EXIT_SUCCESS );
+}
+
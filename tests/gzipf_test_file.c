@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <narrow_string.h>
 #include <system_string.h>
@@ -43,6 +44,7 @@
 #include "gzipf_test_libgzipf.h"
 #include "gzipf_test_macros.h"
 #include "gzipf_test_memory.h"
+#include "gzipf_test_unused.h"
 
 #include "../libgzipf/libgzipf_file.h"
 
@@ -430,35 +432,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libgzipf_file_open function
+/* Tests the libgzipf_file_set_decoder function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_open(
-     const system_character_t *source )
+int gzipf_test_file_set_decoder(
+     void )
 {
-	char narrow_source[ 256 ];
-
 	libcerror_error_t *error = NULL;
 	libgzipf_file_t *file    = NULL;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = gzipf_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libgzipf_file_initialize(
 	          &file,
 	          &error );
@@ -476,12 +461,11 @@ int gzipf_test_file_open(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libgzipf_file_open(
+	result = libgzipf_file_set_decoder(
 	          file,
-	          narrow_source,
-	          LIBGZIPF_OPEN_READ,
+	          LIBGZIPF_DECODER_NATIVE,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -493,30 +477,25 @@ int gzipf_test_file_open(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libgzipf_file_open(
-	          NULL,
-	          narrow_source,
-	          LIBGZIPF_OPEN_READ,
+	result = libgzipf_file_set_decoder(
+	          file,
+	          LIBGZIPF_DECODER_DEFAULT,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libgzipf_file_open(
-	          file,
+	/* Test error cases
+	 */
+	result = libgzipf_file_set_decoder(
 	          NULL,
-	          LIBGZIPF_OPEN_READ,
+	          LIBGZIPF_DECODER_NATIVE,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -531,9 +510,8 @@ int gzipf_test_file_open(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_file_open(
+	result = libgzipf_file_set_decoder(
 	          file,
-	          narrow_source,
 	          -1,
 	          &error );
 
@@ -549,26 +527,6 @@ int gzipf_test_file_open(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libgzipf_file_open(
-	          file,
-	          narrow_source,
-	          LIBGZIPF_OPEN_READ,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
 	/* Clean up
 	 */
 	result = libgzipf_file_free(
@@ -605,37 +563,18 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libgzipf_file_open_wide function
+/* Tests the libgzipf_file_set_checksum_policy function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_open_wide(
-     const system_character_t *source )
+int gzipf_test_file_set_checksum_policy(
+     void )
 {
-	wchar_t wide_source[ 256 ];
-
 	libcerror_error_t *error = NULL;
 	libgzipf_file_t *file    = NULL;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = gzipf_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libgzipf_file_initialize(
 	          &file,
 	          &error );
@@ -653,12 +592,11 @@ int gzipf_test_file_open_wide(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libgzipf_file_open_wide(
+	result = libgzipf_file_set_checksum_policy(
 	          file,
-	          wide_source,
-	          LIBGZIPF_OPEN_READ,
+	          LIBGZIPF_CHECKSUM_POLICY_OFF,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -670,30 +608,25 @@ int gzipf_test_file_open_wide(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libgzipf_file_open_wide(
-	          NULL,
-	          wide_source,
-	          LIBGZIPF_OPEN_READ,
+	result = libgzipf_file_set_checksum_policy(
+	          file,
+	          LIBGZIPF_CHECKSUM_POLICY_FULL,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libgzipf_file_open_wide(
-	          file,
+	/* Test error cases
+	 */
+	result = libgzipf_file_set_checksum_policy(
 	          NULL,
-	          LIBGZIPF_OPEN_READ,
+	          LIBGZIPF_CHECKSUM_POLICY_DEFERRED,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -708,9 +641,8 @@ int gzipf_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_file_open_wide(
+	result = libgzipf_file_set_checksum_policy(
 	          file,
-	          wide_source,
 	          -1,
 	          &error );
 
@@ -726,26 +658,6 @@ int gzipf_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libgzipf_file_open_wide(
-	          file,
-	          wide_source,
-	          LIBGZIPF_OPEN_READ,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
 	/* Clean up
 	 */
 	result = libgzipf_file_free(
@@ -782,64 +694,18 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libgzipf_file_open_file_io_handle function
+/* Tests the libgzipf_file_set_checkpoint_spacing function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_open_file_io_handle(
-     const system_character_t *source )
+int gzipf_test_file_set_checkpoint_spacing(
+     void )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libgzipf_file_t *file            = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	libcerror_error_t *error = NULL;
+	libgzipf_file_t *file    = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#endif
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libgzipf_file_initialize(
 	          &file,
 	          &error );
@@ -857,12 +723,12 @@ int gzipf_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libgzipf_file_open_file_io_handle(
+	result = libgzipf_file_set_checkpoint_spacing(
 	          file,
-	          file_io_handle,
-	          LIBGZIPF_OPEN_READ,
+	          1024 * 1024,
+	          8 * 1024 * 1024,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -874,30 +740,27 @@ int gzipf_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libgzipf_file_open_file_io_handle(
-	          NULL,
-	          file_io_handle,
-	          LIBGZIPF_OPEN_READ,
+	result = libgzipf_file_set_checkpoint_spacing(
+	          file,
+	          4 * 1024 * 1024,
+	          16 * 1024 * 1024,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libgzipf_file_open_file_io_handle(
-	          file,
+	/* Test error cases
+	 */
+	result = libgzipf_file_set_checkpoint_spacing(
 	          NULL,
-	          LIBGZIPF_OPEN_READ,
+	          4 * 1024 * 1024,
+	          16 * 1024 * 1024,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -912,10 +775,10 @@ int gzipf_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libgzipf_file_open_file_io_handle(
+	result = libgzipf_file_set_checkpoint_spacing(
 	          file,
-	          file_io_handle,
-	          -1,
+	          0,
+	          16 * 1024 * 1024,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -930,12 +793,10 @@ int gzipf_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libgzipf_file_open_file_io_handle(
+	result = libgzipf_file_set_checkpoint_spacing(
 	          file,
-	          file_io_handle,
-	          LIBGZIPF_OPEN_READ,
+	          4 * 1024 * 1024,
+	          0,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -969,23 +830,6 @@ int gzipf_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
-
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -1000,28 +844,90 @@ on_error:
 		 &file,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libgzipf_file_close function
+/* Tests the libgzipf_file_set_index_mode function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_close(
+int gzipf_test_file_set_index_mode(
      void )
 {
 	libcerror_error_t *error = NULL;
+	libgzipf_file_t *file    = NULL;
 	int result               = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libgzipf_file_close(
-	          NULL,
+	result = libgzipf_file_initialize(
+	          &file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libgzipf_file_set_index_mode(
+	          file,
+	          LIBGZIPF_INDEX_MODE_BACKGROUND,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_file_set_index_mode(
+	          file,
+	          LIBGZIPF_INDEX_MODE_ON_DEMAND,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_file_set_index_mode(
+	          NULL,
+	          LIBGZIPF_INDEX_MODE_ON_DEMAND,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_set_index_mode(
+	          file,
+	          -1,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1036,6 +942,25 @@ int gzipf_test_file_close(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libgzipf_file_free(
+	          &file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1044,21 +969,44 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libgzipf_file_open and libgzipf_file_close functions
+/* Tests the libgzipf_file_open function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_open_close(
+int gzipf_test_file_open(
      const system_character_t *source )
 {
+	char narrow_source[ 256 ];
+
 	libcerror_error_t *error = NULL;
 	libgzipf_file_t *file    = NULL;
 	int result               = 0;
 
 	/* Initialize test
 	 */
+	result = gzipf_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libgzipf_file_initialize(
 	          &file,
 	          &error );
@@ -1076,21 +1024,13 @@ int gzipf_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libgzipf_file_open_wide(
-	          file,
-	          source,
-	          LIBGZIPF_OPEN_READ,
-	          &error );
-#else
 	result = libgzipf_file_open(
 	          file,
-	          source,
+	          narrow_source,
 	          LIBGZIPF_OPEN_READ,
 	          &error );
-#endif
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1101,57 +1041,82 @@ int gzipf_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libgzipf_file_close(
-	          file,
+	/* Test error cases
+	 */
+	result = libgzipf_file_open(
+	          NULL,
+	          narrow_source,
+	          LIBGZIPF_OPEN_READ,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	GZIPF_TEST_ASSERT_IS_NULL(
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libgzipf_file_open_wide(
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_open(
 	          file,
-	          source,
+	          NULL,
 	          LIBGZIPF_OPEN_READ,
 	          &error );
-#else
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	result = libgzipf_file_open(
 	          file,
-	          source,
-	          LIBGZIPF_OPEN_READ,
+	          narrow_source,
+	          -1,
 	          &error );
-#endif
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	GZIPF_TEST_ASSERT_IS_NULL(
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libgzipf_file_close(
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libgzipf_file_open(
 	          file,
+	          narrow_source,
+	          LIBGZIPF_OPEN_READ,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	GZIPF_TEST_ASSERT_IS_NULL(
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libgzipf_file_free(
@@ -1188,19 +1153,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libgzipf_file_signal_abort function
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libgzipf_file_open_wide function
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_signal_abort(
-     libgzipf_file_t *file )
+int gzipf_test_file_open_wide(
+     const system_character_t *source )
 {
+	wchar_t wide_source[ 256 ];
+
 	libcerror_error_t *error = NULL;
+	libgzipf_file_t *file    = NULL;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libgzipf_file_signal_abort(
-	          file,
+	result = gzipf_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1212,63 +1184,29 @@ int gzipf_test_file_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libgzipf_file_signal_abort(
-	          NULL,
+	result = libgzipf_file_initialize(
+	          &file,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
-
-/* Tests the libgzipf_internal_file_read_buffer_from_file_io_handle function
- * Returns 1 if successful or 0 if not
- */
-int gzipf_test_internal_file_read_buffer_from_file_io_handle(
-     libgzipf_file_t *file )
-{
-	uint8_t buffer[ GZIPF_TEST_FILE_READ_BUFFER_SIZE ];
-
-	libcerror_error_t *error = NULL;
-	time_t timestamp         = 0;
-	size64_t remaining_size  = 0;
-	size64_t size            = 0;
-	size_t read_size         = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
-	off64_t read_offset      = 0;
-	int number_of_tests      = 1024;
-	int random_number        = 0;
-	int result               = 0;
-	int test_number          = 0;
-
-	/* Determine size
+	/* Test open
 	 */
-	result = libgzipf_file_get_uncompressed_data_size(
+	result = libgzipf_file_open_wide(
 	          file,
-	          &size,
+	          wide_source,
+	          LIBGZIPF_OPEN_READ,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1280,225 +1218,2199 @@ int gzipf_test_internal_file_read_buffer_from_file_io_handle(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
+	result = libgzipf_file_open_wide(
+	          NULL,
+	          wide_source,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_open_wide(
+	          file,
+	          NULL,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_open_wide(
+	          file,
+	          wide_source,
+	          -1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libgzipf_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_file_free(
+	          &file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libgzipf_file_open_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_open_file_io_handle(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libgzipf_file_t *file            = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_file_initialize(
+	          &file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libgzipf_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_file_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_open_file_io_handle(
+	          file,
+	          NULL,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libgzipf_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_file_free(
+	          &file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libgzipf_file_close(
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_open and libgzipf_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libgzipf_file_t *file    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libgzipf_file_initialize(
+	          &file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libgzipf_file_open_wide(
+	          file,
+	          source,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+#else
+	result = libgzipf_file_open(
+	          file,
+	          source,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+#endif
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_file_close(
+	          file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libgzipf_file_open_wide(
+	          file,
+	          source,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+#else
+	result = libgzipf_file_open(
+	          file,
+	          source,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
+#endif
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_file_close(
+	          file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libgzipf_file_free(
+	          &file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_signal_abort(
+     libgzipf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libgzipf_file_signal_abort(
+	          file,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_file_signal_abort(
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+/* Tests the libgzipf_internal_file_read_buffer_from_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_internal_file_read_buffer_from_file_io_handle(
+     libgzipf_file_t *file )
+{
+	uint8_t buffer[ GZIPF_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	time_t timestamp         = 0;
+	size64_t remaining_size  = 0;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	off64_t read_offset      = 0;
+	int number_of_tests      = 1024;
+	int random_number        = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Determine size
+	 */
+	result = libgzipf_file_get_uncompressed_data_size(
+	          file,
+	          &size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+
+	if( size < GZIPF_TEST_FILE_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
+	              (libgzipf_internal_file_t *) file,
+	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size > 8 )
+	{
+		/* Set offset to size - 8
+		 */
+		offset = libgzipf_file_seek_offset(
+		          file,
+		          -8,
+		          SEEK_END,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) size - 8 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer on size boundary
+		 */
+		read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
+		              (libgzipf_internal_file_t *) file,
+		              ( (libgzipf_internal_file_t *) file )->file_io_handle,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond size boundary
+		 */
+		read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
+		              (libgzipf_internal_file_t *) file,
+		              ( (libgzipf_internal_file_t *) file )->file_io_handle,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Stress test read buffer
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remaining_size = size;
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		random_number = rand();
+
+		GZIPF_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		read_size = (size_t) random_number % GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+
+#if defined( GZIPF_TEST_FILE_VERBOSE )
+		fprintf(
+		 stdout,
+		 "libgzipf_file_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+		 read_offset,
+		 read_offset,
+		 read_size );
+#endif
+		read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
+		              (libgzipf_internal_file_t *) file,
+		              ( (libgzipf_internal_file_t *) file )->file_io_handle,
+		              buffer,
+		              read_size,
+		              &error );
+
+		if( read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_offset += read_count;
+
+		result = libgzipf_file_get_offset(
+		          file,
+		          &offset,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 read_offset );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		remaining_size -= read_count;
+
+		if( remaining_size == 0 )
+		{
+			offset = libgzipf_file_seek_offset(
+			          file,
+			          0,
+			          SEEK_SET,
+			          &error );
+
+			GZIPF_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 offset,
+			 (int64_t) 0 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			read_offset = 0;
+
+			remaining_size = size;
+		}
+	}
+	/* Reset offset to 0
+	 */
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
+	              NULL,
+	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
+	              (libgzipf_internal_file_t *) file,
+	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
+	              NULL,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
+	              (libgzipf_internal_file_t *) file,
+	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+/* Tests the libgzipf_file_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_read_buffer(
+     libgzipf_file_t *file )
+{
+	uint8_t buffer[ GZIPF_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	time_t timestamp         = 0;
+	size64_t remaining_size  = 0;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	off64_t read_offset      = 0;
+	int number_of_tests      = 1024;
+	int random_number        = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Determine size
+	 */
+	result = libgzipf_file_get_uncompressed_data_size(
+	          file,
+	          &size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+
+	if( size < GZIPF_TEST_FILE_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libgzipf_file_read_buffer(
+	              file,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size > 8 )
+	{
+		/* Set offset to size - 8
+		 */
+		offset = libgzipf_file_seek_offset(
+		          file,
+		          -8,
+		          SEEK_END,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) size - 8 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer on size boundary
+		 */
+		read_count = libgzipf_file_read_buffer(
+		              file,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond size boundary
+		 */
+		read_count = libgzipf_file_read_buffer(
+		              file,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Stress test read buffer
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remaining_size = size;
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		random_number = rand();
+
+		GZIPF_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		read_size = (size_t) random_number % GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+
+#if defined( GZIPF_TEST_FILE_VERBOSE )
+		fprintf(
+		 stdout,
+		 "libgzipf_file_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+		 read_offset,
+		 read_offset,
+		 read_size );
+#endif
+		read_count = libgzipf_file_read_buffer(
+		              file,
+		              buffer,
+		              read_size,
+		              &error );
+
+		if( read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_offset += read_count;
+
+		result = libgzipf_file_get_offset(
+		          file,
+		          &offset,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 read_offset );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		remaining_size -= read_count;
+
+		if( remaining_size == 0 )
+		{
+			offset = libgzipf_file_seek_offset(
+			          file,
+			          0,
+			          SEEK_SET,
+			          &error );
+
+			GZIPF_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 offset,
+			 (int64_t) 0 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			read_offset = 0;
+
+			remaining_size = size;
+		}
+	}
+	/* Reset offset to 0
+	 */
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libgzipf_file_read_buffer(
+	              NULL,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libgzipf_file_read_buffer(
+	              file,
+	              NULL,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libgzipf_file_read_buffer(
+	              file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GZIPF_TEST_RWLOCK )
+
+	/* Test libgzipf_file_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	read_count = libgzipf_file_read_buffer(
+	              file,
+	              buffer,
+	              GZIPF_TEST_PARTITION_READ_BUFFER_SIZE,
+	              &error );
+
+	if( gzipf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		GZIPF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libgzipf_file_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	gzipf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	read_count = libgzipf_file_read_buffer(
+	              file,
+	              buffer,
+	              GZIPF_TEST_PARTITION_READ_BUFFER_SIZE,
+	              &error );
+
+	if( gzipf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		gzipf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		GZIPF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GZIPF_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_read_buffer_at_offset(
+     libgzipf_file_t *file )
+{
+	uint8_t buffer[ GZIPF_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	time_t timestamp         = 0;
+	size64_t remaining_size  = 0;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	off64_t read_offset      = 0;
+	int number_of_tests      = 1024;
+	int random_number        = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Determine size
+	 */
+	result = libgzipf_file_get_uncompressed_data_size(
+	          file,
+	          &size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+
+	if( size < GZIPF_TEST_FILE_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libgzipf_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size > 8 )
+	{
+		/* Read buffer on size boundary
+		 */
+		read_count = libgzipf_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              size - 8,
+		              &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond size boundary
+		 */
+		read_count = libgzipf_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              size + 8,
+		              &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Stress test read buffer
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		random_number = rand();
+
+		GZIPF_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		if( size > 0 )
+		{
+			read_offset = (off64_t) random_number % size;
+		}
+		read_size = (size_t) random_number % GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+
+#if defined( GZIPF_TEST_FILE_VERBOSE )
+		fprintf(
+		 stdout,
+		 "libgzipf_file_read_buffer_at_offset: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+		 read_offset,
+		 read_offset,
+		 read_size );
+#endif
+		read_count = libgzipf_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              &error );
+
+		remaining_size = size - read_offset;
+
+		if( read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_offset += read_count;
+
+		result = libgzipf_file_get_offset(
+		          file,
+		          &offset,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 read_offset );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	read_count = libgzipf_file_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libgzipf_file_read_buffer_at_offset(
+	              file,
+	              NULL,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libgzipf_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libgzipf_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              -1,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GZIPF_TEST_RWLOCK )
+
+	/* Test libgzipf_file_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	read_count = libgzipf_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	if( gzipf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		GZIPF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libgzipf_file_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	gzipf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	read_count = libgzipf_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	if( gzipf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		gzipf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		GZIPF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GZIPF_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_seek_offset(
+     libgzipf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	size = (size64_t) offset;
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          1024,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          -512,
+	          SEEK_CUR,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          (off64_t) ( size + 512 ),
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( size + 512 ) );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Reset offset to 0
 	 */
 	offset = libgzipf_file_seek_offset(
 	          file,
-	          0,
-	          SEEK_SET,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libgzipf_file_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          -1,
+	          SEEK_CUR,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          (off64_t) ( -1 * ( size + 1 ) ),
+	          SEEK_END,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) 0 );
+	 (int64_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GZIPF_TEST_RWLOCK )
+
+	/* Test libgzipf_file_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( gzipf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		GZIPF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
+
+		GZIPF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libgzipf_file_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	gzipf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( gzipf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		gzipf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		GZIPF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
+
+		GZIPF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GZIPF_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_get_offset(
+     libgzipf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libgzipf_file_get_offset(
+	          file,
+	          &offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
+	result = libgzipf_file_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_get_offset(
+	          file,
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_wait_for_index function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_wait_for_index(
+     libgzipf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
 	/* Test regular cases
 	 */
-	read_size = GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+	result = libgzipf_file_wait_for_index(
+	          file,
+	          0,
+	          &error );
 
-	if( size < GZIPF_TEST_FILE_READ_BUFFER_SIZE )
+	GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_file_wait_for_index(
+	          file,
+	          -1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_file_wait_for_index(
+	          NULL,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_file_wait_for_index(
+	          file,
+	          -2,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		read_size = (size_t) size;
+		libcerror_error_free(
+		 &error );
 	}
-	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
-	              (libgzipf_internal_file_t *) file,
-	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              &error );
+	return( 0 );
+}
+
+/* Tests the libgzipf_file_get_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_get_uncompressed_data_size(
+     libgzipf_file_t *file )
+{
+	libcerror_error_t *error        = NULL;
+	size64_t uncompressed_data_size = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libgzipf_file_get_uncompressed_data_size(
+	          file,
+	          &uncompressed_data_size,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) read_size );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( size > 8 )
-	{
-		/* Set offset to size - 8
-		 */
-		offset = libgzipf_file_seek_offset(
-		          file,
-		          -8,
-		          SEEK_END,
-		          &error );
+	/* Test error cases
+	 */
+	result = libgzipf_file_get_uncompressed_data_size(
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
 
-		GZIPF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 (int64_t) size - 8 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		/* Read buffer on size boundary
-		 */
-		read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
-		              (libgzipf_internal_file_t *) file,
-		              ( (libgzipf_internal_file_t *) file )->file_io_handle,
-		              buffer,
-		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-		              &error );
+	libcerror_error_free(
+	 &error );
 
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 8 );
+	result = libgzipf_file_get_uncompressed_data_size(
+	          file,
+	          NULL,
+	          &error );
 
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		/* Read buffer beyond size boundary
-		 */
-		read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
-		              (libgzipf_internal_file_t *) file,
-		              ( (libgzipf_internal_file_t *) file )->file_io_handle,
-		              buffer,
-		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-		              &error );
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 0 );
+	libcerror_error_free(
+	 &error );
 
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
 	}
-	/* Stress test read buffer
-	 */
-	timestamp = time(
-	             NULL );
+	return( 0 );
+}
 
-	srand(
-	 (unsigned int) timestamp );
+/* Tests the libgzipf_file_get_number_of_members function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_get_number_of_members(
+     libgzipf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_members    = 0;
+	int result               = 0;
 
-	offset = libgzipf_file_seek_offset(
+	/* Test regular cases
+	 */
+	result = libgzipf_file_get_number_of_members(
 	          file,
-	          0,
-	          SEEK_SET,
+	          &number_of_members,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	remaining_size = size;
-
-	for( test_number = 0;
-	     test_number < number_of_tests;
-	     test_number++ )
-	{
-		random_number = rand();
-
-		GZIPF_TEST_ASSERT_GREATER_THAN_INT(
-		 "random_number",
-		 random_number,
-		 -1 );
+	/* Test error cases
+	 */
+	result = libgzipf_file_get_number_of_members(
+	          NULL,
+	          &number_of_members,
+	          &error );
 
-		read_size = (size_t) random_number % GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#if defined( GZIPF_TEST_FILE_VERBOSE )
-		fprintf(
-		 stdout,
-		 "libgzipf_file_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-		 read_offset,
-		 read_offset,
-		 read_size );
-#endif
-		read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
-		              (libgzipf_internal_file_t *) file,
-		              ( (libgzipf_internal_file_t *) file )->file_io_handle,
-		              buffer,
-		              read_size,
-		              &error );
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		if( read_size > remaining_size )
-		{
-			read_size = (size_t) remaining_size;
-		}
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) read_size );
+	libcerror_error_free(
+	 &error );
 
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	result = libgzipf_file_get_number_of_members(
+	          file,
+	          NULL,
+	          &error );
 
-		read_offset += read_count;
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		result = libgzipf_file_get_offset(
-		          file,
-		          &offset,
-		          &error );
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		GZIPF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	libcerror_error_free(
+	 &error );
 
-		GZIPF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 read_offset );
+	return( 1 );
 
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-		remaining_size -= read_count;
+/* Tests the libgzipf_file_get_member_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_get_member_by_index(
+     libgzipf_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	libgzipf_member_t *member = NULL;
+	int result                = 0;
 
-		if( remaining_size == 0 )
-		{
-			offset = libgzipf_file_seek_offset(
-			          file,
-			          0,
-			          SEEK_SET,
-			          &error );
+	/* Test regular cases
+	 */
+	result = libgzipf_file_get_member_by_index(
+	          file,
+	          0,
+	          &member,
+	          &error );
 
-			GZIPF_TEST_ASSERT_EQUAL_INT64(
-			 "offset",
-			 offset,
-			 (int64_t) 0 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			GZIPF_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-			read_offset = 0;
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "member",
+	 member );
 
-			remaining_size = size;
-		}
-	}
-	/* Reset offset to 0
-	 */
-	offset = libgzipf_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_SET,
+	result = libgzipf_member_free(
+	          &member,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1506,17 +3418,20 @@ int gzipf_test_internal_file_read_buffer_from_file_io_handle(
 
 	/* Test error cases
 	 */
-	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
-	              NULL,
-	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              &error );
+	result = libgzipf_file_get_member_by_index(
+	          NULL,
+	          0,
+	          &member,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "member",
+	 member );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1525,17 +3440,20 @@ int gzipf_test_internal_file_read_buffer_from_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
-	              (libgzipf_internal_file_t *) file,
-	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
-	              NULL,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              &error );
+	result = libgzipf_file_get_member_by_index(
+	          file,
+	          -1,
+	          &member,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "member",
+	 member );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1544,17 +3462,20 @@ int gzipf_test_internal_file_read_buffer_from_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libgzipf_internal_file_read_buffer_from_file_io_handle(
-	              (libgzipf_internal_file_t *) file,
-	              ( (libgzipf_internal_file_t *) file )->file_io_handle,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              &error );
+	result = libgzipf_file_get_member_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "member",
+	 member );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1571,37 +3492,306 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( member != NULL )
+	{
+		libgzipf_member_free(
+		 &member,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+/* Reads data of a file at specific offsets and compares it with the expected data
+ * Returns 1 if the data matches, 0 if not or -1 on error
+ */
+int gzipf_test_file_compare_data_at_offsets(
+     libgzipf_file_t *file,
+     const uint8_t *expected_data,
+     size_t expected_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ GZIPF_TEST_FILE_READ_BUFFER_SIZE ];
+	off64_t offsets[ 5 ];
 
-/* Tests the libgzipf_file_read_buffer function
- * Returns 1 if successful or 0 if not
+	size_t read_size   = 0;
+	ssize_t read_count = 0;
+	int offset_index   = 0;
+
+	offsets[ 0 ] = 0;
+	offsets[ 1 ] = (off64_t) ( expected_data_size / 3 ) + 1;
+	offsets[ 2 ] = (off64_t) ( expected_data_size / 2 );
+	offsets[ 3 ] = (off64_t) expected_data_size - ( GZIPF_TEST_FILE_READ_BUFFER_SIZE + 3 );
+	offsets[ 4 ] = (off64_t) expected_data_size - 1;
+
+	for( offset_index = 0;
+	     offset_index < 5;
+	     offset_index++ )
+	{
+		if( ( offsets[ offset_index ] < 0 )
+		 || ( (size_t) offsets[ offset_index ] >= expected_data_size ) )
+		{
+			continue;
+		}
+		read_size = expected_data_size - (size_t) offsets[ offset_index ];
+
+		if( read_size > GZIPF_TEST_FILE_READ_BUFFER_SIZE )
+		{
+			read_size = GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+		}
+		read_count = libgzipf_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              offsets[ offset_index ],
+		              error );
+
+		if( read_count == -1 )
+		{
+			return( -1 );
+		}
+		if( (size_t) read_count != read_size )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     buffer,
+		     &( expected_data[ offsets[ offset_index ] ] ),
+		     read_size ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads all the data of a file and compares it with the expected data
+ * Returns 1 if the data matches, 0 if not or -1 on error
  */
-int gzipf_test_file_read_buffer(
-     libgzipf_file_t *file )
+int gzipf_test_file_compare_data(
+     libgzipf_file_t *file,
+     const uint8_t *expected_data,
+     size_t expected_data_size,
+     libcerror_error_t **error )
 {
 	uint8_t buffer[ GZIPF_TEST_FILE_READ_BUFFER_SIZE ];
 
-	libcerror_error_t *error = NULL;
-	time_t timestamp         = 0;
-	size64_t remaining_size  = 0;
-	size64_t size            = 0;
-	size_t read_size         = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
-	off64_t read_offset      = 0;
-	int number_of_tests      = 1024;
-	int random_number        = 0;
-	int result               = 0;
-	int test_number          = 0;
+	size_t data_offset = 0;
+	ssize_t read_count = 0;
+	off64_t offset     = 0;
+
+	offset = libgzipf_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          error );
+
+	if( offset != 0 )
+	{
+		return( -1 );
+	}
+	do
+	{
+		read_count = libgzipf_file_read_buffer(
+		              file,
+		              buffer,
+		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+		              error );
+
+		if( read_count == -1 )
+		{
+			return( -1 );
+		}
+		if( (size_t) read_count > ( expected_data_size - data_offset ) )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     buffer,
+		     &( expected_data[ data_offset ] ),
+		     (size_t) read_count ) != 0 )
+		{
+			return( 0 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	while( read_count > 0 );
+
+	if( data_offset != expected_data_size )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Opens and closes a file using data and index data in memory
+ * Returns 1 if successful or -1 on error
+ */
+int gzipf_test_file_open_close_with_index_data(
+     uint8_t *data,
+     size_t data_size,
+     uint8_t *index_data,
+     size_t index_data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libgzipf_file_t *file                  = NULL;
+	int result                             = 0;
+
+	if( gzipf_test_open_file_io_handle(
+	     &file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( gzipf_test_open_file_io_handle(
+	     &index_file_io_handle,
+	     index_data,
+	     index_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libgzipf_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = libgzipf_file_open_file_io_handle_with_index(
+	          file,
+	          file_io_handle,
+	          index_file_io_handle,
+	          LIBGZIPF_OPEN_READ,
+	          error );
+
+	if( result == 1 )
+	{
+		if( libgzipf_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	if( libgzipf_file_free(
+	     &file,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( gzipf_test_close_file_io_handle(
+	     &index_file_io_handle,
+	     NULL ) != 0 )
+	{
+		goto on_error;
+	}
+	if( gzipf_test_close_file_io_handle(
+	     &file_io_handle,
+	     NULL ) != 0 )
+	{
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libgzipf_file_write_index and libgzipf_file_open_with_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_file_write_index(
+     void )
+{
+	const char *gzip_filename              = "gzipf_test_file_index.gz";
+	const char *index_filename             = "gzipf_test_file_index.gz.idx";
+	FILE *file_stream                      = NULL;
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libcerror_error_t *error               = NULL;
+	libgzipf_file_t *file                  = NULL;
+	uint8_t *gzip_data                     = NULL;
+	uint8_t *index_data                    = NULL;
+	uint8_t *modified_data                 = NULL;
+	uint8_t *uncompressed_data             = NULL;
+	size64_t index_data_size               = 0;
+	size64_t uncompressed_data_size        = 0;
+	size_t gzip_data_size                  = 0;
+	size_t write_count                     = 0;
+	ssize_t read_count                     = 0;
+	uint32_t checksum                      = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = gzipf_test_create_gzip_data(
+	          &gzip_data,
+	          &gzip_data_size,
+	          &uncompressed_data,
+	          ( 3 * 1024 * 1024 ) + 4321,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream = file_stream_open(
+	               gzip_filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	write_count = file_stream_write(
+	               file_stream,
+	               gzip_data,
+	               gzip_data_size );
+
+	result = file_stream_close(
+	          file_stream );
+
+	file_stream = NULL;
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "write_count",
+	 write_count,
+	 gzip_data_size );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Determine size
+	/* Test write index with checkpoints within Huffman compressed blocks
 	 */
-	result = libgzipf_file_get_uncompressed_data_size(
-	          file,
-	          &size,
+	result = libgzipf_file_initialize(
+	          &file,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1613,379 +3803,204 @@ int gzipf_test_file_read_buffer(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
-	 */
-	offset = libgzipf_file_seek_offset(
+	result = libgzipf_file_set_checkpoint_spacing(
 	          file,
-	          0,
-	          SEEK_SET,
+	          64 * 1024,
+	          256 * 1024,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	read_size = GZIPF_TEST_FILE_READ_BUFFER_SIZE;
-
-	if( size < GZIPF_TEST_FILE_READ_BUFFER_SIZE )
-	{
-		read_size = (size_t) size;
-	}
-	read_count = libgzipf_file_read_buffer(
-	              file,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              &error );
+	result = libgzipf_file_open(
+	          file,
+	          gzip_filename,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) read_size );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( size > 8 )
-	{
-		/* Set offset to size - 8
-		 */
-		offset = libgzipf_file_seek_offset(
-		          file,
-		          -8,
-		          SEEK_END,
-		          &error );
-
-		GZIPF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 (int64_t) size - 8 );
-
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		/* Read buffer on size boundary
-		 */
-		read_count = libgzipf_file_read_buffer(
-		              file,
-		              buffer,
-		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-		              &error );
-
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 8 );
-
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		/* Read buffer beyond size boundary
-		 */
-		read_count = libgzipf_file_read_buffer(
-		              file,
-		              buffer,
-		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-		              &error );
-
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 0 );
-
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Stress test read buffer
-	 */
-	timestamp = time(
-	             NULL );
-
-	srand(
-	 (unsigned int) timestamp );
-
-	offset = libgzipf_file_seek_offset(
+	result = libgzipf_file_write_index(
 	          file,
-	          0,
-	          SEEK_SET,
+	          index_filename,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	remaining_size = size;
-
-	for( test_number = 0;
-	     test_number < number_of_tests;
-	     test_number++ )
-	{
-		random_number = rand();
-
-		GZIPF_TEST_ASSERT_GREATER_THAN_INT(
-		 "random_number",
-		 random_number,
-		 -1 );
-
-		read_size = (size_t) random_number % GZIPF_TEST_FILE_READ_BUFFER_SIZE;
-
-#if defined( GZIPF_TEST_FILE_VERBOSE )
-		fprintf(
-		 stdout,
-		 "libgzipf_file_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-		 read_offset,
-		 read_offset,
-		 read_size );
-#endif
-		read_count = libgzipf_file_read_buffer(
-		              file,
-		              buffer,
-		              read_size,
-		              &error );
-
-		if( read_size > remaining_size )
-		{
-			read_size = (size_t) remaining_size;
-		}
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) read_size );
-
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		read_offset += read_count;
-
-		result = libgzipf_file_get_offset(
-		          file,
-		          &offset,
-		          &error );
-
-		GZIPF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		GZIPF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 read_offset );
-
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		remaining_size -= read_count;
-
-		if( remaining_size == 0 )
-		{
-			offset = libgzipf_file_seek_offset(
-			          file,
-			          0,
-			          SEEK_SET,
-			          &error );
-
-			GZIPF_TEST_ASSERT_EQUAL_INT64(
-			 "offset",
-			 offset,
-			 (int64_t) 0 );
+	result = gzipf_test_file_compare_data_at_offsets(
+	          file,
+	          uncompressed_data,
+	          ( 3 * 1024 * 1024 ) + 4321,
+	          &error );
 
-			GZIPF_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			read_offset = 0;
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-			remaining_size = size;
-		}
-	}
-	/* Reset offset to 0
-	 */
-	offset = libgzipf_file_seek_offset(
+	result = libgzipf_file_close(
 	          file,
-	          0,
-	          SEEK_SET,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open with index
 	 */
-	read_count = libgzipf_file_read_buffer(
-	              NULL,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              &error );
+	result = libgzipf_file_open_with_index(
+	          file,
+	          gzip_filename,
+	          index_filename,
+	          LIBGZIPF_OPEN_READ,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	read_count = libgzipf_file_read_buffer(
-	              file,
-	              NULL,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              &error );
+	result = libgzipf_file_get_uncompressed_data_size(
+	          file,
+	          &uncompressed_data_size,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
+	 "uncompressed_data_size",
+	 (uint64_t) uncompressed_data_size,
+	 (uint64_t) ( 3 * 1024 * 1024 ) + 4321 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	read_count = libgzipf_file_read_buffer(
-	              file,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              &error );
+	result = gzipf_test_file_compare_data_at_offsets(
+	          file,
+	          uncompressed_data,
+	          ( 3 * 1024 * 1024 ) + 4321,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libgzipf_file_close(
+	          file,
+	          &error );
 
-#if defined( HAVE_GZIPF_TEST_RWLOCK )
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Test libgzipf_file_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	read_count = libgzipf_file_read_buffer(
-	              file,
-	              buffer,
-	              GZIPF_TEST_PARTITION_READ_BUFFER_SIZE,
-	              &error );
+	result = libgzipf_file_free(
+	          &file,
+	          &error );
 
-	if( gzipf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		GZIPF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libgzipf_file_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Read the index data to test modified copies
 	 */
-	gzipf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	result = libbfio_file_initialize(
+	          &index_file_io_handle,
+	          &error );
 
-	read_count = libgzipf_file_read_buffer(
-	              file,
-	              buffer,
-	              GZIPF_TEST_PARTITION_READ_BUFFER_SIZE,
-	              &error );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	if( gzipf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		gzipf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		GZIPF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	result = libbfio_file_set_name(
+	          index_file_io_handle,
+	          index_filename,
+	          narrow_string_length(
+	           index_filename ) + 1,
+	          &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_GZIPF_TEST_RWLOCK ) */
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	return( 1 );
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	result = libbfio_handle_open(
+	          index_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
 
-/* Tests the libgzipf_file_read_buffer_at_offset function
- * Returns 1 if successful or 0 if not
- */
-int gzipf_test_file_read_buffer_at_offset(
-     libgzipf_file_t *file )
-{
-	uint8_t buffer[ GZIPF_TEST_FILE_READ_BUFFER_SIZE ];
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	libcerror_error_t *error = NULL;
-	time_t timestamp         = 0;
-	size64_t remaining_size  = 0;
-	size64_t size            = 0;
-	size_t read_size         = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
-	off64_t read_offset      = 0;
-	int number_of_tests      = 1024;
-	int random_number        = 0;
-	int result               = 0;
-	int test_number          = 0;
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Determine size
-	 */
-	result = libgzipf_file_get_uncompressed_data_size(
-	          file,
-	          &size,
+	result = libbfio_handle_get_size(
+	          index_file_io_handle,
+	          &index_data_size,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -1993,161 +4008,112 @@ int gzipf_test_file_read_buffer_at_offset(
 	 result,
 	 1 );
 
+	GZIPF_TEST_ASSERT_GREATER_THAN_INT(
+	 "index_data_size",
+	 (int) index_data_size,
+	 48 );
+
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	read_size = GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * (size_t) index_data_size );
 
-	if( size < GZIPF_TEST_FILE_READ_BUFFER_SIZE )
-	{
-		read_size = (size_t) size;
-	}
-	read_count = libgzipf_file_read_buffer_at_offset(
-	              file,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_data",
+	 index_data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              index_data,
+	              (size_t) index_data_size,
 	              0,
 	              &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) read_size );
+	 (ssize_t) index_data_size );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( size > 8 )
-	{
-		/* Read buffer on size boundary
-		 */
-		read_count = libgzipf_file_read_buffer_at_offset(
-		              file,
-		              buffer,
-		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-		              size - 8,
-		              &error );
-
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 8 );
-
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		/* Read buffer beyond size boundary
-		 */
-		read_count = libgzipf_file_read_buffer_at_offset(
-		              file,
-		              buffer,
-		              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-		              size + 8,
-		              &error );
-
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 0 );
-
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Stress test read buffer
-	 */
-	timestamp = time(
-	             NULL );
-
-	srand(
-	 (unsigned int) timestamp );
-
-	for( test_number = 0;
-	     test_number < number_of_tests;
-	     test_number++ )
-	{
-		random_number = rand();
-
-		GZIPF_TEST_ASSERT_GREATER_THAN_INT(
-		 "random_number",
-		 random_number,
-		 -1 );
-
-		if( size > 0 )
-		{
-			read_offset = (off64_t) random_number % size;
-		}
-		read_size = (size_t) random_number % GZIPF_TEST_FILE_READ_BUFFER_SIZE;
+	result = libbfio_handle_close(
+	          index_file_io_handle,
+	          &error );
 
-#if defined( GZIPF_TEST_FILE_VERBOSE )
-		fprintf(
-		 stdout,
-		 "libgzipf_file_read_buffer_at_offset: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-		 read_offset,
-		 read_offset,
-		 read_size );
-#endif
-		read_count = libgzipf_file_read_buffer_at_offset(
-		              file,
-		              buffer,
-		              read_size,
-		              read_offset,
-		              &error );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		remaining_size = size - read_offset;
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		if( read_size > remaining_size )
-		{
-			read_size = (size_t) remaining_size;
-		}
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) read_size );
+	result = libbfio_handle_free(
+	          &index_file_io_handle,
+	          &error );
 
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		read_offset += read_count;
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		result = libgzipf_file_get_offset(
-		          file,
-		          &offset,
-		          &error );
+	/* Test open with unmodified index data
+	 */
+	result = gzipf_test_file_open_close_with_index_data(
+	          gzip_data,
+	          gzip_data_size,
+	          index_data,
+	          (size_t) index_data_size,
+	          &error );
 
-		GZIPF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		GZIPF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 read_offset );
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		GZIPF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
+	/* Test open with an index of a file of another size
 	 */
-	read_count = libgzipf_file_read_buffer_at_offset(
-	              NULL,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	modified_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * ( gzip_data_size + 8 ) );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "modified_data",
+	 modified_data );
+
+	memory_copy(
+	 modified_data,
+	 gzip_data,
+	 gzip_data_size );
+
+	memory_set(
+	 &( modified_data[ gzip_data_size ] ),
+	 0,
+	 8 );
+
+	result = gzipf_test_file_open_close_with_index_data(
+	          modified_data,
+	          gzip_data_size + 8,
+	          index_data,
+	          (size_t) index_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2156,17 +4122,22 @@ int gzipf_test_file_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libgzipf_file_read_buffer_at_offset(
-	              file,
-	              NULL,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	/* Test open with an index of a file with a different fingerprint
+	 * the modification time in the member header is changed
+	 */
+	modified_data[ 4 ] ^= 0xff;
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	result = gzipf_test_file_open_close_with_index_data(
+	          modified_data,
+	          gzip_data_size,
+	          index_data,
+	          (size_t) index_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2175,17 +4146,28 @@ int gzipf_test_file_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libgzipf_file_read_buffer_at_offset(
-	              file,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              0,
-	              &error );
+	memory_free(
+	 modified_data );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	modified_data = NULL;
+
+	/* Test open with an index with a corrupted checksum
+	 */
+	index_data[ index_data_size - 1 ] ^= 0xff;
+
+	result = gzipf_test_file_open_close_with_index_data(
+	          gzip_data,
+	          gzip_data_size,
+	          index_data,
+	          (size_t) index_data_size,
+	          &error );
+
+	index_data[ index_data_size - 1 ] ^= 0xff;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2194,17 +4176,32 @@ int gzipf_test_file_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libgzipf_file_read_buffer_at_offset(
-	              file,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              -1,
-	              &error );
+	/* Test open with an index of an unsupported format version
+	 * the checksum is updated so that only the format version is invalid
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( index_data[ 8 ] ),
+	 LIBGZIPF_INDEX_FORMAT_VERSION + 1 );
+
+	checksum = gzipf_test_calculate_crc32(
+	            index_data,
+	            (size_t) index_data_size - 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( index_data[ index_data_size - 4 ] ),
+	 checksum );
+
+	result = gzipf_test_file_open_close_with_index_data(
+	          gzip_data,
+	          gzip_data_size,
+	          index_data,
+	          (size_t) index_data_size,
+	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2213,67 +4210,28 @@ int gzipf_test_file_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_GZIPF_TEST_RWLOCK )
-
-	/* Test libgzipf_file_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Clean up
 	 */
-	gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	read_count = libgzipf_file_read_buffer_at_offset(
-	              file,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	memory_free(
+	 index_data );
 
-	if( gzipf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	index_data = NULL;
 
-		GZIPF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	memory_free(
+	 uncompressed_data );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libgzipf_file_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	gzipf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	uncompressed_data = NULL;
 
-	read_count = libgzipf_file_read_buffer_at_offset(
-	              file,
-	              buffer,
-	              GZIPF_TEST_FILE_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	memory_free(
+	 gzip_data );
 
-	if( gzipf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		gzipf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	gzip_data = NULL;
 
-		GZIPF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	remove(
+	 index_filename );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_GZIPF_TEST_RWLOCK ) */
+	remove(
+	 gzip_filename );
 
 	return( 1 );
 
@@ -2283,257 +4241,507 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( modified_data != NULL )
+	{
+		memory_free(
+		 modified_data );
+	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( gzip_data != NULL )
+	{
+		memory_free(
+		 gzip_data );
+	}
+	remove(
+	 index_filename );
+
+	remove(
+	 gzip_filename );
+
 	return( 0 );
 }
 
-/* Tests the libgzipf_file_seek_offset function
+/* The index progress of a file
+ */
+typedef struct gzipf_test_file_index_progress gzipf_test_file_index_progress_t;
+
+struct gzipf_test_file_index_progress
+{
+	/* The number of times the progress callback was called
+	 */
+	int number_of_calls;
+
+	/* The indexed uncompressed size of the last call
+	 */
+	size64_t indexed_uncompressed_size;
+
+	/* The value to indicate the last call reported completion
+	 */
+	uint8_t is_complete;
+
+	/* The value to indicate the indexed uncompressed size decreased
+	 */
+	uint8_t has_decreased;
+};
+
+/* The index progress callback
+ */
+void gzipf_test_file_index_progress_callback(
+      size64_t indexed_compressed_size GZIPF_TEST_ATTRIBUTE_UNUSED,
+      size64_t indexed_uncompressed_size,
+      uint8_t is_complete,
+      void *user_data )
+{
+	gzipf_test_file_index_progress_t *index_progress = NULL;
+
+	GZIPF_TEST_UNREFERENCED_PARAMETER( indexed_compressed_size )
+
+	index_progress = (gzipf_test_file_index_progress_t *) user_data;
+
+	if( indexed_uncompressed_size < index_progress->indexed_uncompressed_size )
+	{
+		index_progress->has_decreased = 1;
+	}
+	index_progress->number_of_calls          += 1;
+	index_progress->indexed_uncompressed_size = indexed_uncompressed_size;
+	index_progress->is_complete               = is_complete;
+}
+
+/* Tests reading a file in the background index mode
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_seek_offset(
-     libgzipf_file_t *file )
+int gzipf_test_file_index_mode_background(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	off64_t offset           = 0;
+	gzipf_test_file_index_progress_t index_progress;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libgzipf_file_t *file            = NULL;
+	uint8_t *gzip_data               = NULL;
+	uint8_t *uncompressed_data       = NULL;
+	size_t gzip_data_size            = 0;
+	size_t uncompressed_data_size    = ( 3 * 1024 * 1024 ) + 4321;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	index_progress.number_of_calls           = 0;
+	index_progress.indexed_uncompressed_size = 0;
+	index_progress.is_complete               = 0;
+	index_progress.has_decreased             = 0;
+
+	result = gzipf_test_create_gzip_data(
+	          &gzip_data,
+	          &gzip_data_size,
+	          &uncompressed_data,
+	          uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzipf_test_open_file_io_handle(
+	          &file_io_handle,
+	          gzip_data,
+	          gzip_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	offset = libgzipf_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_END,
+	result = libgzipf_file_initialize(
+	          &file,
 	          &error );
 
-	GZIPF_TEST_ASSERT_NOT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	size = (size64_t) offset;
-
-	offset = libgzipf_file_seek_offset(
+	/* A small checkpoint spacing makes the index builder index the file in many parts
+	 */
+	result = libgzipf_file_set_checkpoint_spacing(
 	          file,
-	          1024,
-	          SEEK_SET,
+	          64 * 1024,
+	          256 * 1024,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 1024 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libgzipf_file_seek_offset(
+	result = libgzipf_file_set_index_mode(
 	          file,
-	          -512,
-	          SEEK_CUR,
+	          LIBGZIPF_INDEX_MODE_BACKGROUND,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 512 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libgzipf_file_seek_offset(
+	result = libgzipf_file_set_index_progress_callback(
 	          file,
-	          (off64_t) ( size + 512 ),
-	          SEEK_SET,
+	          &gzipf_test_file_index_progress_callback,
+	          (void *) &index_progress,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) ( size + 512 ) );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
-	 */
-	offset = libgzipf_file_seek_offset(
+	result = libgzipf_file_open_file_io_handle(
 	          file,
-	          0,
-	          SEEK_SET,
+	          file_io_handle,
+	          LIBGZIPF_OPEN_READ,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test reading the start, middle and end while the file is being indexed
 	 */
-	offset = libgzipf_file_seek_offset(
-	          NULL,
-	          0,
-	          SEEK_SET,
+	result = gzipf_test_file_compare_data_at_offsets(
+	          file,
+	          uncompressed_data,
+	          uncompressed_data_size,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	offset = libgzipf_file_seek_offset(
+	result = libgzipf_file_wait_for_index(
 	          file,
 	          -1,
-	          SEEK_SET,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	GZIPF_TEST_ASSERT_GREATER_THAN_INT(
+	 "index_progress.number_of_calls",
+	 index_progress.number_of_calls,
+	 0 );
 
-	offset = libgzipf_file_seek_offset(
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "index_progress.is_complete",
+	 index_progress.is_complete,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
+	 "index_progress.indexed_uncompressed_size",
+	 (uint64_t) index_progress.indexed_uncompressed_size,
+	 (uint64_t) uncompressed_data_size );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "index_progress.has_decreased",
+	 index_progress.has_decreased,
+	 0 );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = gzipf_test_file_compare_data_at_offsets(
 	          file,
-	          -1,
-	          SEEK_CUR,
+	          uncompressed_data,
+	          uncompressed_data_size,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libgzipf_file_seek_offset(
+	/* Clean up
+	 */
+	result = libgzipf_file_close(
 	          file,
-	          (off64_t) ( -1 * ( size + 1 ) ),
-	          SEEK_END,
 	          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libgzipf_file_free(
+	          &file,
+	          &error );
 
-#if defined( HAVE_GZIPF_TEST_RWLOCK )
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* Test libgzipf_file_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	offset = libgzipf_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_SET,
+	result = gzipf_test_close_file_io_handle(
+	          &file_io_handle,
 	          &error );
 
-	if( gzipf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		gzipf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		GZIPF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		GZIPF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 gzip_data );
+
+	gzip_data = NULL;
+
+	return( 1 );
 
+on_error:
+	if( error != NULL )
+	{
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libgzipf_file_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	gzipf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( gzip_data != NULL )
+	{
+		memory_free(
+		 gzip_data );
+	}
+	return( 0 );
+}
 
-	offset = libgzipf_file_seek_offset(
+/* Reads all the data in memory using a specific checksum policy
+ * and determines if the file is corrupted after reading
+ * Returns 1 if the data matches, 0 if not or -1 on error
+ */
+int gzipf_test_file_read_data_with_checksum_policy(
+     uint8_t *data,
+     size_t data_size,
+     const uint8_t *expected_data,
+     size_t expected_data_size,
+     int checksum_policy,
+     int *is_corrupted,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libgzipf_file_t *file            = NULL;
+	int result                       = 0;
+
+	if( gzipf_test_open_file_io_handle(
+	     &file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libgzipf_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libgzipf_file_set_checksum_policy(
+	     file,
+	     checksum_policy,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libgzipf_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     LIBGZIPF_OPEN_READ,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = gzipf_test_file_compare_data(
 	          file,
-	          0,
-	          SEEK_SET,
-	          &error );
+	          expected_data,
+	          expected_data_size,
+	          error );
 
-	if( gzipf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	*is_corrupted = libgzipf_file_is_corrupted(
+	                 file,
+	                 error );
+
+	if( *is_corrupted == -1 )
+	{
+		goto on_error;
+	}
+	if( libgzipf_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		goto on_error;
+	}
+	if( libgzipf_file_free(
+	     &file,
+	     error ) != 1 )
 	{
-		gzipf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+		goto on_error;
 	}
-	else
+	if( gzipf_test_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 0 )
 	{
-		GZIPF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
-
-		GZIPF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
+		goto on_error;
 	}
-#endif /* defined( HAVE_GZIPF_TEST_RWLOCK ) */
-
-	return( 1 );
+	return( result );
 
 on_error:
-	if( error != NULL )
+	if( file != NULL )
 	{
-		libcerror_error_free(
-		 &error );
+		libgzipf_file_free(
+		 &file,
+		 NULL );
 	}
-	return( 0 );
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Tests the libgzipf_file_get_offset function
+/* Tests reading a file with a corrupted checksum using the checksum policies
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_get_offset(
-     libgzipf_file_t *file )
+int gzipf_test_file_read_corrupted_checksum(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
-	int result               = 0;
+	int checksum_policies[ 3 ] = {
+		LIBGZIPF_CHECKSUM_POLICY_FULL,
+		LIBGZIPF_CHECKSUM_POLICY_DEFERRED,
+		LIBGZIPF_CHECKSUM_POLICY_OFF };
+
+	libcerror_error_t *error      = NULL;
+	uint8_t *gzip_data            = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t gzip_data_size         = 0;
+	size_t uncompressed_data_size = ( 3 * 1024 * 1024 ) + 4321;
+	int is_corrupted              = 0;
+	int policy_index              = 0;
+	int result                    = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libgzipf_file_get_offset(
-	          file,
-	          &offset,
+	result = gzipf_test_create_gzip_data(
+	          &gzip_data,
+	          &gzip_data_size,
+	          &uncompressed_data,
+	          uncompressed_data_size,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -2545,28 +4753,51 @@ int gzipf_test_file_get_offset(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libgzipf_file_get_offset(
-	          NULL,
-	          &offset,
-	          &error );
+	for( policy_index = 0;
+	     policy_index < 3;
+	     policy_index++ )
+	{
+		is_corrupted = -1;
+
+		result = gzipf_test_file_read_data_with_checksum_policy(
+		          gzip_data,
+		          gzip_data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          checksum_policies[ policy_index ],
+		          &is_corrupted,
+		          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "is_corrupted",
+		 is_corrupted,
+		 0 );
 
-	libcerror_error_free(
-	 &error );
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Corrupt the CRC-32 in the member footer
+	 */
+	gzip_data[ gzip_data_size - 8 ] ^= 0xff;
 
-	result = libgzipf_file_get_offset(
-	          file,
-	          NULL,
+	/* Test full checksum policy, the mismatch is an error of the read
+	 * that indexes the member
+	 */
+	result = gzipf_test_file_read_data_with_checksum_policy(
+	          gzip_data,
+	          gzip_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          LIBGZIPF_CHECKSUM_POLICY_FULL,
+	          &is_corrupted,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -2581,32 +4812,19 @@ int gzipf_test_file_get_offset(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libgzipf_file_get_uncompressed_data_size function
- * Returns 1 if successful or 0 if not
- */
-int gzipf_test_file_get_uncompressed_data_size(
-     libgzipf_file_t *file )
-{
-	libcerror_error_t *error        = NULL;
-	size64_t uncompressed_data_size = 0;
-	int result                      = 0;
-
-	/* Test regular cases
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Test deferred checksum policy, the data can be read and the mismatch
+	 * is reported after reading
 	 */
-	result = libgzipf_file_get_uncompressed_data_size(
-	          file,
-	          &uncompressed_data_size,
+	is_corrupted = -1;
+
+	result = gzipf_test_file_read_data_with_checksum_policy(
+	          gzip_data,
+	          gzip_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          LIBGZIPF_CHECKSUM_POLICY_DEFERRED,
+	          &is_corrupted,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -2614,45 +4832,55 @@ int gzipf_test_file_get_uncompressed_data_size(
 	 result,
 	 1 );
 
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "is_corrupted",
+	 is_corrupted,
+	 1 );
+
 	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Test checksum policy off, the mismatch is not reported
 	 */
-	result = libgzipf_file_get_uncompressed_data_size(
-	          NULL,
-	          &uncompressed_data_size,
+	is_corrupted = -1;
+
+	result = gzipf_test_file_read_data_with_checksum_policy(
+	          gzip_data,
+	          gzip_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          LIBGZIPF_CHECKSUM_POLICY_OFF,
+	          &is_corrupted,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "is_corrupted",
+	 is_corrupted,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libgzipf_file_get_uncompressed_data_size(
-	          file,
-	          NULL,
-	          &error );
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	uncompressed_data = NULL;
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	memory_free(
+	 gzip_data );
 
-	libcerror_error_free(
-	 &error );
+	gzip_data = NULL;
 
 	return( 1 );
 
@@ -2662,24 +4890,48 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( gzip_data != NULL )
+	{
+		memory_free(
+		 gzip_data );
+	}
 	return( 0 );
 }
 
-/* Tests the libgzipf_file_get_number_of_members function
+/* Tests the libgzipf_file_read_buffer function with more uncompressed data
+ * than fits in the uncompressed block buffer, so that the history distance
+ * codes refer to is moved to the start of the buffer while decoding
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_get_number_of_members(
-     libgzipf_file_t *file )
+int gzipf_test_file_read_buffer_large_data(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_members    = 0;
-	int result               = 0;
+	int decoders[ 2 ] = {
+		LIBGZIPF_DECODER_NATIVE,
+		LIBGZIPF_DECODER_DEFAULT };
 
-	/* Test regular cases
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libgzipf_file_t *file            = NULL;
+	uint8_t *gzip_data               = NULL;
+	uint8_t *uncompressed_data       = NULL;
+	size_t gzip_data_size            = 0;
+	size_t uncompressed_data_size    = ( 17 * 1024 * 1024 ) + 12345;
+	int decoder_index                = 0;
+	int result                       = 0;
+
+	/* Initialize test
 	 */
-	result = libgzipf_file_get_number_of_members(
-	          file,
-	          &number_of_members,
+	result = gzipf_test_create_gzip_data(
+	          &gzip_data,
+	          &gzip_data_size,
+	          &uncompressed_data,
+	          uncompressed_data_size,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -2691,41 +4943,149 @@ int gzipf_test_file_get_number_of_members(
 	 "error",
 	 error );
 
-	/* Test error cases
+	result = gzipf_test_open_file_io_handle(
+	          &file_io_handle,
+	          gzip_data,
+	          gzip_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( decoder_index = 0;
+	     decoder_index < 2;
+	     decoder_index++ )
+	{
+		result = libgzipf_file_initialize(
+		          &file,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libgzipf_file_set_decoder(
+		          file,
+		          decoders[ decoder_index ],
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libgzipf_file_open_file_io_handle(
+		          file,
+		          file_io_handle,
+		          LIBGZIPF_OPEN_READ,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = gzipf_test_file_compare_data(
+		          file,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = gzipf_test_file_compare_data_at_offsets(
+		          file,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libgzipf_file_close(
+		          file,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libgzipf_file_free(
+		          &file,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
 	 */
-	result = libgzipf_file_get_number_of_members(
-	          NULL,
-	          &number_of_members,
+	result = gzipf_test_close_file_io_handle(
+	          &file_io_handle,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	GZIPF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libgzipf_file_get_number_of_members(
-	          file,
-	          NULL,
-	          &error );
+	memory_free(
+	 uncompressed_data );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	uncompressed_data = NULL;
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	memory_free(
+	 gzip_data );
 
-	libcerror_error_free(
-	 &error );
+	gzip_data = NULL;
 
 	return( 1 );
 
@@ -2735,25 +5095,61 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( gzip_data != NULL )
+	{
+		memory_free(
+		 gzip_data );
+	}
 	return( 0 );
 }
 
-/* Tests the libgzipf_file_get_member_by_index function
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+/* Tests reading a file with a small checkpoint spacing
  * Returns 1 if successful or 0 if not
  */
-int gzipf_test_file_get_member_by_index(
-     libgzipf_file_t *file )
+int gzipf_test_internal_file_checkpoint_spacing(
+     void )
 {
-	libcerror_error_t *error  = NULL;
-	libgzipf_member_t *member = NULL;
-	int result                = 0;
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	libgzipf_file_t *file                             = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
+	uint8_t *gzip_data                                = NULL;
+	uint8_t *uncompressed_data                        = NULL;
+	size_t gzip_data_size                             = 0;
+	size_t maximum_uncompressed_size                  = 64 * 1024;
+	size_t uncompressed_data_size                     = ( 3 * 1024 * 1024 ) + 4321;
+	off64_t element_data_offset                       = 0;
+	off64_t offset                                    = 0;
+	int number_of_segments                            = 0;
+	int result                                        = 0;
+	int test_index                                    = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libgzipf_file_get_member_by_index(
-	          file,
-	          0,
-	          &member,
+	result = gzipf_test_create_gzip_data(
+	          &gzip_data,
+	          &gzip_data_size,
+	          &uncompressed_data,
+	          uncompressed_data_size,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -2765,12 +5161,10 @@ int gzipf_test_file_get_member_by_index(
 	 "error",
 	 error );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "member",
-	 member );
-
-	result = libgzipf_member_free(
-	          &member,
+	result = gzipf_test_open_file_io_handle(
+	          &file_io_handle,
+	          gzip_data,
+	          gzip_data_size,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
@@ -2782,73 +5176,206 @@ int gzipf_test_file_get_member_by_index(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test reading the file with the default and with a small checkpoint spacing
 	 */
-	result = libgzipf_file_get_member_by_index(
-	          NULL,
-	          0,
-	          &member,
-	          &error );
+	for( test_index = 0;
+	     test_index < 2;
+	     test_index++ )
+	{
+		result = libgzipf_file_initialize(
+		          &file,
+		          &error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "member",
-	 member );
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		if( test_index == 1 )
+		{
+			/* Only the native decoder creates checkpoints within Huffman compressed blocks
+			 */
+			result = libgzipf_file_set_decoder(
+			          file,
+			          LIBGZIPF_DECODER_NATIVE,
+			          &error );
 
-	libcerror_error_free(
-	 &error );
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	result = libgzipf_file_get_member_by_index(
-	          file,
-	          -1,
-	          &member,
-	          &error );
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
 
-	GZIPF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+			result = libgzipf_file_set_checkpoint_spacing(
+			          file,
+			          16 * 1024,
+			          maximum_uncompressed_size,
+			          &error );
 
-	GZIPF_TEST_ASSERT_IS_NULL(
-	 "member",
-	 member );
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libgzipf_file_open_file_io_handle(
+		          file,
+		          file_io_handle,
+		          LIBGZIPF_OPEN_READ,
+		          &error );
 
-	libcerror_error_free(
-	 &error );
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libgzipf_file_get_member_by_index(
-	          file,
-	          0,
-	          NULL,
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = gzipf_test_file_compare_data(
+		          file,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = gzipf_test_file_compare_data_at_offsets(
+		          file,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( test_index == 1 )
+		{
+			/* Test that the segments do not exceed the maximum uncompressed size
+			 */
+			number_of_segments = 0;
+			offset             = 0;
+
+			while( (size_t) offset < uncompressed_data_size )
+			{
+				result = libgzipf_internal_file_get_segment_descriptor_at_offset(
+				          (libgzipf_internal_file_t *) file,
+				          offset,
+				          &element_data_offset,
+				          &segment_descriptor,
+				          &error );
+
+				GZIPF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				GZIPF_TEST_ASSERT_IS_NOT_NULL(
+				 "segment_descriptor",
+				 segment_descriptor );
+
+				GZIPF_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				GZIPF_TEST_ASSERT_EQUAL_INT64(
+				 "element_data_offset",
+				 (int64_t) element_data_offset,
+				 (int64_t) 0 );
+
+				GZIPF_TEST_ASSERT_NOT_EQUAL_INT(
+				 "segment_descriptor->uncompressed_data_size",
+				 (int) ( segment_descriptor->uncompressed_data_size == 0 ),
+				 1 );
+
+				GZIPF_TEST_ASSERT_LESS_THAN_UINT64(
+				 "segment_descriptor->uncompressed_data_size",
+				 (uint64_t) segment_descriptor->uncompressed_data_size,
+				 (uint64_t) maximum_uncompressed_size + 1 );
+
+				offset += (off64_t) segment_descriptor->uncompressed_data_size;
+
+				number_of_segments++;
+			}
+			GZIPF_TEST_ASSERT_GREATER_THAN_INT(
+			 "number_of_segments",
+			 number_of_segments,
+			 (int) ( uncompressed_data_size / maximum_uncompressed_size ) );
+		}
+		result = libgzipf_file_close(
+		          file,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libgzipf_file_free(
+		          &file,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = gzipf_test_close_file_io_handle(
+	          &file_io_handle,
 	          &error );
 
 	GZIPF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	GZIPF_TEST_ASSERT_IS_NULL(
-	 "member",
-	 member );
-
-	GZIPF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 gzip_data );
+
+	gzip_data = NULL;
 
 	return( 1 );
 
@@ -2858,15 +5385,33 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( member != NULL )
+	if( file != NULL )
 	{
-		libgzipf_member_free(
-		 &member,
+		libgzipf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
 		 NULL );
 	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( gzip_data != NULL )
+	{
+		memory_free(
+		 gzip_data );
+	}
 	return( 0 );
 }
 
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2924,6 +5469,46 @@ int main(
 	 "libgzipf_file_free",
 	 gzipf_test_file_free );
 
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_set_decoder",
+	 gzipf_test_file_set_decoder );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_set_checksum_policy",
+	 gzipf_test_file_set_checksum_policy );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_set_checkpoint_spacing",
+	 gzipf_test_file_set_checkpoint_spacing );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_set_index_mode",
+	 gzipf_test_file_set_index_mode );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_write_index",
+	 gzipf_test_file_write_index );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_index_mode_background",
+	 gzipf_test_file_index_mode_background );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_read_corrupted_checksum",
+	 gzipf_test_file_read_corrupted_checksum );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_file_read_buffer_large_data",
+	 gzipf_test_file_read_buffer_large_data );
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_internal_file_checkpoint_spacing",
+	 gzipf_test_internal_file_checkpoint_spacing );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -3076,6 +5661,11 @@ int main(
 		 gzipf_test_file_get_offset,
 		 file );
 
+		GZIPF_TEST_RUN_WITH_ARGS(
+		 "libgzipf_file_wait_for_index",
+		 gzipf_test_file_wait_for_index,
+		 file );
+
 		GZIPF_TEST_RUN_WITH_ARGS(
 		 "libgzipf_file_get_uncompressed_data_size",
 		 gzipf_test_file_get_uncompressed_data_size,
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -35,6 +37,30 @@
 #include "gzipf_test_libclocale.h"
 #include "gzipf_test_libuna.h"
 
+/* The base values of the DEFLATE length codes 257 - 285
+ */
+const uint16_t gzipf_test_deflate_length_bases[ 29 ] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+/* The number of extra bits of the DEFLATE length codes 257 - 285
+ */
+const uint8_t gzipf_test_deflate_length_number_of_extra_bits[ 29 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+/* The base values of the DEFLATE distance codes 0 - 29
+ */
+const uint16_t gzipf_test_deflate_distance_bases[ 30 ] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+
+/* The number of extra bits of the DEFLATE distance codes 0 - 29
+ */
+const uint8_t gzipf_test_deflate_distance_number_of_extra_bits[ 30 ] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
 /* Retrieves source as a narrow string
  * Returns 1 if successful or -1 on error
  */
@@ -560,3 +586,583 @@ int gzipf_test_close_file_io_handle(
 	return( result );
 }
 
+/* Appends bits to DEFLATE compressed data, the least significant bit first
+ */
+void gzipf_test_deflate_append_bits(
+      uint8_t *compressed_data,
+      size_t *compressed_data_offset,
+      uint32_t *bit_buffer,
+      uint8_t *bit_buffer_size,
+      uint32_t value,
+      uint8_t number_of_bits )
+{
+	*bit_buffer      |= value << *bit_buffer_size;
+	*bit_buffer_size += number_of_bits;
+
+	while( *bit_buffer_size >= 8 )
+	{
+		compressed_data[ *compressed_data_offset ] = (uint8_t) ( *bit_buffer & 0xff );
+
+		*compressed_data_offset += 1;
+		*bit_buffer            >>= 8;
+		*bit_buffer_size        -= 8;
+	}
+}
+
+/* Appends a fixed Huffman literal or length code to DEFLATE compressed data
+ * A Huffman code is stored the most significant bit first
+ */
+void gzipf_test_deflate_append_fixed_huffman_code(
+      uint8_t *compressed_data,
+      size_t *compressed_data_offset,
+      uint32_t *bit_buffer,
+      uint8_t *bit_buffer_size,
+      uint16_t symbol )
+{
+	uint32_t code          = 0;
+	uint32_t reversed_code = 0;
+	uint8_t bit_index      = 0;
+	uint8_t number_of_bits = 0;
+
+	if( symbol < 144 )
+	{
+		code           = 0x0030 + symbol;
+		number_of_bits = 8;
+	}
+	else if( symbol < 256 )
+	{
+		code           = 0x0190 + ( symbol - 144 );
+		number_of_bits = 9;
+	}
+	else if( symbol < 280 )
+	{
+		code           = symbol - 256;
+		number_of_bits = 7;
+	}
+	else
+	{
+		code           = 0x00c0 + ( symbol - 280 );
+		number_of_bits = 8;
+	}
+	for( bit_index = 0;
+	     bit_index < number_of_bits;
+	     bit_index++ )
+	{
+		reversed_code = ( reversed_code << 1 ) | ( ( code >> bit_index ) & 0x00000001UL );
+	}
+	gzipf_test_deflate_append_bits(
+	 compressed_data,
+	 compressed_data_offset,
+	 bit_buffer,
+	 bit_buffer_size,
+	 reversed_code,
+	 number_of_bits );
+}
+
+/* Appends a fixed Huffman distance code and its extra bits to DEFLATE compressed data
+ */
+void gzipf_test_deflate_append_fixed_huffman_distance(
+      uint8_t *compressed_data,
+      size_t *compressed_data_offset,
+      uint32_t *bit_buffer,
+      uint8_t *bit_buffer_size,
+      uint16_t distance )
+{
+	uint32_t reversed_code = 0;
+	uint8_t bit_index      = 0;
+	uint8_t code           = 29;
+
+	while( gzipf_test_deflate_distance_bases[ code ] > distance )
+	{
+		code--;
+	}
+	for( bit_index = 0;
+	     bit_index < 5;
+	     bit_index++ )
+	{
+		reversed_code = ( reversed_code << 1 ) | ( ( code >> bit_index ) & 0x01 );
+	}
+	gzipf_test_deflate_append_bits(
+	 compressed_data,
+	 compressed_data_offset,
+	 bit_buffer,
+	 bit_buffer_size,
+	 reversed_code,
+	 5 );
+
+	gzipf_test_deflate_append_bits(
+	 compressed_data,
+	 compressed_data_offset,
+	 bit_buffer,
+	 bit_buffer_size,
+	 (uint32_t) ( distance - gzipf_test_deflate_distance_bases[ code ] ),
+	 gzipf_test_deflate_distance_number_of_extra_bits[ code ] );
+}
+
+/* Creates DEFLATE compressed test data
+ * The data consists of fixed Huffman compressed blocks of pseudo-random literals
+ * and matches with distances up to 32768, including the maximum distance,
+ * so that decoding depends on the history of the preceding data
+ * Returns 1 if successful or -1 on error
+ */
+int gzipf_test_create_deflate_data(
+     uint8_t **compressed_data,
+     size_t *compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_compressed_data   = NULL;
+	uint8_t *safe_uncompressed_data = NULL;
+	static char *function           = "gzipf_test_create_deflate_data";
+	size_t compressed_data_offset   = 0;
+	size_t data_index               = 0;
+	size_t maximum_distance         = 0;
+	size_t number_of_symbols        = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t bit_buffer             = 0;
+	uint32_t random_value           = 0x2f6a8e3bUL;
+	uint16_t distance               = 0;
+	uint16_t match_size             = 0;
+	uint8_t bit_buffer_size         = 0;
+	uint8_t length_code             = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A fixed Huffman code is at most 9 bits per byte of uncompressed data
+	 */
+	safe_compressed_data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * ( uncompressed_data_size + ( uncompressed_data_size / 8 ) + 1024 ) );
+
+	if( safe_compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	safe_uncompressed_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( safe_uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		/* Start a fixed Huffman compressed block: BFINAL 0 and BTYPE 1
+		 */
+		if( number_of_symbols == 0 )
+		{
+			gzipf_test_deflate_append_bits(
+			 safe_compressed_data,
+			 &compressed_data_offset,
+			 &bit_buffer,
+			 &bit_buffer_size,
+			 0x00000002UL,
+			 3 );
+		}
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		if( ( uncompressed_data_offset == 0 )
+		 || ( ( uncompressed_data_size - uncompressed_data_offset ) < 3 )
+		 || ( ( ( random_value >> 16 ) % 8 ) < 3 ) )
+		{
+			random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+			safe_uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) ( random_value >> 16 );
+
+			gzipf_test_deflate_append_fixed_huffman_code(
+			 safe_compressed_data,
+			 &compressed_data_offset,
+			 &bit_buffer,
+			 &bit_buffer_size,
+			 (uint16_t) ( ( random_value >> 16 ) & 0xff ) );
+		}
+		else
+		{
+			match_size = (uint16_t) ( 3 + ( ( random_value >> 20 ) % 256 ) );
+
+			if( (size_t) match_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				match_size = (uint16_t) ( uncompressed_data_size - uncompressed_data_offset );
+			}
+			maximum_distance = uncompressed_data_offset;
+
+			if( maximum_distance > 32768 )
+			{
+				maximum_distance = 32768;
+			}
+			random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+			/* Use the maximum distance regularly to refer to the oldest history
+			 */
+			if( ( ( random_value >> 16 ) % 4 ) == 0 )
+			{
+				distance = (uint16_t) maximum_distance;
+			}
+			else
+			{
+				distance = (uint16_t) ( 1 + ( ( random_value >> 8 ) % maximum_distance ) );
+			}
+			for( data_index = 0;
+			     data_index < (size_t) match_size;
+			     data_index++ )
+			{
+				safe_uncompressed_data[ uncompressed_data_offset ] = safe_uncompressed_data[ uncompressed_data_offset - distance ];
+
+				uncompressed_data_offset++;
+			}
+			length_code = 28;
+
+			while( gzipf_test_deflate_length_bases[ length_code ] > match_size )
+			{
+				length_code--;
+			}
+			gzipf_test_deflate_append_fixed_huffman_code(
+			 safe_compressed_data,
+			 &compressed_data_offset,
+			 &bit_buffer,
+			 &bit_buffer_size,
+			 (uint16_t) ( 257 + length_code ) );
+
+			gzipf_test_deflate_append_bits(
+			 safe_compressed_data,
+			 &compressed_data_offset,
+			 &bit_buffer,
+			 &bit_buffer_size,
+			 (uint32_t) ( match_size - gzipf_test_deflate_length_bases[ length_code ] ),
+			 gzipf_test_deflate_length_number_of_extra_bits[ length_code ] );
+
+			gzipf_test_deflate_append_fixed_huffman_distance(
+			 safe_compressed_data,
+			 &compressed_data_offset,
+			 &bit_buffer,
+			 &bit_buffer_size,
+			 distance );
+		}
+		number_of_symbols++;
+
+		/* End the block with the end-of-block code
+		 */
+		if( number_of_symbols >= 8192 )
+		{
+			gzipf_test_deflate_append_fixed_huffman_code(
+			 safe_compressed_data,
+			 &compressed_data_offset,
+			 &bit_buffer,
+			 &bit_buffer_size,
+			 256 );
+
+			number_of_symbols = 0;
+		}
+	}
+	if( number_of_symbols > 0 )
+	{
+		gzipf_test_deflate_append_fixed_huffman_code(
+		 safe_compressed_data,
+		 &compressed_data_offset,
+		 &bit_buffer,
+		 &bit_buffer_size,
+		 256 );
+	}
+	/* End the stream with an empty fixed Huffman compressed block: BFINAL 1 and BTYPE 1
+	 */
+	gzipf_test_deflate_append_bits(
+	 safe_compressed_data,
+	 &compressed_data_offset,
+	 &bit_buffer,
+	 &bit_buffer_size,
+	 0x00000003UL,
+	 3 );
+
+	gzipf_test_deflate_append_fixed_huffman_code(
+	 safe_compressed_data,
+	 &compressed_data_offset,
+	 &bit_buffer,
+	 &bit_buffer_size,
+	 256 );
+
+	if( bit_buffer_size > 0 )
+	{
+		gzipf_test_deflate_append_bits(
+		 safe_compressed_data,
+		 &compressed_data_offset,
+		 &bit_buffer,
+		 &bit_buffer_size,
+		 0,
+		 8 - bit_buffer_size );
+	}
+	*compressed_data      = safe_compressed_data;
+	*compressed_data_size = compressed_data_offset;
+	*uncompressed_data    = safe_uncompressed_data;
+
+	return( 1 );
+
+on_error:
+	if( safe_uncompressed_data != NULL )
+	{
+		memory_free(
+		 safe_uncompressed_data );
+	}
+	if( safe_compressed_data != NULL )
+	{
+		memory_free(
+		 safe_compressed_data );
+	}
+	return( -1 );
+}
+
+/* Calculates the CRC-32 of test data
+ * Returns the CRC-32
+ */
+uint32_t gzipf_test_calculate_crc32(
+          const uint8_t *data,
+          size_t data_size )
+{
+	uint32_t crc32_table[ 256 ];
+
+	size_t data_index    = 0;
+	uint32_t checksum    = 0xffffffffUL;
+	uint32_t table_index = 0;
+	uint32_t value_32bit = 0;
+	uint8_t bit_index    = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		value_32bit = table_index;
+
+		for( bit_index = 0;
+		     bit_index < 8;
+		     bit_index++ )
+		{
+			if( ( value_32bit & 0x00000001UL ) != 0 )
+			{
+				value_32bit = 0xedb88320UL ^ ( value_32bit >> 1 );
+			}
+			else
+			{
+				value_32bit >>= 1;
+			}
+		}
+		crc32_table[ table_index ] = value_32bit;
+	}
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		checksum = crc32_table[ ( checksum ^ data[ data_index ] ) & 0xff ] ^ ( checksum >> 8 );
+	}
+	return( checksum ^ 0xffffffffUL );
+}
+
+/* Creates GZIP compressed test data that consists of a single member
+ * Returns 1 if successful or -1 on error
+ */
+int gzipf_test_create_gzip_data(
+     uint8_t **gzip_data,
+     size_t *gzip_data_size,
+     uint8_t **uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *compressed_data    = NULL;
+	uint8_t *safe_gzip_data     = NULL;
+	static char *function       = "gzipf_test_create_gzip_data";
+	size_t compressed_data_size = 0;
+	uint32_t checksum           = 0;
+
+	if( gzip_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GZIP data.",
+		 function );
+
+		return( -1 );
+	}
+	if( gzip_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GZIP data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( gzipf_test_create_deflate_data(
+	     &compressed_data,
+	     &compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create DEFLATE compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The member header is 10 bytes and the member footer 8 bytes
+	 */
+	safe_gzip_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * ( compressed_data_size + 18 ) );
+
+	if( safe_gzip_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create GZIP data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_gzip_data,
+	     0,
+	     10 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear member header.",
+		 function );
+
+		goto on_error;
+	}
+	safe_gzip_data[ 0 ] = 0x1f;
+	safe_gzip_data[ 1 ] = 0x8b;
+	safe_gzip_data[ 2 ] = 0x08;
+	safe_gzip_data[ 9 ] = 0x03;
+
+	if( memory_copy(
+	     &( safe_gzip_data[ 10 ] ),
+	     compressed_data,
+	     compressed_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	checksum = gzipf_test_calculate_crc32(
+	            *uncompressed_data,
+	            uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( safe_gzip_data[ compressed_data_size + 10 ] ),
+	 checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( safe_gzip_data[ compressed_data_size + 14 ] ),
+	 (uint32_t) uncompressed_data_size );
+
+	memory_free(
+	 compressed_data );
+
+	*gzip_data      = safe_gzip_data;
+	*gzip_data_size = compressed_data_size + 18;
+
+	return( 1 );
+
+on_error:
+	if( safe_gzip_data != NULL )
+	{
+		memory_free(
+		 safe_gzip_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		memory_free(
+		 *uncompressed_data );
+
+		*uncompressed_data = NULL;
+	}
+	return( -1 );
+}
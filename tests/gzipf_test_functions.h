@@ -58,6 +58,46 @@ int gzipf_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+void gzipf_test_deflate_append_bits(
+      uint8_t *compressed_data,
+      size_t *compressed_data_offset,
+      uint32_t *bit_buffer,
+      uint8_t *bit_buffer_size,
+      uint32_t value,
+      uint8_t number_of_bits );
+
+void gzipf_test_deflate_append_fixed_huffman_code(
+      uint8_t *compressed_data,
+      size_t *compressed_data_offset,
+      uint32_t *bit_buffer,
+      uint8_t *bit_buffer_size,
+      uint16_t symbol );
+
+void gzipf_test_deflate_append_fixed_huffman_distance(
+      uint8_t *compressed_data,
+      size_t *compressed_data_offset,
+      uint32_t *bit_buffer,
+      uint8_t *bit_buffer_size,
+      uint16_t distance );
+
+int gzipf_test_create_deflate_data(
+     uint8_t **compressed_data,
+     size_t *compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+uint32_t gzipf_test_calculate_crc32(
+          const uint8_t *data,
+          size_t data_size );
+
+int gzipf_test_create_gzip_data(
+     uint8_t **gzip_data,
+     size_t *gzip_data_size,
+     uint8_t **uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -204,6 +204,14 @@ uint8_t gzipf_test_huffman_tree_data[ 2627 ] = {
 	0x7d, 0x8a, 0x87, 0xf9, 0x9d, 0x74, 0x33, 0x0e, 0x79, 0xc5, 0xf8, 0x73, 0xcd, 0xff, 0x00, 0x30,
 	0x4a, 0x56, 0xa4 };
 
+/* The symbols 14, 15 and 0 encoded with code sizes 15, 15 and 1
+ */
+uint8_t gzipf_test_huffman_tree_long_codes_data[ 4 ] = {
+	0xff, 0xbf, 0xff, 0x3f };
+
+uint16_t gzipf_test_huffman_tree_long_codes_symbols[ 3 ] = {
+	14, 15, 0 };
+
 #if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
 
 /* Tests the libgzipf_huffman_tree_initialize function
@@ -689,6 +697,7 @@ int gzipf_test_huffman_tree_get_symbol_from_bit_stream(
 	libgzipf_huffman_tree_t *huffman_tree = NULL;
 	libcerror_error_t *error             = NULL;
 	uint16_t symbol                      = 0;
+	int code_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
@@ -797,6 +806,74 @@ int gzipf_test_huffman_tree_get_symbol_from_bit_stream(
 	 "error",
 	 error );
 
+	/* Test symbols with code sizes that exceed the lookup table bits
+	 */
+	for( symbol = 0;
+	     symbol < 16;
+	     symbol++ )
+	{
+		if( symbol < 15 )
+		{
+			code_size_array[ symbol ] = (uint8_t) ( symbol + 1 );
+		}
+		else
+		{
+			code_size_array[ symbol ] = 15;
+		}
+	}
+	result = libgzipf_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          16,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_stream->byte_stream        = gzipf_test_huffman_tree_long_codes_data;
+	bit_stream->byte_stream_size   = 4;
+	bit_stream->byte_stream_offset = 0;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	for( code_index = 0;
+	     code_index < 3;
+	     code_index++ )
+	{
+		symbol = 0;
+
+		result = libgzipf_huffman_tree_get_symbol_from_bit_stream(
+		          huffman_tree,
+		          bit_stream,
+		          &symbol,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_EQUAL_UINT16(
+		 "symbol",
+		 symbol,
+		 gzipf_test_huffman_tree_long_codes_symbols[ code_index ] );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	bit_stream->byte_stream        = gzipf_test_huffman_tree_data;
+	bit_stream->byte_stream_size   = 2627;
+	bit_stream->byte_stream_offset = 2;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
 	/* Test error cases
 	 */
 	symbol = 0;
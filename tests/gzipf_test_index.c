@@ -0,0 +1,491 @@
+/*
+ * Library index functions test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "gzipf_test_functions.h"
+#include "gzipf_test_libcerror.h"
+#include "gzipf_test_libgzipf.h"
+#include "gzipf_test_macros.h"
+#include "gzipf_test_memory.h"
+#include "gzipf_test_unused.h"
+
+#include "../libgzipf/libgzipf_index.h"
+
+uint8_t gzipf_test_index_data1[ 48 ] = {
+	0x67, 0x7a, 0x69, 0x70, 0x66, 0x69, 0x64, 0x78, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xbe, 0xad, 0xde };
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+/* Tests the libgzipf_index_read_file_header function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_index_read_file_header(
+     void )
+{
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	size64_t file_size                 = 0;
+	off64_t compressed_segments_offset = 0;
+	off64_t index_file_offset          = 0;
+	uint32_t checksum                  = 0;
+	uint32_t fingerprint               = 0;
+	uint32_t flags                     = 0;
+	int number_of_members              = 0;
+	int number_of_segments             = 0;
+	int result                         = 0;
+
+	/* Initialize file IO handle
+	 */
+	result = gzipf_test_open_file_io_handle(
+	          &file_io_handle,
+	          gzipf_test_index_data1,
+	          44,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libgzipf_index_read_file_header(
+	          file_io_handle,
+	          &index_file_offset,
+	          &flags,
+	          &file_size,
+	          &fingerprint,
+	          &number_of_members,
+	          &number_of_segments,
+	          &compressed_segments_offset,
+	          &checksum,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "index_file_offset",
+	 (int64_t) index_file_offset,
+	 (int64_t) 44 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) 0x1000 );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT32(
+	 "fingerprint",
+	 fingerprint,
+	 (uint32_t) 0x12345678UL );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_members",
+	 number_of_members,
+	 1 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT64(
+	 "compressed_segments_offset",
+	 (int64_t) compressed_segments_offset,
+	 (int64_t) 0x20 );
+
+	/* Test error cases
+	 */
+	index_file_offset = 0;
+
+	result = libgzipf_index_read_file_header(
+	          NULL,
+	          &index_file_offset,
+	          &flags,
+	          &file_size,
+	          &fingerprint,
+	          &number_of_members,
+	          &number_of_segments,
+	          &compressed_segments_offset,
+	          &checksum,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_index_read_file_header(
+	          file_io_handle,
+	          NULL,
+	          &flags,
+	          &file_size,
+	          &fingerprint,
+	          &number_of_members,
+	          &number_of_segments,
+	          &compressed_segments_offset,
+	          &checksum,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test unsupported signature
+	 */
+	gzipf_test_index_data1[ 0 ] = 0xff;
+
+	result = libgzipf_index_read_file_header(
+	          file_io_handle,
+	          &index_file_offset,
+	          &flags,
+	          &file_size,
+	          &fingerprint,
+	          &number_of_members,
+	          &number_of_segments,
+	          &compressed_segments_offset,
+	          &checksum,
+	          &error );
+
+	gzipf_test_index_data1[ 0 ] = 0x67;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up file IO handle
+	 */
+	result = gzipf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data too small
+	 */
+	result = gzipf_test_open_file_io_handle(
+	          &file_io_handle,
+	          gzipf_test_index_data1,
+	          8,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+	index_file_offset = 0;
+
+	result = libgzipf_index_read_file_header(
+	          file_io_handle,
+	          &index_file_offset,
+	          &flags,
+	          &file_size,
+	          &fingerprint,
+	          &number_of_members,
+	          &number_of_segments,
+	          &compressed_segments_offset,
+	          &checksum,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzipf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_index_read_file_footer function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_index_read_file_footer(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	off64_t index_file_offset        = 0;
+	int result                       = 0;
+
+	/* Initialize file IO handle
+	 */
+	result = gzipf_test_open_file_io_handle(
+	          &file_io_handle,
+	          gzipf_test_index_data1,
+	          48,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	index_file_offset = 44;
+
+	result = libgzipf_index_read_file_footer(
+	          file_io_handle,
+	          &index_file_offset,
+	          0xdeadbeefUL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test checksum mismatch
+	 */
+	index_file_offset = 44;
+
+	result = libgzipf_index_read_file_footer(
+	          file_io_handle,
+	          &index_file_offset,
+	          0x12345678UL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	index_file_offset = 44;
+
+	result = libgzipf_index_read_file_footer(
+	          NULL,
+	          &index_file_offset,
+	          0xdeadbeefUL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_index_read_file_footer(
+	          file_io_handle,
+	          NULL,
+	          0xdeadbeefUL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = gzipf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argc )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+	/* TODO: add tests for libgzipf_index_calculate_fingerprint */
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_index_read_file_header",
+	 gzipf_test_index_read_file_header );
+
+	/* TODO: add tests for libgzipf_index_read_member_descriptor */
+
+	/* TODO: add tests for libgzipf_index_read_segment_descriptor */
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_index_read_file_footer",
+	 gzipf_test_index_read_file_footer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
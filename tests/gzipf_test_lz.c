@@ -0,0 +1,518 @@
+/*
+ * Library LZ compression functions test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "gzipf_test_libcerror.h"
+#include "gzipf_test_libgzipf.h"
+#include "gzipf_test_macros.h"
+#include "gzipf_test_unused.h"
+
+#include "../libgzipf/libgzipf_lz.h"
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+/* Tests the libgzipf_lz_compress and libgzipf_lz_decompress functions
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_lz_compress(
+     void )
+{
+	uint8_t compressed_data[ 32768 ];
+	uint8_t expected_data[ 32768 ];
+	uint8_t uncompressed_data[ 32768 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t data_offset            = 0;
+	size_t uncompressed_data_size = 0;
+	uint32_t random_value         = 1;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 32768;
+	     data_offset++ )
+	{
+		/* Text like data with repetitions
+		 */
+		expected_data[ data_offset ] = (uint8_t) ( 'a' + ( ( data_offset / 7 ) % 23 ) );
+	}
+	/* Test regular cases
+	 */
+	compressed_data_size = 32768;
+
+	result = libgzipf_lz_compress(
+	          expected_data,
+	          32768,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_LESS_THAN_UINT64(
+	 "compressed_data_size",
+	 (uint64_t) compressed_data_size,
+	 (uint64_t) 4096 );
+
+	uncompressed_data_size = 32768;
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 32768 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          32768 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data that contains matches of more than 15 bytes and long literal runs
+	 */
+	for( data_offset = 0;
+	     data_offset < 32768;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		if( ( data_offset % 4096 ) < 1024 )
+		{
+			expected_data[ data_offset ] = 0;
+		}
+		else
+		{
+			expected_data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+		}
+	}
+	compressed_data_size = 32768;
+
+	result = libgzipf_lz_compress(
+	          expected_data,
+	          32768,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = 32768;
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 32768 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          32768 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test compressed data that does not fit
+	 */
+	compressed_data_size = 1024;
+
+	result = libgzipf_lz_compress(
+	          expected_data,
+	          32768,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 32768;
+
+	result = libgzipf_lz_compress(
+	          NULL,
+	          32768,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 32768;
+
+	result = libgzipf_lz_compress(
+	          expected_data,
+	          32768,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_lz_compress(
+	          expected_data,
+	          32768,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_lz_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_lz_decompress(
+     void )
+{
+	uint8_t compressed_data[ 8 ] = {
+		0x42, 0x61, 0x62, 0x62, 0x61, 0x02, 0x00, 0x00 };
+
+	uint8_t uncompressed_data[ 16 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 16;
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          8,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 10 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "abbabababa",
+	          10 );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 16;
+
+	result = libgzipf_lz_decompress(
+	          NULL,
+	          8,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 16;
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          8,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          8,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too small
+	 */
+	uncompressed_data_size = 8;
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          8,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test invalid match distance
+	 */
+	compressed_data[ 5 ] = 0x05;
+
+	uncompressed_data_size = 16;
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          8,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	compressed_data[ 5 ] = 0x02;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	uncompressed_data_size = 16;
+
+	result = libgzipf_lz_decompress(
+	          compressed_data,
+	          6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argc )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_lz_compress",
+	 gzipf_test_lz_compress );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_lz_decompress",
+	 gzipf_test_lz_decompress );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,866 @@
+/*
+ * Library sequential_reader type test program
+ *
+ * Copyright (C) 2019-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "gzipf_test_functions.h"
+#include "gzipf_test_libbfio.h"
+#include "gzipf_test_libcerror.h"
+#include "gzipf_test_libgzipf.h"
+#include "gzipf_test_macros.h"
+#include "gzipf_test_memory.h"
+#include "gzipf_test_unused.h"
+
+#include "../libgzipf/libgzipf_segment_descriptor.h"
+#include "../libgzipf/libgzipf_sequential_reader.h"
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+/* Tests the libgzipf_sequential_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_sequential_reader_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libgzipf_sequential_reader_t *sequential_reader = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_GZIPF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 2;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libgzipf_sequential_reader_initialize(
+	          &sequential_reader,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_sequential_reader_free(
+	          &sequential_reader,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libgzipf_sequential_reader_initialize(
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sequential_reader = (libgzipf_sequential_reader_t *) 0x12345678UL;
+
+	result = libgzipf_sequential_reader_initialize(
+	          &sequential_reader,
+	          &error );
+
+	sequential_reader = NULL;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_GZIPF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libgzipf_sequential_reader_initialize with malloc failing
+		 */
+		gzipf_test_malloc_attempts_before_fail = test_number;
+
+		result = libgzipf_sequential_reader_initialize(
+		          &sequential_reader,
+		          &error );
+
+		if( gzipf_test_malloc_attempts_before_fail != -1 )
+		{
+			gzipf_test_malloc_attempts_before_fail = -1;
+
+			if( sequential_reader != NULL )
+			{
+				libgzipf_sequential_reader_free(
+				 &sequential_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "sequential_reader",
+			 sequential_reader );
+
+			GZIPF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libgzipf_sequential_reader_initialize with memset failing
+		 */
+		gzipf_test_memset_attempts_before_fail = test_number;
+
+		result = libgzipf_sequential_reader_initialize(
+		          &sequential_reader,
+		          &error );
+
+		if( gzipf_test_memset_attempts_before_fail != -1 )
+		{
+			gzipf_test_memset_attempts_before_fail = -1;
+
+			if( sequential_reader != NULL )
+			{
+				libgzipf_sequential_reader_free(
+				 &sequential_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "sequential_reader",
+			 sequential_reader );
+
+			GZIPF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_GZIPF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequential_reader != NULL )
+	{
+		libgzipf_sequential_reader_free(
+		 &sequential_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_sequential_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_sequential_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libgzipf_sequential_reader_free(
+	          NULL,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_sequential_reader_start function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_sequential_reader_start(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
+	libgzipf_sequential_reader_t *sequential_reader   = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libgzipf_sequential_reader_initialize(
+	          &sequential_reader,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->decoder_type = LIBGZIPF_DECODER_NATIVE;
+
+	/* Test regular cases
+	 */
+	result = libgzipf_sequential_reader_start(
+	          sequential_reader,
+	          segment_descriptor,
+	          NULL,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	GZIPF_TEST_ASSERT_EQUAL_UINT8(
+	 "sequential_reader->is_active",
+	 sequential_reader->is_active,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libgzipf_sequential_reader_start(
+	          NULL,
+	          segment_descriptor,
+	          NULL,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_sequential_reader_start(
+	          sequential_reader,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libgzipf_sequential_reader_start(
+	          sequential_reader,
+	          segment_descriptor,
+	          NULL,
+	          -1,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	segment_descriptor->is_stored = 1;
+
+	result = libgzipf_sequential_reader_start(
+	          sequential_reader,
+	          segment_descriptor,
+	          NULL,
+	          0,
+	          &error );
+
+	segment_descriptor->is_stored = 0;
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_segment_descriptor_free(
+	          &segment_descriptor,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_sequential_reader_free(
+	          &sequential_reader,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libgzipf_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( sequential_reader != NULL )
+	{
+		libgzipf_sequential_reader_free(
+		 &sequential_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libgzipf_sequential_reader_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int gzipf_test_sequential_reader_read_buffer(
+     void )
+{
+	uint8_t buffer[ 65521 ];
+
+	int decoder_types[ 2 ] = {
+		LIBGZIPF_DECODER_NATIVE,
+		LIBGZIPF_DECODER_ZLIB };
+
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	libgzipf_segment_descriptor_t *segment_descriptor = NULL;
+	libgzipf_sequential_reader_t *sequential_reader   = NULL;
+	uint8_t *compressed_data                          = NULL;
+	uint8_t *uncompressed_data                        = NULL;
+	size_t compressed_data_size                       = 0;
+	size_t uncompressed_data_offset                   = 0;
+	size_t uncompressed_data_size                     = 0;
+	ssize_t read_count                                = 0;
+	int decoder_index                                 = 0;
+	int number_of_decoders                            = 1;
+	int result                                        = 0;
+
+	/* Initialize test
+	 * The uncompressed data is larger than twice the sequential read data
+	 * so that the history is moved multiple times while its distance codes
+	 * refer to the data before the move
+	 */
+	uncompressed_data_size = ( 2 * ( LIBGZIPF_MAXIMUM_DEFLATE_DISTANCE + LIBGZIPF_SEQUENTIAL_READ_DATA_SIZE ) ) + 12345;
+
+	result = gzipf_test_create_deflate_data(
+	          &compressed_data,
+	          &compressed_data_size,
+	          &uncompressed_data,
+	          uncompressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzipf_test_open_file_io_handle(
+	          &file_io_handle,
+	          compressed_data,
+	          compressed_data_size,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_sequential_reader_initialize(
+	          &sequential_reader,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_INFLATE ) ) || defined( ZLIB_DLL )
+	number_of_decoders = 2;
+#endif
+
+	/* Test regular cases
+	 * The data is read in multiple calls of a size that does not align
+	 * with the sequential read data
+	 */
+	for( decoder_index = 0;
+	     decoder_index < number_of_decoders;
+	     decoder_index++ )
+	{
+		segment_descriptor->decoder_type = decoder_types[ decoder_index ];
+
+		result = libgzipf_sequential_reader_start(
+		          sequential_reader,
+		          segment_descriptor,
+		          file_io_handle,
+		          0,
+		          &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_offset = 0;
+
+		while( uncompressed_data_offset < uncompressed_data_size )
+		{
+			read_count = libgzipf_sequential_reader_read_buffer(
+			              sequential_reader,
+			              file_io_handle,
+			              buffer,
+			              65521,
+			              &error );
+
+			GZIPF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) -1 );
+
+			GZIPF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			GZIPF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) 0 );
+
+			GZIPF_TEST_ASSERT_LESS_THAN_UINT64(
+			 "read_count",
+			 (uint64_t) read_count,
+			 (uint64_t) ( uncompressed_data_size - uncompressed_data_offset + 1 ) );
+
+			result = memory_compare(
+			          buffer,
+			          &( uncompressed_data[ uncompressed_data_offset ] ),
+			          (size_t) read_count );
+
+			GZIPF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			uncompressed_data_offset += (size_t) read_count;
+		}
+		read_count = libgzipf_sequential_reader_read_buffer(
+		              sequential_reader,
+		              file_io_handle,
+		              buffer,
+		              65521,
+		              &error );
+
+		GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		GZIPF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	read_count = libgzipf_sequential_reader_read_buffer(
+	              NULL,
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read without the sequential reader being started
+	 */
+	sequential_reader->is_active = 0;
+
+	read_count = libgzipf_sequential_reader_read_buffer(
+	              sequential_reader,
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	GZIPF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libgzipf_sequential_reader_free(
+	          &sequential_reader,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libgzipf_segment_descriptor_free(
+	          &segment_descriptor,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzipf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	GZIPF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	GZIPF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 compressed_data );
+
+	compressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequential_reader != NULL )
+	{
+		libgzipf_sequential_reader_free(
+		 &sequential_reader,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libgzipf_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc GZIPF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] GZIPF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argc )
+	GZIPF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT )
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_sequential_reader_initialize",
+	 gzipf_test_sequential_reader_initialize );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_sequential_reader_free",
+	 gzipf_test_sequential_reader_free );
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_sequential_reader_start",
+	 gzipf_test_sequential_reader_start );
+
+	/* TODO: add tests for libgzipf_sequential_reader_read_compressed_data */
+
+	GZIPF_TEST_RUN(
+	 "libgzipf_sequential_reader_read_buffer",
+	 gzipf_test_sequential_reader_read_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBGZIPF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
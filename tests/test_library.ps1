@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "bit_stream checksum compressed_segment deflate error huffman_tree io_handle member member_descriptor member_footer member_header notify"
+$LibraryTests = "bit_stream checksum compressed_segment cpu decoder deflate deflate_stream error huffman_tree index io_handle lz member member_descriptor member_footer member_header notify sequential_reader"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 